@@ -18,16 +18,13 @@ Nokia5110::Nokia5110()
     this->_clock        = 0;
     this->_dc           = 0;
     this->_reset        = 0;
-    this->_data         = nullptr;
+    this->_bus          = nullptr;
     this->_posX         = 0;
     this->_posY         = 0;
-
-    // Allocates memory
-    this->_data = (uint8_t *)calloc(504, sizeof(uint8_t));
-    if(!isPointerValid(this->_data)) {
-        // Returns error
-        this->_lastError = Error::MEMORY_ALLOCATION_FAILED;
-        return;
+    memset(this->_data, 0x00, constNokia5110BufferSize);
+    for(uint8_t i = 0; i < constNokia5110Banks; i++) {
+        this->_dirtyFirst[i] = 0xFF;
+        this->_dirtyLast[i] = 0;
     }
 
     // Returns successfully
@@ -72,6 +69,21 @@ bool_t Nokia5110::setPort(ioRegAddress_t controlPort_p, ioPinIndex_t chipSelectP
     return true;
 }
 
+bool_t Nokia5110::setBus(Bus *bus_p)
+{
+    // Updates data members
+    //      When set, the bus shifts the bytes out; chip select and
+    //      data/command pins are still driven here. Usart0 initialized in one
+    //      of the MASTER_SPI_MODE_x modes is the only Bus that implements
+    //      write() in this library. Pass nullptr to return to bit-banging
+    //      through the data/clock pins.
+    this->_bus = bus_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
 bool_t Nokia5110::init()
 {
     // Resets data members
@@ -83,17 +95,13 @@ bool_t Nokia5110::init()
         this->_lastError = Error::GPIO_PORT_NOT_SET;
         return false;
     }
-    // Checks for errors - Buffer not allocated
-    if(!isPointerValid(this->_data)) {
-        // Returns error
-        this->_lastError = Error::MEMORY_ALLOCATION_FAILED;
-        return false;
-    }
 
     // Configures ports
-    setBit(*(this->_controlDdr), this->_dataIn);
+    if(!isPointerValid(this->_bus)) {
+        setBit(*(this->_controlDdr), this->_dataIn);
+        setBit(*(this->_controlDdr), this->_clock);
+    }
     setBit(*(this->_controlDdr), this->_chipSelect);
-    setBit(*(this->_controlDdr), this->_clock);
     setBit(*(this->_controlDdr), this->_dc);
     if(this->_reset != 0xFF) {
         setBit(*(this->_controlDdr), this->_reset);
@@ -129,6 +137,9 @@ bool_t Nokia5110::init()
     // Updates data members
     this->_initialized = true;
 
+    // LCD RAM is blank now, so the whole buffer must be sent at next render
+    this->invalidateBuffer();
+
     // Returns successfully
     this->_lastError = Error::NONE;
     return true;
@@ -147,13 +158,27 @@ bool_t Nokia5110::clearBuffer(void)
     this->_posX = 0;
     this->_posY = 0;
 
-    // Moves to position (0,0)
-    this->_write(0x80, false);
-    this->_write(0x40, false);
+    // Clears everything, marking only the columns that were not blank
+    for(uint8_t bank = 0; bank < constNokia5110Banks; bank++) {
+        uint8_t *auxData = &this->_data[bank * constNokia5110Width];
+        for(uint8_t column = 0; column < constNokia5110Width; column++) {
+            if(auxData[column]) {
+                auxData[column] = 0x00;
+                this->_markDirty(bank, column, column);
+            }
+        }
+    }
 
-    /* Clear everything (504 bytes = 84cols * 48 rows / 8 bits) */
-    for(uint16_t i = 0; i < 504; i++) {
-        this->_data[i] = 0x00;
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+bool_t Nokia5110::invalidateBuffer(void)
+{
+    // Marks the whole buffer to be sent at next render
+    for(uint8_t bank = 0; bank < constNokia5110Banks; bank++) {
+        this->_markDirty(bank, 0, constNokia5110Width - 1);
     }
 
     // Returns successfully
@@ -170,13 +195,27 @@ bool_t Nokia5110::renderBuffer(void)
         return false;
     }
 
-    // Moves to position (0,0)
-    this->_write(0x80, false);
-    this->_write(0x40, false);
+    // Sends only the dirty column range of each bank
+    for(uint8_t bank = 0; bank < constNokia5110Banks; bank++) {
+        uint8_t first = this->_dirtyFirst[bank];
+        if(first == 0xFF) {
+            continue;                           // Clean bank
+        }
 
-    /* Clear everything (504 bytes = 84cols * 48 rows / 8 bits) */
-    for(uint16_t i = 0; i < 504; i++) {
-        this->_write(this->_data[i], true);
+        // Moves to position (first, bank)
+        this->_write(0x80 | first, false);
+        this->_write(0x40 | bank, false);
+
+        // Sends the column range
+        if(!this->_writeBlock(&this->_data[bank * constNokia5110Width + first],
+                        this->_dirtyLast[bank] - first + 1)) {
+            // Returns error
+            return false;
+        }
+
+        // Marks the bank as clean
+        this->_dirtyFirst[bank] = 0xFF;
+        this->_dirtyLast[bank] = 0;
     }
 
     // Returns successfully
@@ -193,15 +232,17 @@ bool_t Nokia5110::drawPixel(cuint8_t posX_p, cuint8_t posY_p, cbool_t turnOn_p)
         return false;
     }
 
-    // Decodes pixel position
-    uint8_t auxByte = this->_data[(posY_p / 8) * 84 + posX_p];
+    // Checks for errors - Out of screen
+    if((posX_p >= constNokia5110Width) || (posY_p >= (constNokia5110Banks * 8))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        return false;
+    }
 
-    if(turnOn_p) {
-        setBit(auxByte, (posY_p % 8));
-    } else {
-        clrBit(auxByte, (posY_p % 8));
+    // Decodes pixel position
+    if(this->_applyByte((posY_p >> 3), posX_p, (1 << (posY_p & 0x07)), turnOn_p)) {
+        this->_markDirty((posY_p >> 3), posX_p, posX_p);
     }
-    this->_data[(posY_p / 8) * 84 + posX_p] = auxByte;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -223,6 +264,13 @@ void Nokia5110::_write(uint8_t data_p, bool_t isData_p)
         clrBit(*(this->_controlPort), this->_dc);
     }
 
+    // Sends through the bus, if set
+    if(isPointerValid(this->_bus)) {
+        this->_bus->write(&data_p, 1);
+        setBit(*(this->_controlPort), this->_chipSelect);
+        return;
+    }
+
     // Sends data bits
     for(uint8_t i = 0; i < 8; i++) {
         if((data_p >> (7 - i)) & 0x01) {
@@ -237,24 +285,79 @@ void Nokia5110::_write(uint8_t data_p, bool_t isData_p)
     setBit(*(this->_controlPort), this->_chipSelect);
 }
 
-bool_t Nokia5110::drawLineVertical(cuint8_t posX_p, cuint8_t posY_p, cuint8_t length_p, cbool_t turnOn_p)
+bool_t Nokia5110::_writeBlock(uint8_t *data_p, cuint8_t size_p)
 {
-    // Checks for errors - Not initialized
-    if(!this->_initialized) {
+    // Bit-banging fallback
+    if(!isPointerValid(this->_bus)) {
+        for(uint8_t i = 0; i < size_p; i++) {
+            this->_write(data_p[i], true);
+        }
+        return true;
+    }
+
+    // Sends the whole block in a single bus transfer
+    clrBit(*(this->_controlPort), this->_chipSelect);
+    setBit(*(this->_controlPort), this->_dc);
+    if(!this->_bus->write(data_p, size_p)) {
+        setBit(*(this->_controlPort), this->_chipSelect);
         // Returns error
-        this->_lastError = Error::NOT_INITIALIZED;
+        this->_lastError = this->_bus->getLastError();
         return false;
     }
+    setBit(*(this->_controlPort), this->_chipSelect);
 
-    for(uint8_t i = 0; i < length_p; i++) {
-        this->drawPixel(posX_p, (posY_p + i), turnOn_p);
+    return true;
+}
+
+void Nokia5110::_markDirty(cuint8_t bank_p, cuint8_t firstColumn_p, cuint8_t lastColumn_p)
+{
+    // Grows the dirty column range of the bank
+    if(firstColumn_p < this->_dirtyFirst[bank_p]) {
+        this->_dirtyFirst[bank_p] = firstColumn_p;
     }
+    if(lastColumn_p > this->_dirtyLast[bank_p]) {
+        this->_dirtyLast[bank_p] = lastColumn_p;
+    }
+}
 
-    // Returns successfully
-    this->_lastError = Error::NONE;
+bool_t Nokia5110::_applyByte(cuint8_t bank_p, cuint8_t column_p, cuint8_t mask_p, cbool_t turnOn_p)
+{
+    // Sets or clears the masked bits, returning true if the byte changed
+    uint8_t *auxData = &this->_data[bank_p * constNokia5110Width + column_p];
+    uint8_t auxByte = turnOn_p ? (*auxData | mask_p) : (*auxData & ~mask_p);
+
+    if(auxByte == *auxData) {
+        return false;
+    }
+    *auxData = auxByte;
     return true;
 }
-bool_t Nokia5110::drawLineHorizontal(cuint8_t posX_p, cuint8_t posY_p, cuint8_t length_p, cbool_t turnOn_p)
+
+void Nokia5110::_blitByte(int16_t posX_p, int16_t posY_p, uint8_t bits_p, cbool_t turnOn_p)
+{
+    // Clips column
+    if((posX_p < 0) || (posX_p >= constNokia5110Width) || (!bits_p)) {
+        return;
+    }
+
+    // A byte at any row touches at most two banks
+    uint8_t shift = posY_p & 0x07;
+    int16_t bank = (posY_p - shift) / 8;
+
+    if((bank >= 0) && (bank < constNokia5110Banks)) {
+        if(this->_applyByte(bank, posX_p, (uint8_t)(bits_p << shift), turnOn_p)) {
+            this->_markDirty(bank, posX_p, posX_p);
+        }
+    }
+    bank++;
+    if((shift) && (bank >= 0) && (bank < constNokia5110Banks)) {
+        if(this->_applyByte(bank, posX_p, (uint8_t)(bits_p >> (8 - shift)), turnOn_p)) {
+            this->_markDirty(bank, posX_p, posX_p);
+        }
+    }
+}
+
+bool_t Nokia5110::drawLineVertical(cuint8_t posX_p, cuint8_t posY_p, cuint8_t length_p, cbool_t turnOn_p)
 {
     // Checks for errors - Not initialized
     if(!this->_initialized) {
@@ -263,13 +366,20 @@ bool_t Nokia5110::drawLineHorizontal(cuint8_t posX_p, cuint8_t posY_p, cuint8_t
         return false;
     }
 
-    for(uint8_t i = 0; i < length_p; i++) {
-        this->drawPixel((posX_p + i), posY_p, turnOn_p);
+    // Returns
+    return this->fillRectangle(posX_p, posY_p, 1, length_p, turnOn_p);
+}
+bool_t Nokia5110::drawLineHorizontal(cuint8_t posX_p, cuint8_t posY_p, cuint8_t length_p, cbool_t turnOn_p)
+{
+    // Checks for errors - Not initialized
+    if(!this->_initialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
     }
 
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    return true;
+    // Returns
+    return this->fillRectangle(posX_p, posY_p, length_p, 1, turnOn_p);
 }
 
 bool_t Nokia5110::drawLine(uint8_t posX1_p, uint8_t posY1_p, uint8_t posX2_p, uint8_t posY2_p, cbool_t turnOn_p)
@@ -411,11 +521,11 @@ bool_t Nokia5110::drawLine(uint8_t posX1_p, uint8_t posY1_p, uint8_t posX2_p, ui
 
 bool_t Nokia5110::drawRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p, cbool_t turnOn_p)
 {
-    // Desenha as quatro linhas do retângulo usando a função drawLine
-    this->drawLine(posX_p, posY_p, posX_p + width_p, posY_p, turnOn_p);                        // Linha superior
-    this->drawLine(posX_p, posY_p, posX_p, posY_p + height_p, turnOn_p);                       // Linha esquerda
-    this->drawLine(posX_p + width_p, posY_p, posX_p + width_p, posY_p + height_p, turnOn_p);   // Linha direita
-    this->drawLine(posX_p, posY_p + height_p, posX_p + width_p, posY_p + height_p, turnOn_p);  // Linha inferior
+    // Desenha as quatro linhas do retângulo como spans (extremidades inclusivas)
+    this->fillRectangle(posX_p, posY_p, width_p + 1, 1, turnOn_p);                 // Linha superior
+    this->fillRectangle(posX_p, posY_p, 1, height_p + 1, turnOn_p);                // Linha esquerda
+    this->fillRectangle(posX_p + width_p, posY_p, 1, height_p + 1, turnOn_p);      // Linha direita
+    this->fillRectangle(posX_p, posY_p + height_p, width_p + 1, 1, turnOn_p);      // Linha inferior
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -425,9 +535,106 @@ bool_t Nokia5110::drawRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p,
 bool_t Nokia5110::drawAndFillRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p,
         cbool_t turnOn_p)
 {
-    // Desenha as linhas do retângulo e preenche o interior usando a função drawLine
-    for(uint8_t i = posY_p; i < posY_p + height_p; i++) {
-        this->drawLine(posX_p, i, posX_p + width_p, i, turnOn_p);  // Desenha a linha e liga o preenchimento
+    // Preenche o retângulo (largura inclusiva, como nas linhas de drawLine)
+    return this->fillRectangle(posX_p, posY_p, width_p + 1, height_p, turnOn_p);
+}
+
+bool_t Nokia5110::fillRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p, cbool_t turnOn_p)
+{
+    // Checks for errors - Not initialized
+    if(!this->_initialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
+    }
+
+    // Clips to the screen
+    if((posX_p >= constNokia5110Width) || (posY_p >= (constNokia5110Banks * 8)) || (!width_p) || (!height_p)) {
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        return true;
+    }
+    if(width_p > (constNokia5110Width - posX_p)) {
+        width_p = constNokia5110Width - posX_p;
+    }
+    if(height_p > ((constNokia5110Banks * 8) - posY_p)) {
+        height_p = (constNokia5110Banks * 8) - posY_p;
+    }
+
+    // Fills bank by bank, with the row mask computed once per bank
+    uint8_t lastRow = posY_p + height_p - 1;
+    uint8_t lastBank = lastRow >> 3;
+    for(uint8_t bank = (posY_p >> 3); bank <= lastBank; bank++) {
+        uint8_t mask = 0xFF;
+        uint8_t first = 0xFF;
+        uint8_t last = 0;
+
+        if(bank == (posY_p >> 3)) {
+            mask &= (uint8_t)(0xFF << (posY_p & 0x07));
+        }
+        if(bank == lastBank) {
+            mask &= (uint8_t)(0xFF >> (7 - (lastRow & 0x07)));
+        }
+        for(uint8_t column = posX_p; column < (posX_p + width_p); column++) {
+            if(this->_applyByte(bank, column, mask, turnOn_p)) {
+                if(first == 0xFF) {
+                    first = column;
+                }
+                last = column;
+            }
+        }
+        if(first != 0xFF) {
+            this->_markDirty(bank, first, last);
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+bool_t Nokia5110::drawBitmap(const uint8_t *bitmap_p, int16_t posX_p, int16_t posY_p, uint8_t width_p,
+        uint8_t height_p, cbool_t turnOn_p)
+{
+    // Checks for errors - Not initialized
+    if(!this->_initialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
+    }
+    // Checks for errors - Invalid bitmap
+    if(!isPointerValid(bitmap_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        return false;
+    }
+
+    // Bitmap in PROGMEM, in the display layout: (height + 7) / 8 banks of
+    //      width bytes, bit 0 at the top. Set bits are drawn (turnOn_p) or
+    //      erased (!turnOn_p); cleared bits leave the buffer untouched.
+    for(uint8_t sourceBank = 0; (sourceBank * 8) < height_p; sourceBank++) {
+        int16_t auxY = posY_p + (sourceBank * 8);
+        uint8_t rows = height_p - (sourceBank * 8);
+        uint8_t rowMask = (rows < 8) ? (uint8_t)((1 << rows) - 1) : 0xFF;
+
+        // Clips rows
+        if((auxY <= -8) || (auxY >= (constNokia5110Banks * 8))) {
+            continue;
+        }
+
+        const uint8_t *auxBitmap = &bitmap_p[sourceBank * width_p];
+        for(uint8_t column = 0; column < width_p; column++) {
+            int16_t auxX = posX_p + column;
+
+            // Clips columns
+            if(auxX < 0) {
+                continue;
+            }
+            if(auxX >= constNokia5110Width) {
+                break;
+            }
+            this->_blitByte(auxX, auxY, (pgm_read_byte(&auxBitmap[column]) & rowMask), turnOn_p);
+        }
     }
 
     // Returns successfully
@@ -467,14 +674,31 @@ bool_t Nokia5110::drawCircle(uint8_t centerX_p, uint8_t centerY_p, uint8_t radiu
 
 bool_t Nokia5110::drawChar(char_t code_p, uint8_t scale_p)
 {
-    uint8_t x, y;
-
-    for(x = 0; x < 5 * scale_p; x++) {
-        for(y = 0; y < 7 * scale_p; y++) {
-            if(pgm_read_byte(&CHARSET[code_p - 32][x / scale_p]) & (1 << y / scale_p)) {
-                this->drawPixel(this->_posX + x, this->_posY + y, true);
-            } else {
-                this->drawPixel(this->_posX + x, this->_posY + y, false);
+    // Clears the character cell
+    this->fillRectangle(this->_posX, this->_posY, 5 * scale_p, 7 * scale_p, false);
+
+    if(scale_p == 1) {
+        // Glyph columns are already in the display layout
+        this->drawBitmap(CHARSET[code_p - 32], this->_posX, this->_posY, 5, 7, true);
+    } else {
+        // Each vertical run of set bits becomes a single scaled block
+        for(uint8_t x = 0; x < 5; x++) {
+            uint8_t bits = pgm_read_byte(&CHARSET[code_p - 32][x]);
+            uint8_t y = 0;
+
+            while(bits) {
+                if(!(bits & 0x01)) {
+                    bits >>= 1;
+                    y++;
+                    continue;
+                }
+                uint8_t run = 0;
+                while(bits & 0x01) {
+                    bits >>= 1;
+                    run++;
+                }
+                this->fillRectangle(this->_posX + x * scale_p, this->_posY + y * scale_p, scale_p, run * scale_p, true);
+                y += run;
             }
         }
     }
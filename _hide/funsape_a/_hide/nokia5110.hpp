@@ -3,9 +3,14 @@
 #define __NOKIA_5110_HPP
 
 #include "funsape/globalDefines.hpp"
+#include "funsape/util/bus.hpp"
 
 #define LCD_CONTRAST 0x40
 
+cuint8_t constNokia5110Width            = 84;       //!< Columns
+cuint8_t constNokia5110Banks            = 6;        //!< Banks of 8 rows
+cuint16_t constNokia5110BufferSize      = 504;      //!< Framebuffer size (84 x 48 / 8)
+
 
 class Nokia5110
 {
@@ -20,8 +25,10 @@ public:
             ioPinIndex_t dataCommandPinIndex_p,
             ioPinIndex_t resetPinIndex_p        = 0xFF
     );
+    bool_t setBus(Bus *bus_p);
     bool_t init(void);
     bool_t clearBuffer(void);
+    bool_t invalidateBuffer(void);
     bool_t renderBuffer(void);
     bool_t drawPixel(cuint8_t posX_p, cuint8_t posY_p, cbool_t turnOn_p = true);
     bool_t drawLine(uint8_t posX1_p, uint8_t posY1_p, uint8_t posX2_p, uint8_t posY2_p, cbool_t turnOn_p = true);
@@ -31,6 +38,9 @@ public:
     bool_t drawCircle(uint8_t centerX_p, uint8_t centerY_p, uint8_t radius_p, cbool_t turnOn_p);
     bool_t drawAndFillRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p, cbool_t turnOn_p);
     bool_t drawRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p, cbool_t turnOn_p);
+    bool_t fillRectangle(uint8_t posX_p, uint8_t posY_p, uint8_t width_p, uint8_t height_p, cbool_t turnOn_p = true);
+    bool_t drawBitmap(const uint8_t *bitmap_p, int16_t posX_p, int16_t posY_p, uint8_t width_p, uint8_t height_p,
+            cbool_t turnOn_p = true);
     bool_t setCursorPosition(uint8_t posX_p, uint8_t posY_p);
     bool_t drawChar(char_t code_p, uint8_t scale_p);
     bool_t drawString(cchar_t *string_p, uint8_t scale_p, uint8_t posX_p, uint8_t posY_p);
@@ -44,6 +54,10 @@ public:
 
 private:
     void _write(uint8_t data_p, bool_t isData_p);
+    bool_t _writeBlock(uint8_t *data_p, cuint8_t size_p);
+    void _markDirty(cuint8_t bank_p, cuint8_t firstColumn_p, cuint8_t lastColumn_p);
+    bool_t _applyByte(cuint8_t bank_p, cuint8_t column_p, cuint8_t mask_p, cbool_t turnOn_p);
+    void _blitByte(int16_t posX_p, int16_t posY_p, uint8_t bits_p, cbool_t turnOn_p);
 
     Error           _lastError;
     bool_t          _initialized        : 1;
@@ -55,7 +69,10 @@ private:
     ioPinIndex_t    _clock;
     ioPinIndex_t    _dc;
     ioPinIndex_t    _reset;
-    uint8_t         *_data;
+    Bus             *_bus;
+    uint8_t         _data[constNokia5110BufferSize];
+    uint8_t         _dirtyFirst[constNokia5110Banks];   // 0xFF if the bank is clean
+    uint8_t         _dirtyLast[constNokia5110Banks];
     uint8_t         _posX;
     uint8_t         _posY;
 };
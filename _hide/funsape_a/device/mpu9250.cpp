@@ -18,6 +18,7 @@ static cuint8_t constNormalSlaveAddress = 0x68;
 static cuint8_t constAlternateSlaveAddress = 0x69;
 static cuint8_t constDeviceId = 0x71;
 static cuint8_t constResetDelay = 50;
+static cuint8_t constFifoFrameSize = 14;        // Accel (6), temp (2) and gyro (6)
 
 // =============================================================================
 // File exclusive - New data types
@@ -50,8 +51,18 @@ enum class Bit : uint8_t {
     FSYNC_LEVEL                      = 3,
     FSYNC_MODE_EN                    = 2,
     BYPASS_EN                        = 1,
+    CONFIG_FIFO_MODE                 = 6,
+    FIFO_EN_TEMP_OUT                 = 7,
+    FIFO_EN_GYRO_XOUT                = 6,
+    FIFO_EN_GYRO_YOUT                = 5,
+    FIFO_EN_GYRO_ZOUT                = 4,
+    FIFO_EN_ACCEL                    = 3,
+    USER_CTRL_FIFO_EN                = 6,
+    USER_CTRL_FIFO_RST               = 2,
+    INT_ENABLE_FIFO_OFLOW_EN         = 4,
+    INT_ENABLE_RAW_RDY_EN            = 0,
+    INT_STATUS_FIFO_OFLOW            = 4,
 
-    // CONFIG_FIFO_MODE             = 6,
     // CONFIG_EXT_SYNC_SET_0            = 3,
     // I2C_SLV0_EN                      = 7,
     // I2C_SLV0_BYTE_SW             = 6,
@@ -80,10 +91,8 @@ enum class Bit : uint8_t {
     // SIG_PAT_RST_GYRO             = 2,
     // SIG_PAT_RST_ACCEL                = 1,
     // SIG_PAT_RST_TEMP             = 0,
-    // USR_CONTROLFIFO_EN               = 6,
     // USR_CONTROLI2C_MST_EN            = 5,
     // USR_CONTROLI2C_IF_DIS            = 4,
-    // USR_CONTROLFIFO_RST              = 2,
     // USR_CONTROLI2C_MST_RST           = 1,
     // USR_CONTROLSIG_COND_RST          = 0,
     // PWR_MGMT_1_SLEEP             = 6,
@@ -92,11 +101,8 @@ enum class Bit : uint8_t {
     // PWR_MGMT_1_PD_PTAT               = 3,
     // PWR_MGMT_1_CLKSEL_0              = 0,
     // WAKE_ON_MOTION_EN                = 6,
-    // FIFO_OVERFLOW_EN             = 4,
     // FSYNC_INT_EN                 = 3,
-    // RAW_DATA_READY_EN                = 0,
     // INT_STATUS_WOM                   = 6,
-    // INT_STATUS_FIFO_OVERFLOW     = 4,
     // INT_STATUS_FSYNC             = 3,
     // INT_STATUS_RAW_DATA_RDY          = 0,
 };
@@ -111,7 +117,7 @@ enum class Bit : uint8_t {
 // Global variables
 // =============================================================================
 
-// NONE
+static uint8_t fifoBurstBuffer[MPU9250_FIFO_BURST_SIZE];   // Shared by all instances
 
 // =============================================================================
 // Static functions declarations
@@ -135,6 +141,8 @@ Mpu9250::Mpu9250(void)
     debugMark(PSTR("Mpu9250::Mpu9250(void)"), Debug::CodeIndex::MPU9250_MODULE);
 
     // Resets data members
+    this->_fifoEnabled = false;
+    this->_fifoOverflowCount = 0;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -286,6 +294,7 @@ bool_t Mpu9250::restart(void)
 
     // Wait until reset takes
     delayMs(constResetDelay);
+    this->_fifoEnabled = false;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -1209,6 +1218,239 @@ bool_t Mpu9250::setIntPinMode(const LogicLevel activeLevel_p, const DriverMode d
     return true;
 }
 
+bool_t Mpu9250::startFifo(const GyroConfig config_p, cuint8_t sampleRateDivider_p)
+{
+    // Local variables
+    uint8_t auxBuff[3] = {0, 0, 0};
+
+    // Check for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Stops FIFO while reconfiguring
+    if(!this->stopFifo()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Read registers
+    if(!this->_read(Register::CONFIG, &auxBuff[1], 2)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Process arguments (SMPLRT_DIV, CONFIG and GYRO_CONFIG). The FIFO stops
+    // when full, so that the frames are never overwritten out of alignment.
+    // The sample rate divider only applies to the 1 kHz configurations.
+    auxBuff[0] = sampleRateDivider_p;
+    auxBuff[1] &= 0x38;                                 // Keeps EXT_SYNC_SET
+    auxBuff[1] |= (1 << (uint8_t)Bit::CONFIG_FIFO_MODE);
+    auxBuff[1] |= ((uint8_t)config_p & 0x07) << (uint8_t)Bit::CONFIG_GYRO_DLPF_CFG_0;
+    auxBuff[2] &= 0x18;                                 // Keeps GYRO_FS_SEL
+    auxBuff[2] |= ((uint8_t)config_p >> 3) << (uint8_t)Bit::GYRO_CONFIG_FCHOICE_B_0;
+
+    // Writes configuration
+    if(!this->_write(Register::SMPLRT_DIV, auxBuff, 3)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Selects the frame contents, in register order
+    auxBuff[0] = (1 << (uint8_t)Bit::FIFO_EN_TEMP_OUT) |
+            (1 << (uint8_t)Bit::FIFO_EN_GYRO_XOUT) |
+            (1 << (uint8_t)Bit::FIFO_EN_GYRO_YOUT) |
+            (1 << (uint8_t)Bit::FIFO_EN_GYRO_ZOUT) |
+            (1 << (uint8_t)Bit::FIFO_EN_ACCEL);
+    if(!this->_write(Register::FIFO_EN, auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Enables and resets the FIFO
+    if(!this->_read(Register::USER_CTRL, auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    setBit(auxBuff[0], (uint8_t)Bit::USER_CTRL_FIFO_EN);
+    setBit(auxBuff[0], (uint8_t)Bit::USER_CTRL_FIFO_RST);
+    if(!this->_write(Register::USER_CTRL, auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Enables data ready and FIFO overflow interrupts
+    auxBuff[0] = (1 << (uint8_t)Bit::INT_ENABLE_RAW_RDY_EN) | (1 << (uint8_t)Bit::INT_ENABLE_FIFO_OFLOW_EN);
+    if(!this->_write(Register::INT_ENABLE, auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    this->_gyroFChoiceB = (uint8_t)config_p >> 3;
+    this->_fifoEnabled = true;
+    this->_fifoOverflowCount = 0;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MPU9250_MODULE);
+    return true;
+}
+
+bool_t Mpu9250::stopFifo(void)
+{
+    // Local variables
+    uint8_t auxBuff = 0;
+
+    // Check for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Disables interrupts and frame contents
+    if(!this->_write(Register::INT_ENABLE, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    if(!this->_write(Register::FIFO_EN, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Disables the FIFO
+    if(!this->_read(Register::USER_CTRL, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    clrBit(auxBuff, (uint8_t)Bit::USER_CTRL_FIFO_EN);
+    if(!this->_write(Register::USER_CTRL, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    this->_fifoEnabled = false;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MPU9250_MODULE);
+    return true;
+}
+
+bool_t Mpu9250::readFifo(FifoSamples *samples_p, cuint8_t maxFrames_p, uint8_t *frames_p)
+{
+    // Local variables
+    uint8_t auxBuff[2] = {0, 0};
+    int16_t *channels[7];
+    uint8_t *frame = nullptr;
+    uint16_t available = 0;
+    uint8_t frames = 0;
+    uint8_t burstFrames = 0;
+    uint8_t index = 0;
+    bool_t overflow = false;
+
+    // Check for errors
+    if(!this->_isInitialized || !this->_fifoEnabled) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    if(!isPointerValid(samples_p) || !isPointerValid(frames_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Updates arguments
+    *frames_p = 0;
+
+    // Read interrupt status (also releases a latched INT pin)
+    if(!this->_read(Register::INT_STATUS, auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    overflow = isBitSet(auxBuff[0], (uint8_t)Bit::INT_STATUS_FIFO_OFLOW);
+
+    // Read FIFO count
+    if(!this->_read(Register::FIFO_COUNTH, auxBuff, 2)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+    available = ((uint16_t)(auxBuff[0] & 0x1F) << 8) | auxBuff[1];
+    available /= constFifoFrameSize;
+    frames = (available > maxFrames_p) ? maxFrames_p : (uint8_t)available;
+
+    // Destination arrays, in frame order
+    channels[0] = samples_p->accelX;
+    channels[1] = samples_p->accelY;
+    channels[2] = samples_p->accelZ;
+    channels[3] = samples_p->temp;
+    channels[4] = samples_p->gyroX;
+    channels[5] = samples_p->gyroY;
+    channels[6] = samples_p->gyroZ;
+
+    // Read frames, as many as fit in each burst
+    while(index < frames) {
+        burstFrames = frames - index;
+        if(burstFrames > (MPU9250_FIFO_BURST_SIZE / constFifoFrameSize)) {
+            burstFrames = MPU9250_FIFO_BURST_SIZE / constFifoFrameSize;
+        }
+        if(!this->_read(Register::FIFO_R_W, fifoBurstBuffer, burstFrames * constFifoFrameSize)) {
+            // Returns error
+            *frames_p = index;
+            debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+            return false;
+        }
+
+        // Process data
+        frame = fifoBurstBuffer;
+        for(; burstFrames > 0; burstFrames--, index++) {
+            for(uint8_t i = 0; i < 7; i++, frame += 2) {
+                if(isPointerValid(channels[i])) {
+                    channels[i][index] = (int16_t)(((uint16_t)frame[0] << 8) | frame[1]);
+                }
+            }
+        }
+    }
+    *frames_p = frames;
+
+    // After an overflow the FIFO may end in a partial frame, so it is reset
+    if(overflow) {
+        this->_fifoOverflowCount++;
+        if(!this->_resetFifo()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+            return false;
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MPU9250_MODULE);
+    return true;
+}
+
 bool_t Mpu9250::enableIntPin(const LogicLevel activeLevel_p, const DriverMode driverMode_p,
         const CleanMode cleanMode_p)
 {
@@ -1332,6 +1574,82 @@ bool_t Mpu9250::_initialize(void)
     return true;
 }
 
+bool_t Mpu9250::_resetFifo(void)
+{
+    // Local variables
+    uint8_t auxBuff = 0;
+
+    // Read register
+    if(!this->_read(Register::USER_CTRL, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Writes configuration (FIFO_RST is cleared by the device)
+    setBit(auxBuff, (uint8_t)Bit::USER_CTRL_FIFO_RST);
+    if(!this->_write(Register::USER_CTRL, &auxBuff, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MPU9250_MODULE);
+    return true;
+}
+
+bool_t Mpu9250::_read(const Register regAddress_p, uint8_t *buffData_p, cuint8_t bytesToRead_p)
+{
+    // Local variables
+    bool_t result = false;
+
+    // Read registers
+    if(this->_useSpi) {
+        this->_activateDevice();
+        result = this->_busHandler->readReg((uint8_t)regAddress_p | 0x80, buffData_p, bytesToRead_p);
+        this->_deactivateDevice();
+    } else if(this->_busHandler->setDevice(this->_i2cAddress)) {
+        result = this->_busHandler->readReg((uint8_t)regAddress_p, buffData_p, bytesToRead_p);
+    }
+    if(!result) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+bool_t Mpu9250::_write(const Register regAddress_p, cuint8_t *buffData_p, cuint8_t bytesToWrite_p)
+{
+    // Local variables
+    bool_t result = false;
+
+    // Write registers
+    if(this->_useSpi) {
+        this->_activateDevice();
+        result = this->_busHandler->writeReg((uint8_t)regAddress_p, buffData_p, bytesToWrite_p);
+        this->_deactivateDevice();
+    } else if(this->_busHandler->setDevice(this->_i2cAddress)) {
+        result = this->_busHandler->writeReg((uint8_t)regAddress_p, buffData_p, bytesToWrite_p);
+    }
+    if(!result) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::MPU9250_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
 // =============================================================================
 // Class own methods - Protected
 // =============================================================================
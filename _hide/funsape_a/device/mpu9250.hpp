@@ -48,7 +48,22 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef MPU9250_FIFO_BURST_SIZE
+//!
+//! \brief          Mpu9250 FIFO burst size
+//! \details        Size in bytes of the static buffer used to drain the FIFO.
+//!                     Each burst is a single bus transaction holding a whole
+//!                     number of 14-byte frames. The default value fits in the
+//!                     TWI buffer (TWI_BUFFER_SIZE), larger bursts are rejected
+//!                     by Twi::readReg(); over SPI it can be raised up to 252.
+//!
+#   define MPU9250_FIFO_BURST_SIZE      28
+#endif
+#if (MPU9250_FIFO_BURST_SIZE % 14) != 0
+#   error "MPU9250_FIFO_BURST_SIZE must be a multiple of 14!"
+#elif MPU9250_FIFO_BURST_SIZE > 252
+#   error "MPU9250_FIFO_BURST_SIZE must not exceed 252!"
+#endif
 
 // =============================================================================
 // New data types
@@ -139,6 +154,17 @@ public:
         LATCHED_ANY_READ    = 2,
     };
 
+    // Destination arrays for readFifo(); a nullptr skips the channel
+    struct FifoSamples {
+        int16_t *accelX;
+        int16_t *accelY;
+        int16_t *accelZ;
+        int16_t *temp;
+        int16_t *gyroX;
+        int16_t *gyroY;
+        int16_t *gyroZ;
+    };
+
 private:
     enum class Register {
         SELF_TEST_X_GYRO    = 0x00,
@@ -317,6 +343,20 @@ public:
 
     bool_t getExtSensData(uint8_t *buffData_p, cuint8_t firstSensor_p = 0, cuint8_t totalSensors_p = 24);
 
+    bool_t startFifo(
+            const GyroConfig config_p           = GyroConfig::FREQ_1_KHZ_FILTER_FREQ_184_HZ,
+            cuint8_t sampleRateDivider_p        = 0
+    );
+    bool_t stopFifo(
+            void
+    );
+    bool_t readFifo(
+            FifoSamples *samples_p,
+            cuint8_t maxFrames_p,
+            uint8_t *frames_p
+    );
+    inlined uint16_t getFifoOverflowCount(void);
+
 
 //     /////////////////     CONTROL AND STATUS     /////////////////     //
 
@@ -324,6 +364,7 @@ private:
     bool_t _read(const Register regAddress_p, uint8_t *buffData_p, cuint8_t bytesToRead_p);
     bool_t _write(const Register regAddress_p, cuint8_t *buffData_p, cuint8_t bytesToWrite_p);
     bool_t _initialize(void);
+    bool_t _resetFifo(void);
 
 protected:
     // NONE
@@ -355,6 +396,8 @@ private:
     LogicLevel _fsyncPinActiveLevel;
     LogicLevel _intPinActiveLevel;
     DriverMode _intPinDriverMode;
+    bool_t _fifoEnabled : 1;
+    uint16_t _fifoOverflowCount;
 
     // bool_t _intFsyncFlag : 1;
     // bool_t _intPinActiveLevel : 1;
@@ -469,7 +512,6 @@ private:
     // uint8_t _i2cSlave4DataIn;
     // uint8_t _i2cSlave4MasterDelay : 5;
     // bool_t _resetFifo : 1;
-    // bool_t _fifoEnabled : 1;
     // bool_t _fifoMode : 1;
     // bool_t _fifoResetStrobe : 1;
     // bool_t _fifoSlave0Store : 1;
@@ -502,6 +544,12 @@ inlined Error Mpu9250::getLastError(void)
     return this->_lastError;
 }
 
+inlined uint16_t Mpu9250::getFifoOverflowCount(void)
+{
+    // Returns the number of FIFO overflows since startFifo()
+    return this->_fifoOverflowCount;
+}
+
 // =============================================================================
 // External global variables
 // =============================================================================
@@ -0,0 +1,288 @@
+/**
+ *******************************************************************************
+ * @file            sn74595.cpp
+ * @author          Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+ * @brief           SN74595 serial shift register interface for the FunSAPE++
+ *                      AVR8 Library.
+ * @details         SN74595 serial shift register interface for the FunSAPE++
+ *                      AVR8 Library.
+ * @date            2025-08-08
+ * @version         25.08
+ * @copyright       MIT License
+ * @note            No notes at this time.
+ * @todo            No itens in todo list yet.
+ * @bug             No bugs detected yet.
+ *
+ *******************************************************************************
+ * @attention
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Leandro Schwarz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to
+ *      deal in the Software without restriction, including without limitation
+ *      the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *      and/or sell copies of the Software, and to permit persons to whom the
+ *      Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ *      all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *      THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *      OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *      ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *      OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+*/
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "sn74595.hpp"
+#if !defined(__SN74595_HPP)
+#    error Error 1 - Header file (sn74595.hpp) is missing or corrupted!
+#elif __SN74595_HPP != 2508
+#    error Error 6 - Build mismatch between header file (sn74595.hpp) and source file (sn74595.cpp)!
+#endif
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public function definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+Sn74595::Sn74595(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::Sn74595(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // Resets data members
+    this->_clear                        = nullptr;
+    this->_dataIn                       = nullptr;
+    this->_outputEnable                 = nullptr;
+    this->_shift                        = nullptr;
+    this->_store                        = nullptr;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return;
+}
+
+Sn74595::~Sn74595(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::~Sn74595(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // Returns successfully
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return;
+}
+
+// =============================================================================
+// Class own methods - Public
+// =============================================================================
+
+//     ///////////////////     CONTROL AND STATUS     ///////////////////     //
+
+bool_t Sn74595::setPort(const GpioPin *dataInPin_p, const GpioPin *shiftClockPin_p, const GpioPin *storeClockPin_p,
+        const GpioPin *outputEnablePin_p, const GpioPin *masterResetPin_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::setPort(const GpioPin *, const GpioPin *, const GpioPin *, const GpioPin *, const GpioPin *)"),
+            Debug::CodeIndex::SN74595_MODULE);
+
+    // Resets data members
+    this->_clear                        = nullptr;
+    this->_dataIn                       = nullptr;
+    this->_isInitialized                = false;
+    this->_isPortsSet                   = false;
+    this->_outputEnable                 = nullptr;
+    this->_shift                        = nullptr;
+    this->_store                        = nullptr;
+
+    // CHECK FOR ERROR - ports not set
+    if((!isPointerValid(dataInPin_p)) || (!isPointerValid(shiftClockPin_p)) || (!isPointerValid(storeClockPin_p))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    this->_clear                        = (GpioPin *)masterResetPin_p;
+    this->_dataIn                       = (GpioPin *)dataInPin_p;
+    this->_isPortsSet                   = true;
+    this->_outputEnable                 = (GpioPin *)outputEnablePin_p;
+    this->_shift                        = (GpioPin *)shiftClockPin_p;
+    this->_store                        = (GpioPin *)storeClockPin_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+// =============================================================================
+// Class own methods - Private
+// =============================================================================
+
+//     ///////////////////    PIN RELATED METHODS     ///////////////////     //
+
+void Sn74595::_initPins(void)
+{
+    // Configure clear pin
+    if(isPointerValid(this->_clear)) {
+        this->_clear->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        this->_clear->low();
+    }
+
+    // Configure output enable pin
+    if(isPointerValid(this->_outputEnable)) {
+        this->_outputEnable->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        this->_outputEnable->high();
+    }
+
+    // Configure data in pin
+    this->_dataIn->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_dataIn->low();
+
+    // Configure shift clock pin
+    this->_shift->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_shift->low();
+
+    // Configure store clock pin
+    this->_store->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_store->low();
+
+    return;
+}
+
+bool_t Sn74595::_pulseClear(void)
+{
+    if(!isPointerValid(this->_clear)) {
+        return false;
+    }
+    this->_clear->high();
+    this->_clear->low();
+
+    return true;
+}
+
+void Sn74595::_pulseShift(void)
+{
+    this->_shift->high();
+    this->_shift->low();
+
+    return;
+}
+
+void Sn74595::_pulseStore(void)
+{
+    this->_store->high();
+    this->_store->low();
+
+    return;
+}
+
+void Sn74595::_writeDataIn(cbool_t level_p)
+{
+    if(level_p) {
+        this->_dataIn->high();
+    } else {
+        this->_dataIn->low();
+    }
+
+    return;
+}
+
+bool_t Sn74595::_writeOutputEnable(cbool_t level_p)
+{
+    if(!isPointerValid(this->_outputEnable)) {
+        return false;
+    }
+    if(level_p) {
+        this->_outputEnable->high();
+    } else {
+        this->_outputEnable->low();
+    }
+
+    return true;
+}
+
+// =============================================================================
+// Class own methods - Protected
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+/**
+ * @cond
+*/
+
+// NONE
+
+/**
+ * @endcond
+*/
+
+// =============================================================================
+// End of file (sn74595.cpp)
+// =============================================================================
@@ -0,0 +1,843 @@
+/**
+ *******************************************************************************
+ * @file            sn74595.hpp
+ * @author          Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+ * @brief           SN74595 serial shift register interface for the FunSAPE++
+ *                      AVR8 Library.
+ * @details         SN74595 serial shift register interface for the FunSAPE++
+ *                      AVR8 Library.
+ * @date            2025-08-08
+ * @version         25.08
+ * @copyright       MIT License
+ * @note            No notes at this time.
+ * @todo            No itens in todo list yet.
+ * @bug             No bugs detected yet.
+ *
+ *******************************************************************************
+ * @attention
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Leandro Schwarz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to
+ *      deal in the Software without restriction, including without limitation
+ *      the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *      and/or sell copies of the Software, and to permit persons to whom the
+ *      Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ *      all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *      THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *      OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *      ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *      OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+*/
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __SN74595_HPP
+#define __SN74595_HPP                   2508
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+
+#include "../globalDefines.hpp"
+#if !defined(__GLOBAL_DEFINES_HPP)
+#   error [sn74595.hpp] Error 1 - Header file (globalDefines.hpp) is missing or corrupted!
+#elif __GLOBAL_DEFINES_HPP != __SN74595_HPP
+#   error [sn74595.hpp] Error 2 - Build mismatch between file (sn74595.hpp) and global definitions file (globalDefines.hpp)!
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+
+#include "../util/debug.hpp"
+#if !defined(__DEBUG_HPP)
+#   error [sn74595.hpp] Error 1 - Header file (debug.hpp) is missing or corrupted!
+#elif __DEBUG_HPP != __SN74595_HPP
+#   error [sn74595.hpp] Error 5 - Build mismatch between file (sn74595.hpp) and library dependency (debug.hpp)!
+#endif
+
+#include "../peripheral/gpioPin.hpp"
+#ifndef __GPIO_PIN_HPP
+#   error [sn74595.hpp] Error 1 - Header file (gpioPin.hpp) is missing or corrupted!
+#elif __GPIO_PIN_HPP != __SN74595_HPP
+#   error [sn74595.hpp] Error 5 - Build mismatch between file (sn74595.hpp) and library dependency (gpioPin.hpp)!
+#endif
+
+#include "../peripheral/staticPin.hpp"
+#ifndef __STATIC_PIN_HPP
+#   error [sn74595.hpp] Error 1 - Header file (staticPin.hpp) is missing or corrupted!
+#elif __STATIC_PIN_HPP != __SN74595_HPP
+#   error [sn74595.hpp] Error 5 - Build mismatch between file (sn74595.hpp) and library dependency (staticPin.hpp)!
+#endif
+
+//     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
+
+// NONE
+
+//     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Devices"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      Devices
+ * @brief           External devices.
+ * @{
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Devices/SN74595"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      SN74595
+ * @brief           SN74595 serial shift register controller module.
+ * @{
+*/
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+/**
+ * @enum            Sn74595DataOrder
+ * @brief           SN74595 bit order, available as @c Sn74595::DataOrder and
+ *                      @c StaticSn74595::DataOrder.
+*/
+enum class Sn74595DataOrder : bool_t {
+    LSB_FIRST                           = false,
+    MSB_FIRST                           = true
+};
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Classes
+// =============================================================================
+
+/**
+ * @brief           Sn74595Base class.
+ * @details         This class holds the shift and store sequences of cascaded
+ *                      SN74595 shift registers, shared by @ref Sn74595 and
+ *                      @ref StaticSn74595. The pin primitives (@c _initPins(),
+ *                      @c _writeDataIn(), @c _pulseShift(), @c _pulseStore(),
+ *                      @c _writeOutputEnable() and @c _pulseClear()) are
+ *                      provided by the derived class @a derived_t, resolved at
+ *                      compile time, so there are no virtual functions and no
+ *                      vtable.
+ * @attention       This class is not meant to be instantiated directly.
+*/
+template <class derived_t>
+class Sn74595Base
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+
+public:
+    typedef Sn74595DataOrder DataOrder;
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    // NONE
+
+private:
+    // NONE
+
+protected:
+    /**
+     * @brief       Sn74595Base class constructor.
+     * @details     Resets the control data members.
+    */
+    Sn74595Base(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+
+public:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+
+    /**
+     * @brief       Returns the last error.
+     * @details     Returns the last error.
+     * @return      @ref Error          Error status of the last operation.
+    */
+    Error inlined getLastError(
+            void
+    );
+
+    /**
+     * @brief       Initializes a Sn74595 object.
+     * @details     This function configures the pins, with the outputs
+     *                  disabled and the shift register cleared, if those pins
+     *                  are connected.
+     * @param[in]   dataOrder_p         @ref DataOrder of @ref sendByte().
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                    | Meaning                          |
+     * |:------------------------------|:---------------------------------|
+     * | @ref Error::NONE              | Success. No erros were detected. |
+     * | @ref Error::GPIO_PORT_NOT_SET | The pins were not set.           |
+     *
+    */
+    bool_t init(
+            const DataOrder dataOrder_p = DataOrder::LSB_FIRST
+    );
+
+    //     ///////////////////     OUTPUT CONTROL     ///////////////////     //
+
+    /**
+     * @brief       Clears the shift register.
+     * @details     This function pulses the master reset pin. The output
+     *                  register is only changed by the next @ref store().
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                    | Meaning                              |
+     * |:------------------------------|:-------------------------------------|
+     * | @ref Error::NONE              | Success. No erros were detected.     |
+     * | @ref Error::NOT_INITIALIZED   | The object was not initialized.      |
+     * | @ref Error::GPIO_PORT_NOT_SET | The master reset pin is not connected. |
+     *
+    */
+    bool_t clearData(
+            void
+    );
+
+    /**
+     * @brief       Disables the outputs.
+     * @details     This function drives the output enable pin HIGH.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                    | Meaning                              |
+     * |:------------------------------|:-------------------------------------|
+     * | @ref Error::NONE              | Success. No erros were detected.     |
+     * | @ref Error::NOT_INITIALIZED   | The object was not initialized.      |
+     * | @ref Error::GPIO_PORT_NOT_SET | The output enable pin is not connected. |
+     *
+    */
+    bool_t disableOutputs(
+            void
+    );
+
+    /**
+     * @brief       Enables the outputs.
+     * @details     This function drives the output enable pin LOW.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                    | Meaning                              |
+     * |:------------------------------|:-------------------------------------|
+     * | @ref Error::NONE              | Success. No erros were detected.     |
+     * | @ref Error::NOT_INITIALIZED   | The object was not initialized.      |
+     * | @ref Error::GPIO_PORT_NOT_SET | The output enable pin is not connected. |
+     *
+    */
+    bool_t enableOutputs(
+            void
+    );
+
+    /**
+     * @brief       Shifts a byte into the shift register.
+     * @details     This function shifts the eight bits of @a data_p, in the
+     *                  @ref DataOrder given to @ref init(). The outputs are
+     *                  only updated by @ref store().
+     * @param[in]   data_p              byte to be shifted.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                  | Meaning                          |
+     * |:----------------------------|:---------------------------------|
+     * | @ref Error::NONE            | Success. No erros were detected. |
+     * | @ref Error::NOT_INITIALIZED | The object was not initialized.  |
+     *
+    */
+    bool_t sendByte(
+            cuint8_t data_p
+    );
+
+    /**
+     * @brief       Copies the shift register to the outputs.
+     * @details     This function pulses the store clock pin.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                  | Meaning                          |
+     * |:----------------------------|:---------------------------------|
+     * | @ref Error::NONE            | Success. No erros were detected. |
+     * | @ref Error::NOT_INITIALIZED | The object was not initialized.  |
+     *
+    */
+    bool_t store(
+            void
+    );
+
+private:
+    derived_t *_bus(
+            void
+    )
+    {
+        return static_cast<derived_t *>(this);
+    }
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    bool_t                              _dataOrderMsbFirst      : 1;
+
+protected:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    bool_t                              _isInitialized          : 1;
+    bool_t                              _isPortsSet             : 1;
+    Error                               _lastError;
+
+}; // class Sn74595Base
+
+/**
+ * @brief           Sn74595 class.
+ * @details         This class manages cascaded SN74595 shift registers, driven
+ *                      by @ref GpioPin objects given by @ref setPort(). See
+ *                      @ref StaticSn74595 for pins known at compile time.
+*/
+class Sn74595 : public Sn74595Base<Sn74595>
+{
+    friend class Sn74595Base<Sn74595>;
+
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+
+public:
+    // NONE
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    /**
+     * @brief       Sn74595 class constructor.
+     * @details     Creates a Sn74595 object. The object still
+     *                  must be initialized before use.
+     * @see         init(const DataOrder).
+    */
+    Sn74595(
+            void
+    );
+
+    /**
+     * @brief       Sn74595 class destructor.
+     * @details     Destroys a Sn74595 object.
+    */
+    ~Sn74595(
+            void
+    );
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+
+public:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+
+    /**
+     * @brief       Sets the shift register pins.
+     * @details     This function sets the control pins of the shift register.
+     *                  The output enable and master reset pins are optional.
+     * @param[in]   dataInPin_p         Pointer to @ref GpioPin of the serial
+     *                                      data input (SER).
+     * @param[in]   shiftClockPin_p     Pointer to @ref GpioPin of the shift
+     *                                      clock (SRCLK).
+     * @param[in]   storeClockPin_p     Pointer to @ref GpioPin of the store
+     *                                      clock (RCLK).
+     * @param[in]   outputEnablePin_p   Pointer to @ref GpioPin of the output
+     *                                      enable (OE), or @c nullptr.
+     * @param[in]   masterResetPin_p    Pointer to @ref GpioPin of the master
+     *                                      reset (SRCLR), or @c nullptr.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code                        | Meaning                          |
+     * |:----------------------------------|:---------------------------------|
+     * | @ref Error::NONE                  | Success. No erros were detected. |
+     * | @ref Error::ARGUMENT_POINTER_NULL | A mandatory pin is missing.      |
+     *
+    */
+    bool_t setPort(
+            const GpioPin *dataInPin_p,
+            const GpioPin *shiftClockPin_p,
+            const GpioPin *storeClockPin_p,
+            const GpioPin *outputEnablePin_p    = nullptr,
+            const GpioPin *masterResetPin_p     = nullptr
+    );
+
+private:
+    //     /////////////////    PIN RELATED METHODS     /////////////////     //
+
+    void _initPins(
+            void
+    );
+
+    bool_t _pulseClear(
+            void
+    );
+
+    void _pulseShift(
+            void
+    );
+
+    void _pulseStore(
+            void
+    );
+
+    void _writeDataIn(
+            cbool_t level_p
+    );
+
+    bool_t _writeOutputEnable(
+            cbool_t level_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     ///////////////////    DEVICE BUS PORT     ///////////////////     //
+    GpioPin                             *_clear;
+    GpioPin                             *_dataIn;
+    GpioPin                             *_outputEnable;
+    GpioPin                             *_shift;
+    GpioPin                             *_store;
+
+}; // class Sn74595
+
+/**
+ * @brief           StaticSn74595 class.
+ * @details         This class manages cascaded SN74595 shift registers whose
+ *                      data, shift clock and store clock pins are known at
+ *                      compile time, given as @ref StaticPin types. Each bit
+ *                      is shifted with single @c sbi / @c cbi instructions
+ *                      instead of @ref GpioPin calls, and there is no
+ *                      @c setPort(). The output enable and master reset pins
+ *                      are not controlled (tie OE LOW and SRCLR HIGH), so
+ *                      @ref Sn74595Base::enableOutputs(),
+ *                      @ref Sn74595Base::disableOutputs() and
+ *                      @ref Sn74595Base::clearData() fail with
+ *                      @ref Error::GPIO_PORT_NOT_SET.
+ * @code
+ *                  typedef StaticPin<GpioPort::PORT_B, GpioPin::PinIndex::P0> DataPin;
+ *                  typedef StaticPin<GpioPort::PORT_B, GpioPin::PinIndex::P1> ShiftPin;
+ *                  typedef StaticPin<GpioPort::PORT_B, GpioPin::PinIndex::P2> StorePin;
+ *
+ *                  StaticSn74595<DataPin, ShiftPin, StorePin> leds;
+ *                  leds.init();
+ *                  leds.sendByte(0xA5);
+ *                  leds.store();
+ * @endcode
+*/
+template <class dataInPin_t, class shiftClockPin_t, class storeClockPin_t>
+class StaticSn74595 : public Sn74595Base<StaticSn74595<dataInPin_t, shiftClockPin_t, storeClockPin_t> >
+{
+    friend class Sn74595Base<StaticSn74595<dataInPin_t, shiftClockPin_t, storeClockPin_t> >;
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    /**
+     * @brief       StaticSn74595 class constructor.
+     * @details     Creates a StaticSn74595 object. The object still must be
+     *                  initialized before use.
+     * @see         init(const DataOrder).
+    */
+    StaticSn74595(
+            void
+    )
+    {
+        this->_isPortsSet               = true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+private:
+    //     /////////////////    PIN RELATED METHODS     /////////////////     //
+
+    void inlined _initPins(
+            void
+    )
+    {
+        dataInPin_t::clr();
+        dataInPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        shiftClockPin_t::clr();
+        shiftClockPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        storeClockPin_t::clr();
+        storeClockPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    }
+
+    bool_t inlined _pulseClear(
+            void
+    )
+    {
+        return false;
+    }
+
+    void inlined _pulseShift(
+            void
+    )
+    {
+        shiftClockPin_t::set();
+        shiftClockPin_t::clr();
+    }
+
+    void inlined _pulseStore(
+            void
+    )
+    {
+        storeClockPin_t::set();
+        storeClockPin_t::clr();
+    }
+
+    void inlined _writeDataIn(
+            cbool_t level_p
+    )
+    {
+        dataInPin_t::write(level_p);
+    }
+
+    bool_t inlined _writeOutputEnable(
+            cbool_t
+    )
+    {
+        return false;
+    }
+
+}; // class StaticSn74595
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+/**
+ * @cond
+*/
+
+//     //////////////////////     CONSTRUCTORS     //////////////////////     //
+
+template <class derived_t>
+Sn74595Base<derived_t>::Sn74595Base(void)
+{
+    // Resets data members
+    this->_dataOrderMsbFirst            = false;
+    this->_isInitialized                = false;
+    this->_isPortsSet                   = false;
+    this->_lastError                    = Error::NONE;
+
+    return;
+}
+
+//     ///////////////////     CONTROL AND STATUS     ///////////////////     //
+
+template <class derived_t>
+Error inlined Sn74595Base<derived_t>::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::init(const DataOrder dataOrder_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::init(const DataOrder)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // Resets data members
+    this->_isInitialized                = false;
+
+    // CHECK FOR ERROR - ports not set
+    if(!this->_isPortsSet) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Configures pins
+    this->_bus()->_initPins();
+
+    // Updates data members
+    this->_dataOrderMsbFirst            = (bool_t)dataOrder_p;
+    this->_isInitialized                = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+//     /////////////////////     OUTPUT CONTROL     /////////////////////     //
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::clearData(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::clearData(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // CHECK FOR ERROR - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Clears data
+    if(!this->_bus()->_pulseClear()) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::disableOutputs(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::disableOutputs(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // CHECK FOR ERROR - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Disables outputs
+    if(!this->_bus()->_writeOutputEnable(true)) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::enableOutputs(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::enableOutputs(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // CHECK FOR ERROR - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Enables outputs
+    if(!this->_bus()->_writeOutputEnable(false)) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::sendByte(cuint8_t data_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::sendByte(cuint8_t)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // CHECK FOR ERROR - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Transfers data
+    if(this->_dataOrderMsbFirst) {
+        for(uint8_t i = 0; i < 8; i++) {
+            this->_bus()->_writeDataIn(isBitSet(data_p, (7 - i)));
+            this->_bus()->_pulseShift();
+        }
+    } else {
+        for(uint8_t i = 0; i < 8; i++) {
+            this->_bus()->_writeDataIn(isBitSet(data_p, i));
+            this->_bus()->_pulseShift();
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Sn74595Base<derived_t>::store(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Sn74595::store(void)"), Debug::CodeIndex::SN74595_MODULE);
+
+    // CHECK FOR ERROR - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Stores data
+    this->_bus()->_pulseStore();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+/**
+ * @endcond
+*/
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Devices/SN74595"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+* @}
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Devices"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @}
+*/
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __SN74595_HPP
+
+// =============================================================================
+// End of file (sn74595.hpp)
+// =============================================================================
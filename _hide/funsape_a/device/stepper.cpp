@@ -100,9 +100,6 @@ Stepper::Stepper(void)
     this->_coilB                        = nullptr;
     this->_coilC                        = nullptr;
     this->_coilD                        = nullptr;
-    this->_mode                         = Mode::FULL_STEP_DRIVE;
-    this->_currentStep                  = Step::NONE;
-    this->_isInitialized                = false;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -126,199 +123,6 @@ Stepper::~Stepper(void)
 
 //     ///////////////////     CONTROL AND STATUS     ///////////////////     //
 
-bool_t Stepper::init(const Mode mode_p)
-{
-    // Mark passage for debugging purpose
-    debugMark(PSTR("Stepper::init(const Mode)"), Debug::CodeIndex::STEPPER_MODULE);
-
-    // Resets data members
-    this->_isInitialized                = false;
-
-    // Checks for errors
-    if(!this->_isPortsSet) {
-        // Returns error
-        this->_lastError = Error::GPIO_PORT_NOT_SET;
-        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::STEPPER_MODULE);
-        return false;
-    }
-
-    // Update data members
-    switch(mode_p) {
-    case Mode::FULL_STEP_DRIVE:
-    case Mode::HALF_STEP_DRIVE:
-    case Mode::DUAL_COIL_DRIVE:
-        break;
-    }
-
-    // Updates data members
-    this->_isInitialized                = true;
-    this->_mode                         = mode_p;
-
-    // Config GPIO
-    this->_coilA->low();
-    this->_coilB->low();
-    this->_coilC->low();
-    this->_coilD->low();
-    this->_coilA->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->_coilB->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->_coilC->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->_coilD->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->move(this->_currentRotation);
-
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
-    return true;
-}
-
-bool_t Stepper::move(const Rotation direction_p)
-{
-    // Mark passage for debugging purpose
-    debugMark(PSTR("Stepper::move(const Rotation)"), Debug::CodeIndex::STEPPER_MODULE);
-
-    // Checks for errors
-    if(!this->_isInitialized) {
-        // Returns error
-        this->_lastError = Error::NOT_INITIALIZED;
-        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::STEPPER_MODULE);
-        return false;
-    }
-
-    // Evaluates next step
-    switch(this->_mode) {
-    case Mode::HALF_STEP_DRIVE:
-        if(direction_p == Rotation::CLOCKWISE) {
-            this->_currentStep = (
-                            (this->_currentStep == Step::D_A)
-                            ? Step::A_A
-                            : static_cast<Step>(static_cast<uint8_t>(this->_currentStep) + 1)
-                    );
-        } else {
-            this->_currentStep = (
-                            (this->_currentStep == Step::A_A)
-                            ? Step::D_A
-                            : static_cast<Step>(static_cast<uint8_t>(this->_currentStep) - 1)
-                    );
-        }
-        break;
-    case Mode::FULL_STEP_DRIVE:
-        if(direction_p == Rotation::CLOCKWISE) {
-            switch(this->_currentStep) {
-            case Step::NONE:
-            case Step::D_D:
-            case Step::D_A:
-                this->_currentStep = Step::A_A;
-                break;
-            case Step::A_A:
-            case Step::A_B:
-                this->_currentStep = Step::B_B;
-                break;
-            case Step::B_B:
-            case Step::B_C:
-                this->_currentStep = Step::C_C;
-                break;
-            case Step::C_C:
-            case Step::C_D:
-                this->_currentStep = Step::D_D;
-                break;
-            }
-        } else {
-            switch(this->_currentStep) {
-            case Step::NONE:
-            case Step::A_A:
-            case Step::D_A:
-                this->_currentStep = Step::D_D;
-                break;
-            case Step::D_D:
-            case Step::C_D:
-                this->_currentStep = Step::C_C;
-                break;
-            case Step::C_C:
-            case Step::B_C:
-                this->_currentStep = Step::B_B;
-                break;
-            case Step::B_B:
-            case Step::A_B:
-                this->_currentStep = Step::A_A;
-                break;
-            }
-        }
-        break;
-    case Mode::DUAL_COIL_DRIVE:
-        if(direction_p == Rotation::CLOCKWISE) {
-            switch(this->_currentStep) {
-            case Step::D_A:
-            case Step::NONE:
-            case Step::A_A:
-                this->_currentStep = Step::A_B;
-                break;
-            case Step::A_B:
-            case Step::B_B:
-                this->_currentStep = Step::B_C;
-                break;
-            case Step::B_C:
-            case Step::C_C:
-                this->_currentStep = Step::C_D;
-                break;
-            case Step::C_D:
-            case Step::D_D:
-                this->_currentStep = Step::D_A;
-                break;
-            }
-        } else {
-            switch(this->_currentStep) {
-            case Step::A_B:
-            case Step::A_A:
-            case Step::NONE:
-                this->_currentStep = Step::D_A;
-                break;
-            case Step::D_A:
-            case Step::D_D:
-                this->_currentStep = Step::C_D;
-                break;
-            case Step::C_D:
-            case Step::C_C:
-                this->_currentStep = Step::B_C;
-                break;
-            case Step::B_C:
-            case Step::B_B:
-                this->_currentStep = Step::A_B;
-                break;
-            }
-        }
-        break;
-    }
-
-    // Moves motor
-    this->_doStep();
-
-    // Updates data members
-    this->_currentRotation              = direction_p;
-
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
-    return true;
-}
-
-bool_t Stepper::setMode(const Mode mode_p)
-{
-    // Mark passage for debugging purpose
-    debugMark(PSTR("Stepper::setMode(const Mode)"), Debug::CodeIndex::STEPPER_MODULE);
-
-    // Updates data members
-    this->_mode     = mode_p;
-
-    if(this->_isInitialized) {
-        this->move(this->_currentRotation);
-    }
-
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
-    return true;
-}
-
 bool_t Stepper::setPorts(GpioPin *coilA_p, GpioPin *coilB_p, GpioPin *coilC_p, GpioPin *coilD_p)
 {
     // Mark passage for debugging purpose
@@ -374,7 +178,22 @@ bool_t Stepper::setPorts(GpioPin *coilA_p, GpioPin *coilB_p, GpioPin *coilC_p, G
 // Class own methods - Private
 // =============================================================================
 
-void Stepper::_doStep(void)
+void Stepper::_initCoils(void)
+{
+    // Config GPIO
+    this->_coilA->low();
+    this->_coilB->low();
+    this->_coilC->low();
+    this->_coilD->low();
+    this->_coilA->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_coilB->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_coilC->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+    this->_coilD->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+
+    return;
+}
+
+void Stepper::_writeCoils(cuint8_t coils_p)
 {
     // Turns off all coils
     this->_coilA->low();
@@ -383,41 +202,21 @@ void Stepper::_doStep(void)
     this->_coilD->low();
 
     // Turns on specific coils
-    switch(this->_currentStep) {
-    case Step::A_A:
+    if(isBitSet(coils_p, 0)) {
         this->_coilA->high();
-        break;
-    case Step::A_B:
-        this->_coilA->high();
-        this->_coilB->high();
-        break;
-    case Step::B_B:
-        this->_coilB->high();
-        break;
-    case Step::B_C:
+    }
+    if(isBitSet(coils_p, 1)) {
         this->_coilB->high();
+    }
+    if(isBitSet(coils_p, 2)) {
         this->_coilC->high();
-        break;
-    case Step::C_C:
-        this->_coilC->high();
-        break;
-    case Step::C_D:
-        this->_coilC->high();
-        this->_coilD->high();
-        break;
-    case Step::D_D:
-        this->_coilD->high();
-        break;
-    case Step::D_A:
+    }
+    if(isBitSet(coils_p, 3)) {
         this->_coilD->high();
-        this->_coilA->high();
-        break;
-    case Step::NONE:
-        break;
     }
 
     return;
-};
+}
 
 // =============================================================================
 // Class own methods - Protected
@@ -77,6 +77,13 @@
 #   error [stepper.hpp] Error 5 - Build mismatch between file (stepper.hpp) and library dependency (gpioPin.hpp)!
 #endif
 
+#include "../peripheral/staticBus.hpp"
+#ifndef __STATIC_BUS_HPP
+#   error [stepper.hpp] Error 1 - Header file (staticBus.hpp) is missing or corrupted!
+#elif __STATIC_BUS_HPP != __STEPPER_HPP
+#   error [stepper.hpp] Error 5 - Build mismatch between file (stepper.hpp) and library dependency (staticBus.hpp)!
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -127,7 +134,16 @@
 // New data types
 // =============================================================================
 
-// NONE
+/**
+ * @enum            StepperMode
+ * @brief           Stepper motor drive mode, available as @c Stepper::Mode and
+ *                      @c StaticStepper::Mode.
+*/
+enum class StepperMode : uint8_t {
+    FULL_STEP_DRIVE                     = 0,
+    DUAL_COIL_DRIVE                     = 1,
+    HALF_STEP_DRIVE                     = 2,
+};
 
 // =============================================================================
 // Interrupt callback functions
@@ -146,21 +162,23 @@
 // =============================================================================
 
 /**
- * @brief           Stepper class.
- * @details         This class can handle unipolar stepper motors in Full Step,
- *                      Half Step and Double Coil Drive.
+ * @brief           StepperBase class.
+ * @details         This class holds the step sequences of the unipolar stepper
+ *                      motor drive modes, shared by @ref Stepper and
+ *                      @ref StaticStepper. The coil outputs (@c _initCoils()
+ *                      and @c _writeCoils()) are provided by the derived class
+ *                      @a derived_t, resolved at compile time, so there are no
+ *                      virtual functions and no vtable.
+ * @attention       This class is not meant to be instantiated directly.
 */
-class Stepper
+template <class derived_t>
+class StepperBase
 {
     // -------------------------------------------------------------------------
     // New data types ----------------------------------------------------------
 
 public:
-    enum class Mode : uint8_t {
-        FULL_STEP_DRIVE                 = 0,
-        DUAL_COIL_DRIVE                 = 1,
-        HALF_STEP_DRIVE                 = 2,
-    };
+    typedef StepperMode Mode;
 
 private:
     enum class Step : uint8_t {
@@ -175,9 +193,6 @@ private:
         D_A         = 8
     };
 
-    friend Stepper::Step inlined operator+(Stepper::Step a, uint8_t b);
-    friend Stepper::Step inlined operator-(Stepper::Step a, uint8_t b);
-
 protected:
     // NONE
 
@@ -185,35 +200,19 @@ protected:
     // Constructors ------------------------------------------------------------
 
 public:
-    /**
-     * @brief       Stepper class constructor.
-     * @details     Creates a Stepper object. The object still
-     *                  must be initialized before use.
-     * @see         init(void).
-     * @par Error codes:
-     *
-     * | Error code       | Meaning                          |
-     * |:-----------------|:---------------------------------|
-     * | @ref Error::NONE | Success. No erros were detected. |
-     *
-    */
-    Stepper(
-            void
-    );
-
-    /**
-     * @brief       Stepper class destructor.
-     * @details     Destroys a Stepper object.
-    */
-    ~Stepper(
-            void
-    );
+    // NONE
 
 private:
     // NONE
 
 protected:
-    // NONE
+    /**
+     * @brief       StepperBase class constructor.
+     * @details     Resets the drive data members.
+    */
+    StepperBase(
+            void
+    );
 
     // -------------------------------------------------------------------------
     // Methods - Inherited methods ---------------------------------------------
@@ -281,6 +280,107 @@ public:
             const Mode mode_p
     );
 
+private:
+    derived_t *_bus(
+            void
+    )
+    {
+        return static_cast<derived_t *>(this);
+    }
+
+    void _doStep(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    Rotation        _currentRotation    : 1;
+    Step            _currentStep;
+    Mode            _mode;
+
+protected:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    bool_t          _isInitialized      : 1;
+    bool_t          _isPortsSet         : 1;
+    Error           _lastError;
+
+}; // class StepperBase
+
+/**
+ * @brief           Stepper class.
+ * @details         This class can handle unipolar stepper motors in Full Step,
+ *                      Half Step and Double Coil Drive. The coils are driven by
+ *                      @ref GpioPin objects given by @ref setPorts(). See
+ *                      @ref StaticStepper for coils known at compile time.
+*/
+class Stepper : public StepperBase<Stepper>
+{
+    friend class StepperBase<Stepper>;
+
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+
+public:
+    // NONE
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    /**
+     * @brief       Stepper class constructor.
+     * @details     Creates a Stepper object. The object still
+     *                  must be initialized before use.
+     * @see         init(void).
+     * @par Error codes:
+     *
+     * | Error code       | Meaning                          |
+     * |:-----------------|:---------------------------------|
+     * | @ref Error::NONE | Success. No erros were detected. |
+     *
+    */
+    Stepper(
+            void
+    );
+
+    /**
+     * @brief       Stepper class destructor.
+     * @details     Destroys a Stepper object.
+    */
+    ~Stepper(
+            void
+    );
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+
+public:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+
     /**
      * @brief       Set coil control pins.
      * @details     This function sets the control pins of the stepper coils.
@@ -306,10 +406,14 @@ public:
     );
 
 private:
-    void _doStep(
+    void _initCoils(
             void
     );
 
+    void _writeCoils(
+            cuint8_t coils_p
+    );
+
 protected:
     // NONE
 
@@ -322,16 +426,68 @@ private:
     GpioPin         *_coilB;
     GpioPin         *_coilC;
     GpioPin         *_coilD;
-
-    //     /////////////////     CONTROL AND STATUS     /////////////////     //
-    Rotation        _currentRotation    : 1;
-    Step            _currentStep;
-    bool_t          _isInitialized      : 1;
-    bool_t          _isPortsSet         : 1;
-    Error           _lastError;
-    Mode            _mode;
 }; // class Stepper
 
+/**
+ * @brief           StaticStepper class.
+ * @details         This class is a unipolar stepper motor driver whose coils
+ *                      are known at compile time, given as a 4-pin
+ *                      @ref StaticBus type; coil A is the lowest pin of the
+ *                      mask and coil D the highest. Each step is a single
+ *                      @ref StaticBus::write(), so the coils change together
+ *                      and there is no @c setPorts(). It has the same drive
+ *                      methods as @ref Stepper, through @ref StepperBase.
+ * @code
+ *                  typedef StaticBus<GpioPort::PORT_B, 0x0F> CoilsBus;
+ *
+ *                  StaticStepper<CoilsBus> motor;
+ *                  motor.init(StaticStepper<CoilsBus>::Mode::HALF_STEP_DRIVE);
+ *                  motor.move(Rotation::CLOCKWISE);
+ * @endcode
+*/
+template <class coils_t>
+class StaticStepper : public StepperBase<StaticStepper<coils_t> >
+{
+    friend class StepperBase<StaticStepper<coils_t> >;
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    /**
+     * @brief       StaticStepper class constructor.
+     * @details     Creates a StaticStepper object. The object still must be
+     *                  initialized before use.
+     * @see         init(void).
+    */
+    StaticStepper(
+            void
+    )
+    {
+        this->_isPortsSet               = true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+private:
+    void inlined _initCoils(
+            void
+    )
+    {
+        coils_t::clr();
+        coils_t::setMode(GpioBus::Mode::OUTPUT_PUSH_PULL);
+    }
+
+    void inlined _writeCoils(
+            cuint8_t coils_p
+    )
+    {
+        coils_t::write(coils_p);
+    }
+
+}; // class StaticStepper
+
 // =============================================================================
 // Inlined class functions
 // =============================================================================
@@ -340,38 +496,259 @@ private:
  * @cond
 */
 
+//     //////////////////////     CONSTRUCTORS     //////////////////////     //
+
+template <class derived_t>
+StepperBase<derived_t>::StepperBase(void)
+{
+    // Resets data members
+    this->_currentRotation              = Rotation::CLOCKWISE;
+    this->_currentStep                  = Step::NONE;
+    this->_isInitialized                = false;
+    this->_isPortsSet                   = false;
+    this->_lastError                    = Error::NONE;
+    this->_mode                         = Mode::FULL_STEP_DRIVE;
+
+    return;
+}
+
 //     ///////////////////     CONTROL AND STATUS     ///////////////////     //
 
-Error inlined Stepper::getLastError(void)
+template <class derived_t>
+Error inlined StepperBase<derived_t>::getLastError(void)
 {
     // Returns last error
     return this->_lastError;
 }
 
-// Stepper::Step inlined operator+(Stepper::Step a, uint8_t b)
-// {
-//     b += static_cast<uint8_t>(a);
-//     b %= 9;
-//     b = (b == 0) ? 1 : b;
+template <class derived_t>
+bool_t StepperBase<derived_t>::init(const Mode mode_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Stepper::init(const Mode)"), Debug::CodeIndex::STEPPER_MODULE);
+
+    // Resets data members
+    this->_isInitialized                = false;
+
+    // Checks for errors
+    if(!this->_isPortsSet) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Update data members
+    switch(mode_p) {
+    case Mode::FULL_STEP_DRIVE:
+    case Mode::HALF_STEP_DRIVE:
+    case Mode::DUAL_COIL_DRIVE:
+        break;
+    }
+
+    // Updates data members
+    this->_isInitialized                = true;
+    this->_mode                         = mode_p;
+
+    // Config GPIO
+    this->_bus()->_initCoils();
+    this->move(this->_currentRotation);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
 
-//     return static_cast<Stepper::Step>(b);
-// }
+template <class derived_t>
+bool_t StepperBase<derived_t>::move(const Rotation direction_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Stepper::move(const Rotation)"), Debug::CodeIndex::STEPPER_MODULE);
+
+    // Checks for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Evaluates next step
+    switch(this->_mode) {
+    case Mode::HALF_STEP_DRIVE:
+        if(direction_p == Rotation::CLOCKWISE) {
+            this->_currentStep = (
+                            (this->_currentStep == Step::D_A)
+                            ? Step::A_A
+                            : static_cast<Step>(static_cast<uint8_t>(this->_currentStep) + 1)
+                    );
+        } else {
+            this->_currentStep = (
+                            (this->_currentStep == Step::A_A)
+                            ? Step::D_A
+                            : static_cast<Step>(static_cast<uint8_t>(this->_currentStep) - 1)
+                    );
+        }
+        break;
+    case Mode::FULL_STEP_DRIVE:
+        if(direction_p == Rotation::CLOCKWISE) {
+            switch(this->_currentStep) {
+            case Step::NONE:
+            case Step::D_D:
+            case Step::D_A:
+                this->_currentStep = Step::A_A;
+                break;
+            case Step::A_A:
+            case Step::A_B:
+                this->_currentStep = Step::B_B;
+                break;
+            case Step::B_B:
+            case Step::B_C:
+                this->_currentStep = Step::C_C;
+                break;
+            case Step::C_C:
+            case Step::C_D:
+                this->_currentStep = Step::D_D;
+                break;
+            }
+        } else {
+            switch(this->_currentStep) {
+            case Step::NONE:
+            case Step::A_A:
+            case Step::D_A:
+                this->_currentStep = Step::D_D;
+                break;
+            case Step::D_D:
+            case Step::C_D:
+                this->_currentStep = Step::C_C;
+                break;
+            case Step::C_C:
+            case Step::B_C:
+                this->_currentStep = Step::B_B;
+                break;
+            case Step::B_B:
+            case Step::A_B:
+                this->_currentStep = Step::A_A;
+                break;
+            }
+        }
+        break;
+    case Mode::DUAL_COIL_DRIVE:
+        if(direction_p == Rotation::CLOCKWISE) {
+            switch(this->_currentStep) {
+            case Step::D_A:
+            case Step::NONE:
+            case Step::A_A:
+                this->_currentStep = Step::A_B;
+                break;
+            case Step::A_B:
+            case Step::B_B:
+                this->_currentStep = Step::B_C;
+                break;
+            case Step::B_C:
+            case Step::C_C:
+                this->_currentStep = Step::C_D;
+                break;
+            case Step::C_D:
+            case Step::D_D:
+                this->_currentStep = Step::D_A;
+                break;
+            }
+        } else {
+            switch(this->_currentStep) {
+            case Step::A_B:
+            case Step::A_A:
+            case Step::NONE:
+                this->_currentStep = Step::D_A;
+                break;
+            case Step::D_A:
+            case Step::D_D:
+                this->_currentStep = Step::C_D;
+                break;
+            case Step::C_D:
+            case Step::C_C:
+                this->_currentStep = Step::B_C;
+                break;
+            case Step::B_C:
+            case Step::B_B:
+                this->_currentStep = Step::A_B;
+                break;
+            }
+        }
+        break;
+    }
+
+    // Moves motor
+    this->_doStep();
+
+    // Updates data members
+    this->_currentRotation              = direction_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
 
-// Stepper::Step inlined operator-(Stepper::Step a, uint8_t b)
-// {
-//     uint8_t aux8 = static_cast<uint8_t>(a);
+template <class derived_t>
+bool_t StepperBase<derived_t>::setMode(const Mode mode_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Stepper::setMode(const Mode)"), Debug::CodeIndex::STEPPER_MODULE);
 
-//     if()
+    // Updates data members
+    this->_mode     = mode_p;
 
+    if(this->_isInitialized) {
+        this->move(this->_currentRotation);
+    }
 
-//         if() {
-//             b -= ;
-//         }
-//     b %= 9;
-//     b = (b == 0) ? 1 : b;
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
 
-//     return static_cast<Stepper::Step>(b);
-// }
+template <class derived_t>
+void StepperBase<derived_t>::_doStep(void)
+{
+    // Local variables
+    uint8_t coils = 0;                  // Coil A at bit 0 to coil D at bit 3
+
+    // Turns on specific coils
+    switch(this->_currentStep) {
+    case Step::A_A:
+        coils = 0b0001;
+        break;
+    case Step::A_B:
+        coils = 0b0011;
+        break;
+    case Step::B_B:
+        coils = 0b0010;
+        break;
+    case Step::B_C:
+        coils = 0b0110;
+        break;
+    case Step::C_C:
+        coils = 0b0100;
+        break;
+    case Step::C_D:
+        coils = 0b1100;
+        break;
+    case Step::D_D:
+        coils = 0b1000;
+        break;
+    case Step::D_A:
+        coils = 0b1001;
+        break;
+    case Step::NONE:
+        break;
+    }
+    this->_bus()->_writeCoils(coils);
+
+    return;
+}
 
 /**
  * @endcond
@@ -77,6 +77,13 @@
 #   error [tm1637.hpp] Error 5 - Build mismatch between file (tm1637.hpp) and library dependency (gpioPin.hpp)!
 #endif
 
+#include "../peripheral/staticPin.hpp"
+#ifndef __STATIC_PIN_HPP
+#   error [tm1637.hpp] Error 1 - Header file (staticPin.hpp) is missing or corrupted!
+#elif __STATIC_PIN_HPP != __TM1637_HPP
+#   error [tm1637.hpp] Error 5 - Build mismatch between file (tm1637.hpp) and library dependency (staticPin.hpp)!
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -121,13 +128,27 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+cuint8_t constTm1637ClockPeriod         = 10;       //!< Bus clock period, in us
 
 // =============================================================================
 // New data types
 // =============================================================================
 
-// NONE
+/**
+ * @enum            Tm1637Contrast
+ * @brief           TM1637 display contrast, available as @c Tm1637::Contrast
+ *                      and @c StaticTm1637::Contrast.
+*/
+enum class Tm1637Contrast : uint8_t {
+    PERCENT_6_25                        = 0,
+    PERCENT_13                          = 1,
+    PERCENT_26                          = 2,
+    PERCENT_62_5                        = 3,
+    PERCENT_68_75                       = 4,
+    PERCENT_75                          = 5,
+    PERCENT_81_25                       = 6,
+    PERCENT_87_5                        = 7,
+};
 
 // =============================================================================
 // Interrupt callback functions
@@ -146,26 +167,24 @@
 // =============================================================================
 
 /**
- * @brief           Tm1637 class.
- * @details         This class can handle multiplexed seven segments displays,
- *                      from 2 to 8 digits based on TM1637 display controller.
+ * @brief           Tm1637Base class.
+ * @details         This class holds the TM1637 command set and display
+ *                      control, shared by @ref Tm1637 and @ref StaticTm1637.
+ *                      The bus primitives (@c _initBus(), @c _sendStart(),
+ *                      @c _sendStop(), @c _writeByte() and @c _readAck()) are
+ *                      provided by the derived class @a derived_t, resolved at
+ *                      compile time, so there are no virtual functions and no
+ *                      vtable.
+ * @attention       This class is not meant to be instantiated directly.
 */
-class Tm1637
+template <class derived_t>
+class Tm1637Base
 {
     // -------------------------------------------------------------------------
     // New data types ----------------------------------------------------------
 
 public:
-    enum class Contrast : uint8_t {
-        PERCENT_6_25                    = 0,
-        PERCENT_13                      = 1,
-        PERCENT_26                      = 2,
-        PERCENT_62_5                    = 3,
-        PERCENT_68_75                   = 4,
-        PERCENT_75                      = 5,
-        PERCENT_81_25                   = 6,
-        PERCENT_87_5                    = 7,
-    };
+    typedef Tm1637Contrast Contrast;
 
 private:
     //     //////////////////////     COMMANDS     //////////////////////     //
@@ -206,35 +225,19 @@ protected:
     // Constructors ------------------------------------------------------------
 
 public:
-    /**
-     * @brief       Tm1637 class constructor.
-     * @details     Creates a Tm1637 object. The object still
-     *                  must be initialized before use.
-     * @see         init(void).
-     * @par Error codes:
-     *
-     * | Error code       | Meaning                          |
-     * |:-----------------|:---------------------------------|
-     * | @ref Error::NONE | Success. No erros were detected. |
-     *
-    */
-    Tm1637(
-            void
-    );
-
-    /**
-     * @brief       Tm1637 class destructor.
-     * @details     Destroys a Tm1637 object.
-    */
-    ~Tm1637(
-            void
-    );
+    // NONE
 
 private:
     // NONE
 
 protected:
-    // NONE
+    /**
+     * @brief       Tm1637Base class constructor.
+     * @details     Resets the display control data members.
+    */
+    Tm1637Base(
+            void
+    );
 
     // -------------------------------------------------------------------------
     // Methods - Inherited methods ---------------------------------------------
@@ -281,27 +284,6 @@ public:
             cbool_t useAutoIncrementMode_p
     );
 
-    /**
-     * @brief       Set data and control pins.
-     * @details     This function sets the data and clock pins.
-     * @param[out]  gpioDioPin_p        Pointer to @ref GpioPin of the data pin.
-     * @param[out]  gpioClkPin_p        Pointer to @ref GpioPin of the clock
-     *                                      pin.
-     * @retval      true                if success.
-     * @retval      false               if an error occurred. Retrieve the error
-     *                                      by calling @ref getLastError().
-     *
-     * @par Error codes:
-     * | Error code       | Meaning                          |
-     * |:-----------------|:---------------------------------|
-     * | @ref Error::NONE | Success. No erros were detected. |
-     *
-    */
-    bool_t setPorts(
-            GpioPin *gpioDioPin_p,
-            GpioPin *gpioClkPin_p
-    );
-
     //     ///////////////////    DISPLAY CONTROL     ///////////////////     //
 
     bool_t setDisplayContrast(
@@ -329,9 +311,135 @@ public:
             uint8_t *keyPressed_p
     );
 
+private:
+    derived_t *_bus(
+            void
+    )
+    {
+        return static_cast<derived_t *>(this);
+    }
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    bool_t                              _useAutoIncrementMode   : 1;
+
+    //     ///////////////////    DISPLAY CONTROL     ///////////////////     //
+    Contrast                            _contrastLevel;
+    bool_t                              _showDisplay;
+    static cuint8_t                     _segments[16];
+
+protected:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    bool_t                              _isInitialized          : 1;
+    bool_t                              _isPortsSet             : 1;
+    Error                               _lastError;
+
+}; // class Tm1637Base
+
+/**
+ * @brief           Tm1637 class.
+ * @details         This class can handle multiplexed seven segments displays,
+ *                      from 2 to 8 digits based on TM1637 display controller.
+ *                      The data and clock pins are @ref GpioPin objects given
+ *                      by @ref setPorts(). See @ref StaticTm1637 for pins known
+ *                      at compile time.
+*/
+class Tm1637 : public Tm1637Base<Tm1637>
+{
+    friend class Tm1637Base<Tm1637>;
+
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+
+public:
+    // NONE
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    /**
+     * @brief       Tm1637 class constructor.
+     * @details     Creates a Tm1637 object. The object still
+     *                  must be initialized before use.
+     * @see         init(void).
+     * @par Error codes:
+     *
+     * | Error code       | Meaning                          |
+     * |:-----------------|:---------------------------------|
+     * | @ref Error::NONE | Success. No erros were detected. |
+     *
+    */
+    Tm1637(
+            void
+    );
+
+    /**
+     * @brief       Tm1637 class destructor.
+     * @details     Destroys a Tm1637 object.
+    */
+    ~Tm1637(
+            void
+    );
+
+private:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+
+public:
+    // NONE
+
+protected:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+
+    /**
+     * @brief       Set data and control pins.
+     * @details     This function sets the data and clock pins.
+     * @param[out]  gpioDioPin_p        Pointer to @ref GpioPin of the data pin.
+     * @param[out]  gpioClkPin_p        Pointer to @ref GpioPin of the clock
+     *                                      pin.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     *
+     * @par Error codes:
+     * | Error code       | Meaning                          |
+     * |:-----------------|:---------------------------------|
+     * | @ref Error::NONE | Success. No erros were detected. |
+     *
+    */
+    bool_t setPorts(
+            GpioPin *gpioDioPin_p,
+            GpioPin *gpioClkPin_p
+    );
+
 private:
     //     ///////////////     COMMUNICATION PROTOCOL     ///////////////     //
 
+    void _initBus(
+            void
+    );
+
     bool_t _readAck(
             void
     );
@@ -352,9 +460,6 @@ private:
             cuint8_t byteToWrite_p
     );
 
-protected:
-    // NONE
-
     // -------------------------------------------------------------------------
     // Properties --------------------------------------------------------------
 
@@ -364,20 +469,129 @@ private:
     GpioPin                             *_gpioClockPin;
     GpioPin                             *_gpioDataPin;
 
-    //     /////////////////     CONTROL AND STATUS     /////////////////     //
-    bool_t                              _isInitialized          : 1;
-    bool_t                              _isPortsSet             : 1;
-    Error                               _lastError;
-    bool_t                              _useAutoIncrementMode   : 1;
+}; // class Tm1637
 
-    //     ///////////////////    DISPLAY CONTROL     ///////////////////     //
-    Contrast                            _contrastLevel;
-    bool_t                              _showDisplay;
+/**
+ * @brief           StaticTm1637 class.
+ * @details         This class is a TM1637 driver whose data and clock pins are
+ *                      known at compile time, given as @ref StaticPin types.
+ *                      The bit loop drives the pins with single @c sbi /
+ *                      @c cbi instructions instead of @ref GpioPin calls, and
+ *                      there is no @c setPorts(). It has the same display
+ *                      control methods as @ref Tm1637, through
+ *                      @ref Tm1637Base.
+ * @code
+ *                  typedef StaticPin<GpioPort::PORT_D, GpioPin::PinIndex::P2> DioPin;
+ *                  typedef StaticPin<GpioPort::PORT_D, GpioPin::PinIndex::P3> ClkPin;
+ *
+ *                  StaticTm1637<DioPin, ClkPin> display;
+ *                  display.init();
+ *                  display.showDisplay(true);
+ * @endcode
+*/
+template <class dioPin_t, class clkPin_t>
+class StaticTm1637 : public Tm1637Base<StaticTm1637<dioPin_t, clkPin_t> >
+{
+    friend class Tm1637Base<StaticTm1637<dioPin_t, clkPin_t> >;
 
-protected:
-    // NONE
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
 
-}; // class Tm1637
+public:
+    /**
+     * @brief       StaticTm1637 class constructor.
+     * @details     Creates a StaticTm1637 object. The object still must be
+     *                  initialized before use.
+     * @see         init(void).
+    */
+    StaticTm1637(
+            void
+    )
+    {
+        this->_isPortsSet               = true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+private:
+    //     ///////////////     COMMUNICATION PROTOCOL     ///////////////     //
+
+    void inlined _initBus(
+            void
+    )
+    {
+        // Idle bus: CLK driven HIGH, DIO released
+        clkPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        clkPin_t::set();
+        dioPin_t::setMode(GpioPin::Mode::INPUT_FLOATING);
+    }
+
+    bool_t inlined _readAck(
+            void
+    )
+    {
+        // Local variables
+        bool_t ack;
+
+        // Releases DIO line and reads ACK bit
+        dioPin_t::setMode(GpioPin::Mode::INPUT_FLOATING);
+        delayUs(constTm1637ClockPeriod / 2);
+        clkPin_t::set();
+        ack = !dioPin_t::read();
+        delayUs(constTm1637ClockPeriod / 2);
+        clkPin_t::clr();
+
+        return ack;
+    }
+
+    void inlined _sendStart(
+            void
+    )
+    {
+        // Pull lines up
+        clkPin_t::set();
+        dioPin_t::setMode(GpioPin::Mode::INPUT_FLOATING);
+        delayUs(constTm1637ClockPeriod);
+
+        // Send start condition
+        dioPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        delayUs(constTm1637ClockPeriod / 2);
+        clkPin_t::clr();
+    }
+
+    void inlined _sendStop(
+            void
+    )
+    {
+        // Send stop condition, with DIO driven LOW
+        dioPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        delayUs(constTm1637ClockPeriod / 2);
+        clkPin_t::set();
+        delayUs(constTm1637ClockPeriod / 2);
+        dioPin_t::setMode(GpioPin::Mode::INPUT_FLOATING);
+        delayUs(constTm1637ClockPeriod);
+    }
+
+    void _writeByte(
+            cuint8_t byteToWrite_p
+    )
+    {
+        // LSB first; DIO is open drain (released for 1, driven LOW for 0)
+        for(uint8_t i = 0; i < 8; i++) {
+            if(isBitSet(byteToWrite_p, i)) {
+                dioPin_t::setMode(GpioPin::Mode::INPUT_FLOATING);
+            } else {
+                dioPin_t::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+            }
+            delayUs(constTm1637ClockPeriod / 2);
+            clkPin_t::set();
+            delayUs(constTm1637ClockPeriod / 2);
+            clkPin_t::clr();
+        }
+    }
+
+}; // class StaticTm1637
 
 // =============================================================================
 // Inlined class functions
@@ -387,14 +601,317 @@ protected:
  * @cond
 */
 
+//     //////////////////////     CONSTRUCTORS     //////////////////////     //
+
+template <class derived_t>
+Tm1637Base<derived_t>::Tm1637Base(void)
+{
+    // Resets data members
+    this->_contrastLevel                = Contrast::PERCENT_62_5;
+    this->_isInitialized                = false;
+    this->_isPortsSet                   = false;
+    this->_lastError                    = Error::NONE;
+    this->_showDisplay                  = false;
+    this->_useAutoIncrementMode         = true;
+
+    return;
+}
+
+template <class derived_t>
+cuint8_t Tm1637Base<derived_t>::_segments[16] = {
+    0b00111111,
+    0b00000110,
+    0b01011011,
+    0b01001111,
+    0b01100110,
+    0b01101101,
+    0b01111101,
+    0b00000111,
+    0b01111111,
+    0b01101111,
+    0b01110111,
+    0b01111100,
+    0b00111001,
+    0b01011110,
+    0b01111001,
+    0b01110001
+};
+
 //     ///////////////////     CONTROL AND STATUS     ///////////////////     //
 
-Error inlined Tm1637::getLastError(void)
+template <class derived_t>
+Error inlined Tm1637Base<derived_t>::getLastError(void)
 {
     // Returns last error
     return this->_lastError;
 }
 
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::init(void)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::init(void)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Resets data members
+    this->_isInitialized                = false;
+
+    // Check for errors
+    if(!this->_isPortsSet) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_NOT_SET;
+        debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // I/O initialization (Data Bus)
+    this->_bus()->_initBus();
+
+    // Updates data members
+    this->_isInitialized                = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::setAddressingMode(cbool_t useAutoIncrementMode_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::setAddressingMode(cbool_t)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Update data members
+    this->_useAutoIncrementMode         = useAutoIncrementMode_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+//     /////////////////////    DISPLAY CONTROL     /////////////////////     //
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::setDisplayContrast(const Contrast contrastLevel_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::setDisplayContrast(const Contrast)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t data = 0;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Prepare command
+    data = (uint8_t)Command::DISPLAY_CONTROL;
+    setMaskOffset(data,
+            ((uint8_t)(this->_showDisplay) & (uint8_t)(BitMask::DISPLAY_CONTROL_SHOW)),
+            (uint8_t)(BitPos::DISPLAY_CONTROL_SHOW)
+    );
+    setMaskOffset(data,
+            ((uint8_t)(contrastLevel_p) & (uint8_t)(BitMask::DISPLAY_CONTROL_CONTRAST)),
+            (uint8_t)(BitPos::DISPLAY_CONTROL_CONTRAST)
+    );
+
+    // Send command
+    this->_bus()->_sendStart();
+    this->_bus()->_writeByte(data);
+    if(!this->_bus()->_readAck()) {
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    this->_bus()->_sendStop();
+
+    // Update data members
+    this->_contrastLevel                = contrastLevel_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::showDisplay(cbool_t showDisplay_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::showDisplay(cbool_t)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t data = 0;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Prepare command
+    data = (uint8_t)Command::DISPLAY_CONTROL;
+    setMaskOffset(data,
+            ((uint8_t)(showDisplay_p) & (uint8_t)(BitMask::DISPLAY_CONTROL_SHOW)),
+            (uint8_t)(BitPos::DISPLAY_CONTROL_SHOW)
+    );
+    setMaskOffset(data,
+            ((uint8_t)(this->_contrastLevel) & (uint8_t)(BitMask::DISPLAY_CONTROL_CONTRAST)),
+            (uint8_t)(BitPos::DISPLAY_CONTROL_CONTRAST)
+    );
+
+    // Send command
+    this->_bus()->_sendStart();
+    this->_bus()->_writeByte(data);
+    if(!this->_bus()->_readAck()) {
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    this->_bus()->_sendStop();
+
+    // Update data members
+    this->_showDisplay                  = showDisplay_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::writeDisplayData(cuint16_t displayValue_p, cuint8_t base_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::writeDisplayData(cuint16_t, cuint8_t)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t auxSegments[4] = {0, 0, 0, 0};
+    uint8_t aux8 = 0;
+    uint16_t aux16 = displayValue_p;
+    cuint8_t displayIndex = 0;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - base
+    if((base_p < 2) || (base_p > 16)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Extract digits
+    for(uint8_t i = 0; i < 4; i++) {
+        aux8 = (aux16 % base_p);
+        aux16 /= (uint16_t)base_p;
+        auxSegments[i] = _segments[aux8];
+    }
+
+    // Prepare command
+    aux8 = (uint8_t)Command::DISPLAY_ADDRESS;
+    setMaskOffset(aux8,
+            ((uint8_t)(displayIndex) & (uint8_t)(BitMask::DISPLAY_ADDRESS)),
+            (uint8_t)(BitPos::DISPLAY_ADDRESS)
+    );
+
+    // Writing data to display
+    this->_bus()->_sendStart();
+    this->_bus()->_writeByte(aux8);
+    this->_bus()->_readAck();
+    for(uint8_t i = 0; i < 4; i++) {
+        this->_bus()->_writeByte(auxSegments[3 - i]);
+        this->_bus()->_readAck();
+    }
+    this->_bus()->_sendStop();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::writeDisplayData(cuint8_t segments_p, cuint8_t index_p, cbool_t showDot_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::writeDisplayData(cuint8_t, cuint8_t, cbool_t)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t aux8 = 0;
+    uint8_t auxSegments = segments_p;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - base
+    if((index_p > 4) || (index_p == 0)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Prepare command
+    aux8 = (uint8_t)Command::DISPLAY_ADDRESS;
+    setMaskOffset(aux8,
+            ((uint8_t)(index_p - 1) & (uint8_t)(BitMask::DISPLAY_ADDRESS)),
+            (uint8_t)(BitPos::DISPLAY_ADDRESS)
+    );
+
+    // Check dot
+    if(showDot_p) {
+        auxSegments |= 0x80;
+    }
+
+    // Writing data to display
+    this->_bus()->_sendStart();
+    this->_bus()->_writeByte(aux8);
+    this->_bus()->_readAck();
+    this->_bus()->_writeByte(auxSegments);
+    this->_bus()->_readAck();
+    this->_bus()->_sendStop();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+//     /////////////////////     KEYPAD CONTROL     /////////////////////     //
+
+template <class derived_t>
+bool_t Tm1637Base<derived_t>::readKeypadData(uint8_t *keyPressed_p)
+{
+    // Mark passage for debugging purpose
+    debugMark(PSTR("Tm1637::readKeypadData(uint8_t *)"), Debug::CodeIndex::TM1637_MODULE);
+
+    // FIXME: Implement this function
+
+    // Returns error
+    this->_lastError = Error::NOT_IMPLEMENTED;
+    debugMessage(Error::NOT_IMPLEMENTED, Debug::CodeIndex::TM1637_MODULE);
+    return false;
+}
+
 /**
  * @endcond
 */
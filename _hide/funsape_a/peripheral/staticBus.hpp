@@ -0,0 +1,389 @@
+/**
+ *******************************************************************************
+ * @file            staticBus.hpp
+ * @author          Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+ * @brief           GPIO bus peripheral control, resolved at compile time.
+ * @details         This file provides a template to control a group of pins of
+ *                      a GPIO port whose port and mask are known at compile
+ *                      time, for the FunSAPE++ AVR8 Library.
+ * @date            2025-08-08
+ * @version         25.08
+ * @copyright       MIT License
+ * @note            No notes at this time.
+ * @todo            No itens in todo list yet.
+ *
+ *******************************************************************************
+ * @attention
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Leandro Schwarz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to
+ *      deal in the Software without restriction, including without limitation
+ *      the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *      and/or sell copies of the Software, and to permit persons to whom the
+ *      Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ *      all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *      THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *      OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *      ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *      OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+*/
+
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __STATIC_BUS_HPP
+#define __STATIC_BUS_HPP                2508
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+
+#include "../globalDefines.hpp"
+#if !defined(__GLOBAL_DEFINES_HPP)
+#   error [staticBus.hpp] Error 1 - Header file (globalDefines.hpp) is missing or corrupted!
+#elif __GLOBAL_DEFINES_HPP != __STATIC_BUS_HPP
+#   error [staticBus.hpp] Error 2 - Build mismatch between file (staticBus.hpp) and global definitions file (globalDefines.hpp)!
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+
+#include "gpioBus.hpp"
+#if !defined(__GPIO_BUS_HPP)
+#   error [staticBus.hpp] Error 1 - Header file (gpioBus.hpp) is missing or corrupted!
+#elif __GPIO_BUS_HPP != __STATIC_BUS_HPP
+#   error [staticBus.hpp] Error 5 - Build mismatch between file (staticBus.hpp) and library dependency (gpioBus.hpp)!
+#endif
+
+#include "staticPin.hpp"
+#if !defined(__STATIC_PIN_HPP)
+#   error [staticBus.hpp] Error 1 - Header file (staticPin.hpp) is missing or corrupted!
+#elif __STATIC_PIN_HPP != __STATIC_BUS_HPP
+#   error [staticBus.hpp] Error 5 - Build mismatch between file (staticBus.hpp) and library dependency (staticPin.hpp)!
+#endif
+
+//     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
+
+// NONE
+
+//     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Peripherals"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      Peripherals
+ * @brief           Microcontroller peripherals.
+ * @{
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Peripherals/Gpio"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      Gpio
+ * @brief           General Purpose Intput/Output (GPIO) controller module.
+ * @{
+*/
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Classes
+// =============================================================================
+
+/**
+ * @brief           StaticBus class.
+ * @details         This class manages a group of pins of the same GPIO port,
+ *                      given by a port and a pin mask as template parameters.
+ *                      The pins do not need to be sequential; the data is
+ *                      shifted to the position of the lowest pin of the mask.
+ *                      Single-pin masks compile to @c sbi / @c cbi. Wider masks
+ *                      are updated with a read-modify-write sequence inside an
+ *                      atomic block, except when the mask covers the whole
+ *                      port, which is a single @c out instruction. Toggling
+ *                      writes the mask to the input @c PINx register, so it is
+ *                      always atomic.
+ * @details         Instructions per operation, 4-pin bus:
+ *
+ * | Operation  | StaticBus                                        |
+ * |:-----------|:-------------------------------------------------|
+ * | set()      | @c in, @c ori, @c out, inside an atomic block    |
+ * | clr()      | @c in, @c andi, @c out, inside an atomic block   |
+ * | toggle()   | @c ldi, @c out PINx                              |
+ * | write()    | shift by a constant, then @c in, @c andi, @c or, |
+ * |            | @c out, inside an atomic block                   |
+ * | read()     | @c in, @c andi, shift by a constant              |
+ *
+ *                  @ref GpioBus loads the register pointers, the mask and the
+ *                      pin index from the object and shifts by a variable
+ *                      amount. Neither version has been timed on hardware.
+ *
+ * @code
+ *                  typedef StaticBus<GpioPort::PORT_D, 0xF0> DataBus;
+ *
+ *                  DataBus::setMode(GpioBus::Mode::OUTPUT_PUSH_PULL);
+ *                  DataBus::write(0x0A);
+ * @endcode
+ * @see             StaticStepper, a driver built on this class.
+ * @attention       This class has only static members and must not be
+ *                      instantiated.
+*/
+template <GpioPort port_p, uint8_t pinMask_p>
+class StaticBus
+{
+    static_assert(pinMask_p != 0, "StaticBus mask must have at least one pin");
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    StaticBus(
+            void
+    ) = delete;
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////    BUS RELATED METHODS     /////////////////     //
+
+    /**
+     * @brief       Clears all the StaticBus pins.
+     * @details     This function clears all the pins of the bus in the output
+     *                  @c PORTx register.
+    */
+    static void inlined clr(
+            void
+    )
+    {
+        if(_isSinglePin || (pinMask_p == 0xFF)) {
+            _SFR_MEM8(_regOut) &= (uint8_t)~pinMask_p;
+        } else {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                _SFR_MEM8(_regOut) &= (uint8_t)~pinMask_p;
+            }
+        }
+    }
+
+    /**
+     * @brief       Complements (inverts) all the StaticBus pins.
+     * @details     This function toggles the pins by writing the bus mask to
+     *                  the input @c PINx register.
+    */
+    static void inlined cpl(
+            void
+    )
+    {
+        _SFR_MEM8(_regIn) = pinMask_p;
+    }
+
+    /**
+     * @brief       Sets all the StaticBus pins.
+     * @details     This function is an alias of @ref StaticBus::set().
+    */
+    static void inlined high(
+            void
+    )
+    {
+        set();
+    }
+
+    /**
+     * @brief       Clears all the StaticBus pins.
+     * @details     This function is an alias of @ref StaticBus::clr().
+    */
+    static void inlined low(
+            void
+    )
+    {
+        clr();
+    }
+
+    /**
+     * @brief       Reads the StaticBus value.
+     * @details     This function returns the logic level of the bus pins, read
+     *                  from the input @c PINx register.
+     * @return      the logic values in the bus pins, shiftted to bit position
+     *                  0.
+    */
+    static uint8_t inlined read(
+            void
+    )
+    {
+        return (uint8_t)((_SFR_MEM8(_regIn) & pinMask_p) >> _pinIndex);
+    }
+
+    /**
+     * @brief       Sets all the StaticBus pins.
+     * @details     This function sets all the pins of the bus in the output
+     *                  @c PORTx register.
+    */
+    static void inlined set(
+            void
+    )
+    {
+        if(_isSinglePin || (pinMask_p == 0xFF)) {
+            _SFR_MEM8(_regOut) |= pinMask_p;
+        } else {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                _SFR_MEM8(_regOut) |= pinMask_p;
+            }
+        }
+    }
+
+    /**
+     * @brief       Sets the StaticBus operation mode.
+     * @details     This function sets the GPIO bus operation mode to the given
+     *                  @a mode_p. As in @ref GpioBus::setMode(), changing to
+     *                  @ref GpioBus::Mode::OUTPUT_PUSH_PULL does not change the
+     *                  output @c PORTx register.
+     * @param[in]   mode_p              @ref GpioBus::Mode operation mode.
+    */
+    static void inlined setMode(
+            const GpioBus::Mode mode_p
+    )
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            switch(mode_p) {
+            case GpioBus::Mode::INPUT_FLOATING:
+                _SFR_MEM8(_regDir) &= (uint8_t)~pinMask_p;
+                _SFR_MEM8(_regOut) &= (uint8_t)~pinMask_p;
+                break;
+            case GpioBus::Mode::INPUT_PULLED_UP:
+                _SFR_MEM8(_regDir) &= (uint8_t)~pinMask_p;
+                _SFR_MEM8(_regOut) |= pinMask_p;
+                break;
+            case GpioBus::Mode::OUTPUT_PUSH_PULL:
+                _SFR_MEM8(_regDir) |= pinMask_p;
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief       Complements (inverts) all the StaticBus pins.
+     * @details     This function is an alias of @ref StaticBus::cpl().
+    */
+    static void inlined toggle(
+            void
+    )
+    {
+        cpl();
+    }
+
+    /**
+     * @brief       Writes data at the StaticBus pins.
+     * @details     This function writes the logic levels given by @a data_p at
+     *                  the bus pins. The provided @a data_p must be relative to
+     *                  the bus first pin; bits outside the mask are ignored.
+     * @param[in]   data_p              values to be written at the bus.
+    */
+    static void inlined write(
+            cuint8_t data_p
+    )
+    {
+        if(pinMask_p == 0xFF) {
+            _SFR_MEM8(_regOut) = data_p;
+        } else {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                _SFR_MEM8(_regOut) = (uint8_t)((_SFR_MEM8(_regOut) & (uint8_t)~pinMask_p) |
+                                ((uint8_t)(data_p << _pinIndex) & pinMask_p));
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     //////////////////    HARDWARE LINKAGE     ///////////////////     //
+
+    static cuint8_t _regIn              = (uint8_t)port_p;                      //!< Address of the input @c PINx register.
+    static cuint8_t _regDir             = (uint8_t)port_p + 1;                  //!< Address of the direction @c DDRx register.
+    static cuint8_t _regOut             = (uint8_t)port_p + 2;                  //!< Address of the output @c PORTx register.
+    static cuint8_t _pinIndex           = (uint8_t)__builtin_ctz(pinMask_p);    //!< Position of the lowest pin.
+    static cbool_t  _isSinglePin        = ((pinMask_p & (pinMask_p - 1)) == 0); //!< Single pin mask flag.
+
+}; // class StaticBus
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Peripherals/Gpio"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+* @}
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Peripherals"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @}
+*/
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __STATIC_BUS_HPP
+
+// =============================================================================
+// End of file (staticBus.hpp)
+// =============================================================================
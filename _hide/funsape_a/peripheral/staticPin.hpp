@@ -0,0 +1,379 @@
+/**
+ *******************************************************************************
+ * @file            staticPin.hpp
+ * @author          Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+ * @brief           GPIO single pin peripheral control, resolved at compile
+ *                      time.
+ * @details         This file provides a template to control a single GPIO pin
+ *                      whose port and position are known at compile time, for
+ *                      the FunSAPE++ AVR8 Library. Each operation compiles to a
+ *                      single I/O instruction.
+ * @date            2025-08-08
+ * @version         25.08
+ * @copyright       MIT License
+ * @note            No notes at this time.
+ * @todo            No itens in todo list yet.
+ *
+ *******************************************************************************
+ * @attention
+ *
+ * MIT License
+ *
+ * Copyright (c) 2025 Leandro Schwarz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ *      of this software and associated documentation files (the "Software"), to
+ *      deal in the Software without restriction, including without limitation
+ *      the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ *      and/or sell copies of the Software, and to permit persons to whom the
+ *      Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ *      all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ *      THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *      OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *      ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *      OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *******************************************************************************
+*/
+
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __STATIC_PIN_HPP
+#define __STATIC_PIN_HPP                2508
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+
+#include "../globalDefines.hpp"
+#if !defined(__GLOBAL_DEFINES_HPP)
+#   error [staticPin.hpp] Error 1 - Header file (globalDefines.hpp) is missing or corrupted!
+#elif __GLOBAL_DEFINES_HPP != __STATIC_PIN_HPP
+#   error [staticPin.hpp] Error 2 - Build mismatch between file (staticPin.hpp) and global definitions file (globalDefines.hpp)!
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+
+#include "gpioPin.hpp"
+#if !defined(__GPIO_PIN_HPP)
+#   error [staticPin.hpp] Error 1 - Header file (gpioPin.hpp) is missing or corrupted!
+#elif __GPIO_PIN_HPP != __STATIC_PIN_HPP
+#   error [staticPin.hpp] Error 5 - Build mismatch between file (staticPin.hpp) and library dependency (gpioPin.hpp)!
+#endif
+
+//     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
+
+// NONE
+
+//     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Peripherals"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      Peripherals
+ * @brief           Microcontroller peripherals.
+ * @{
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Peripherals/Gpio"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @addtogroup      Gpio
+ * @brief           General Purpose Intput/Output (GPIO) controller module.
+ * @{
+*/
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+/**
+ * @enum            GpioPort
+ * @brief           GPIO port enumeration.
+ * @details         Data memory address of the input @c PINx register of each
+ *                      GPIO port. The direction @c DDRx and output @c PORTx
+ *                      registers are located at the next two addresses.
+*/
+enum class GpioPort : uint8_t {
+#if defined(_FUNSAPE_GPIO_PORT_B_EXISTS)
+    PORT_B          = 0x23,         //!< GPIO port B
+#endif
+#if defined(_FUNSAPE_GPIO_PORT_C_EXISTS)
+    PORT_C          = 0x26,         //!< GPIO port C
+#endif
+#if defined(_FUNSAPE_GPIO_PORT_D_EXISTS)
+    PORT_D          = 0x29,         //!< GPIO port D
+#endif
+};
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Classes
+// =============================================================================
+
+/**
+ * @brief           StaticPin class.
+ * @details         This class manages a single GPIO pin whose port and position
+ *                      are template parameters. Since the register addresses
+ *                      and the bit position are constants, the compiler emits
+ *                      a single I/O instruction for each operation, which is
+ *                      also atomic, so the pin can be shared with interrupt
+ *                      handlers.
+ * @details         Instruction per operation, for the I/O addresses of the
+ *                      ATmega48/88/168/328 ports:
+ *
+ * | Operation  | StaticPin                  |
+ * |:-----------|:---------------------------|
+ * | set()      | @c sbi PORTx               |
+ * | clr()      | @c cbi PORTx               |
+ * | toggle()   | @c ldi, @c out PINx        |
+ * | read()     | @c in PINx, or @c sbis /   |
+ * |            | @c sbic in a condition     |
+ *
+ *                  @ref GpioPin loads the register pointers and the mask from
+ *                      the object and does a read-modify-write. Neither
+ *                      version has been timed on hardware.
+ *
+ * @code
+ *                  typedef StaticPin<GpioPort::PORT_B, GpioPin::PinIndex::P5> LedPin;
+ *
+ *                  LedPin::setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+ *                  LedPin::toggle();
+ * @endcode
+ * @see             StaticTm1637 and StaticSn74595, drivers built on this
+ *                      class.
+ * @attention       This class has only static members and must not be
+ *                      instantiated.
+*/
+template <GpioPort port_p, GpioPin::PinIndex pinIndex_p>
+class StaticPin
+{
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+
+public:
+    StaticPin(
+            void
+    ) = delete;
+
+    // -------------------------------------------------------------------------
+    // Methods - class own methods ---------------------------------------------
+
+public:
+    //     /////////////////    PIN RELATED METHODS     /////////////////     //
+
+    /**
+     * @brief       Clears the StaticPin pin.
+     * @details     This function clears the pin bit in the output @c PORTx
+     *                  register (@c cbi instruction).
+    */
+    static void inlined clr(
+            void
+    )
+    {
+        _SFR_MEM8(_regOut) &= (uint8_t)~_pinMask;
+    }
+
+    /**
+     * @brief       Complements (inverts) the StaticPin pin.
+     * @details     This function toggles the pin by writing logic one to the
+     *                  pin bit in the input @c PINx register (@c out
+     *                  instruction), so no read-modify-write is done.
+    */
+    static void inlined cpl(
+            void
+    )
+    {
+        _SFR_MEM8(_regIn) = _pinMask;
+    }
+
+    /**
+     * @brief       Sets the StaticPin pin.
+     * @details     This function is an alias of @ref StaticPin::set().
+    */
+    static void inlined high(
+            void
+    )
+    {
+        set();
+    }
+
+    /**
+     * @brief       Clears the StaticPin pin.
+     * @details     This function is an alias of @ref StaticPin::clr().
+    */
+    static void inlined low(
+            void
+    )
+    {
+        clr();
+    }
+
+    /**
+     * @brief       Reads the StaticPin value.
+     * @details     This function returns the logic level of the pin, read from
+     *                  the input @c PINx register.
+     * @retval      true                if the pin is in @ref LogicLevel::HIGH.
+     * @retval      false               if the pin is in @ref LogicLevel::LOW.
+    */
+    static bool_t inlined read(
+            void
+    )
+    {
+        return (bool_t)((_SFR_MEM8(_regIn) & _pinMask) != 0);
+    }
+
+    /**
+     * @brief       Sets the StaticPin pin.
+     * @details     This function sets the pin bit in the output @c PORTx
+     *                  register (@c sbi instruction).
+    */
+    static void inlined set(
+            void
+    )
+    {
+        _SFR_MEM8(_regOut) |= _pinMask;
+    }
+
+    /**
+     * @brief       Sets the StaticPin operation mode.
+     * @details     This function sets the GPIO pin operation mode to the given
+     *                  @a mode_p. As in @ref GpioPin::setMode(), changing to
+     *                  @ref GpioPin::Mode::OUTPUT_PUSH_PULL does not change the
+     *                  output @c PORTx register.
+     * @param[in]   mode_p              @ref GpioPin::Mode operation mode.
+    */
+    static void inlined setMode(
+            const GpioPin::Mode mode_p
+    )
+    {
+        switch(mode_p) {
+        case GpioPin::Mode::INPUT_FLOATING:
+            _SFR_MEM8(_regDir) &= (uint8_t)~_pinMask;
+            _SFR_MEM8(_regOut) &= (uint8_t)~_pinMask;
+            break;
+        case GpioPin::Mode::INPUT_PULLED_UP:
+            _SFR_MEM8(_regDir) &= (uint8_t)~_pinMask;
+            _SFR_MEM8(_regOut) |= _pinMask;
+            break;
+        case GpioPin::Mode::OUTPUT_PUSH_PULL:
+            _SFR_MEM8(_regDir) |= _pinMask;
+            break;
+        }
+    }
+
+    /**
+     * @brief       Complements (inverts) the StaticPin pin.
+     * @details     This function is an alias of @ref StaticPin::cpl().
+    */
+    static void inlined toggle(
+            void
+    )
+    {
+        cpl();
+    }
+
+    /**
+     * @brief       Writes a logic level at the StaticPin pin.
+     * @details     This function sets or clears the pin according to
+     *                  @a level_p. When @a level_p is a constant, it compiles
+     *                  to a single instruction.
+     * @param[in]   level_p             logic level to be written.
+    */
+    static void inlined write(
+            cbool_t level_p
+    )
+    {
+        if(level_p) {
+            set();
+        } else {
+            clr();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+
+private:
+    //     //////////////////    HARDWARE LINKAGE     ///////////////////     //
+
+    static cuint8_t _regIn              = (uint8_t)port_p;                      //!< Address of the input @c PINx register.
+    static cuint8_t _regDir             = (uint8_t)port_p + 1;                  //!< Address of the direction @c DDRx register.
+    static cuint8_t _regOut             = (uint8_t)port_p + 2;                  //!< Address of the output @c PORTx register.
+    static cuint8_t _pinMask            = (uint8_t)(1 << (uint8_t)pinIndex_p);  //!< Pin mask.
+
+}; // class StaticPin
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Peripherals/Gpio"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+* @}
+*/
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Peripherals"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @}
+*/
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __STATIC_PIN_HPP
+
+// =============================================================================
+// End of file (staticPin.hpp)
+// =============================================================================
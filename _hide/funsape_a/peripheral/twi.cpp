@@ -136,10 +136,10 @@ Twi::~Twi()
 
 //     //////////////////////    DATA TRANSFER     //////////////////////     //
 
-bool_t Twi::read(uint8_t *buffData_p, cuint8_t buffSize_p)
+bool_t Twi::read(uint8_t *buffData_p, cuint16_t buffSize_p)
 {
     // Mark passage for debugging purpose
-    debugMark(PSTR("Twi::read(uint8_t *, cuint8_t)"), Debug::CodeIndex::TWI_MODULE);
+    debugMark(PSTR("Twi::read(uint8_t *, cuint16_t)"), Debug::CodeIndex::TWI_MODULE);
 
     // Checks for errors - Device address not set
     if(!this->_devAddressSet) {
@@ -213,10 +213,10 @@ bool_t Twi::read(uint8_t *buffData_p, cuint8_t buffSize_p)
     return true;
 }
 
-bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint8_t buffSize_p)
+bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint16_t buffSize_p)
 {
     // Mark passage for debugging purpose
-    debugMark(PSTR("Twi::readReg(cuint8_t, uint8_t *, cuint8_t)"), Debug::CodeIndex::TWI_MODULE);
+    debugMark(PSTR("Twi::readReg(cuint8_t, uint8_t *, cuint16_t)"), Debug::CodeIndex::TWI_MODULE);
 
     // Local variables
     bool_t auxBool                      = false;
@@ -229,6 +229,14 @@ bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint8_t buffSize_p)
         return false;
     }
 
+    // Check for errors - Message size (_sendData() takes an 8-bit size)
+    if(buffSize_p > TWI_BUFFER_SIZE) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        debugMessage(Error::BUFFER_SIZE_TOO_LARGE, Debug::CodeIndex::TWI_MODULE);
+        return false;
+    }
+
     // Sends data
     if(this->_useLongAddress) {
         // FIXME - implement support to 10-bit address
@@ -237,7 +245,7 @@ bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint8_t buffSize_p)
         debugMessage(Error::NOT_IMPLEMENTED, Debug::CodeIndex::TWI_MODULE);
         return false;
     } else {
-        auxBool = this->_sendData((uint8_t)this->_devAddress, Operation::READ, reg_p, buffData_p, buffSize_p);
+        auxBool = this->_sendData((uint8_t)this->_devAddress, Operation::READ, reg_p, buffData_p, (uint8_t)buffSize_p);
     }
 
     // Error - Communication error
@@ -253,10 +261,10 @@ bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint8_t buffSize_p)
     return true;
 }
 
-bool_t Twi::write(uint8_t *buffData_p, cuint8_t buffSize_p)
+bool_t Twi::write(uint8_t *buffData_p, cuint16_t buffSize_p)
 {
     // Mark passage for debugging purpose
-    debugMark(PSTR("Twi::write(uint8_t *, cuint8_t)"), Debug::CodeIndex::TWI_MODULE);
+    debugMark(PSTR("Twi::write(uint8_t *, cuint16_t)"), Debug::CodeIndex::TWI_MODULE);
 
     // Local variables
     uint8_t auxRegAddress = 0;
@@ -314,7 +322,7 @@ bool_t Twi::write(uint8_t *buffData_p, cuint8_t buffSize_p)
 
     // Prepares transmission buffer
     auxRegAddress = buffData_p[0];
-    for(uint8_t i = 0; i < (buffSize_p - 1); i++) {
+    for(uint16_t i = 0; i < (buffSize_p - 1); i++) {
         auxBuff[i]
             = buffData_p[i + 1];
     }
@@ -332,10 +340,10 @@ bool_t Twi::write(uint8_t *buffData_p, cuint8_t buffSize_p)
     return true;
 }
 
-bool_t Twi::writeReg(cuint8_t reg_p, cuint8_t *buffData_p, cuint8_t buffSize_p)
+bool_t Twi::writeReg(cuint8_t reg_p, cuint8_t *buffData_p, cuint16_t buffSize_p)
 {
     // Mark passage for debugging purpose
-    debugMark(PSTR("Twi::writeReg(cuint8_t, cuint8_t *, cuint8_t)"), Debug::CodeIndex::TWI_MODULE);
+    debugMark(PSTR("Twi::writeReg(cuint8_t, cuint8_t *, cuint16_t)"), Debug::CodeIndex::TWI_MODULE);
 
     // Local variables
     bool_t auxBool                      = false;
@@ -348,6 +356,14 @@ bool_t Twi::writeReg(cuint8_t reg_p, cuint8_t *buffData_p, cuint8_t buffSize_p)
         return false;
     }
 
+    // Check for errors - Message size (_sendData() takes an 8-bit size)
+    if(buffSize_p > TWI_BUFFER_SIZE) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        debugMessage(Error::BUFFER_SIZE_TOO_LARGE, Debug::CodeIndex::TWI_MODULE);
+        return false;
+    }
+
     // Sends data
     if(this->_useLongAddress) {
         // FIXME - implement support to 10-bit address
@@ -356,7 +372,7 @@ bool_t Twi::writeReg(cuint8_t reg_p, cuint8_t *buffData_p, cuint8_t buffSize_p)
         debugMessage(Error::NOT_IMPLEMENTED, Debug::CodeIndex::TWI_MODULE);
         return false;
     } else {
-        auxBool = this->_sendData((uint8_t)this->_devAddress, Operation::WRITE, reg_p, (uint8_t *)buffData_p, buffSize_p);
+        auxBool = this->_sendData((uint8_t)this->_devAddress, Operation::WRITE, reg_p, (uint8_t *)buffData_p, (uint8_t)buffSize_p);
     }
 
     // Error - Communication error
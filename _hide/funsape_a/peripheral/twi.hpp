@@ -161,7 +161,7 @@ void twiInterruptCallback(void);
  *                      neither recommended to create another object of this
  *                      class.
  */
-class Twi
+class Twi : public Bus
 {
     // -------------------------------------------------------------------------
     // New data types ----------------------------------------------------------
@@ -280,8 +280,8 @@ public:
      */
     bool_t read(
             uint8_t     *buffData_p,
-            cuint8_t    buffSize_p      = 1
-    );
+            cuint16_t   buffSize_p      = 1
+    ) override;
 
     /**
      * @brief       Reads data from an address.
@@ -310,8 +310,8 @@ public:
     bool_t readReg(
             cuint8_t    reg_p,
             uint8_t     *buffData_p,
-            cuint8_t    buffSize_p      = 1
-    );
+            cuint16_t   buffSize_p      = 1
+    ) override;
 
     /**
      * @brief       Writes data.
@@ -338,8 +338,8 @@ public:
      */
     bool_t write(
             uint8_t     *buffData_p,
-            cuint8_t    buffSize_p      = 1
-    );
+            cuint16_t   buffSize_p      = 1
+    ) override;
 
     /**
      * @brief       Writes data at an address.
@@ -368,8 +368,8 @@ public:
     bool_t writeReg(
             cuint8_t    reg_p,
             cuint8_t    *buffData_p,
-            cuint8_t    buffSize_p      = 1
-    );
+            cuint16_t   buffSize_p      = 1
+    ) override;
 
     //     //////////////////    PROTOCOL SPECIFIC     //////////////////     //
 
@@ -391,7 +391,7 @@ public:
     bool_t setDevice(
             cuint16_t address_p,
             cbool_t useLongAddress_p = false
-    );
+    ) override;
 
     //     /////////////////     CONTROL AND STATUS     /////////////////     //
 
@@ -408,7 +408,7 @@ public:
      */
     Bus::BusType inlined getBusType(
             void
-    );
+    ) override;
 
     /**
      * @brief       Returns the last error.
@@ -417,7 +417,7 @@ public:
      */
     Error inlined getLastError(
             void
-    );
+    ) override;
 
 protected:
     // NONE
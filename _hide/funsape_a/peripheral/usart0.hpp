@@ -69,12 +69,12 @@
 #   error [usart0.hpp] Error 5 - Build mismatch between file (usart0.hpp) and library dependency (debug.hpp)!
 #endif
 
-// #include "../util/bus.hpp"
-// #if !defined(__BUS_HPP)
-// #   error [usart0.hpp] Error 1 - Header file (bus.hpp) is missing or corrupted!
-// #elif __BUS_HPP != __USART0_HPP
-// #   error [usart0.hpp] Error 5 - Build mismatch between file (usart0.hpp) and library dependency (bus.hpp)!
-// #endif
+#include "../util/bus.hpp"
+#if !defined(__BUS_HPP)
+#   error [usart0.hpp] Error 1 - Header file (bus.hpp) is missing or corrupted!
+#elif __BUS_HPP != __USART0_HPP
+#   error [usart0.hpp] Error 5 - Build mismatch between file (usart0.hpp) and library dependency (bus.hpp)!
+#endif
 
 #include "../util/systemStatus.hpp"
 #if !defined(__SYSTEM_STATUS_HPP)
@@ -188,9 +188,13 @@ void usart0TransmissionCompleteCallback(void);
  *                      a global object. Therefore, there is not necessary,
  *                      neither recommended to create another object of this
  *                      class.
+ * @note            When initialized in one of the @ref Mode::MASTER_SPI_MODE_0
+ *                      to @ref Mode::MASTER_SPI_MODE_3 modes, the object can be
+ *                      used as a @ref Bus by SPI device drivers. The slave
+ *                      select pin is not handled by this class and must be
+ *                      driven by the device driver.
 */
-class Usart0
-// : public Bus
+class Usart0 : public Bus
 {
     // -------------------------------------------------------------------------
     // New data types ----------------------------------------------------------
@@ -415,6 +419,114 @@ public:
             void
     );
 
+    /**
+     * @brief       Returns the bus type.
+     * @details     Returns @ref Bus::BusType::SPI when the peripheral is set in
+     *                  one of the master SPI modes, and
+     *                  @ref Bus::BusType::UART otherwise.
+     * @return      the bus type @ref Bus::BusType.
+    */
+    Bus::BusType getBusType(
+            void
+    );
+
+    /**
+     * @brief       Reads data from a register in master SPI mode.
+     * @details     Transmits the register address and then clocks in
+     *                  @a buffSize_p bytes, transmitting zeros. Any read flag
+     *                  required by the device must already be set at
+     *                  @a reg_p, and the chip select is handled by the caller.
+     * @param[in]   reg_p               Register address.
+     * @param[out]  buffData_p          Pointer to the data buffer.
+     * @param[in]   buffSize_p          Number of bytes to read.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     * @see         sendData(uint8_t *, cuint16_t).
+    */
+    bool_t readReg(
+            cuint8_t reg_p,
+            uint8_t *buffData_p,
+            cuint16_t buffSize_p
+    );
+
+    /**
+     * @brief       Exchanges a block of data in master SPI mode.
+     * @details     Each byte of the buffer is transmitted and replaced, in
+     *                  place, by the byte received in the same frame.
+     * @param[in,out] buffData_p        Pointer to the data buffer.
+     * @param[in]   buffSize_p          Number of bytes to exchange.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     * @par Error codes:
+     *
+     * | Error code                      | Meaning                                      |
+     * |:--------------------------------|:---------------------------------------------|
+     * | @ref Error::NONE                | Success. No erros were detected.             |
+     * | @ref Error::NOT_INITIALIZED     | The peripheral was not initialized.          |
+     * | @ref Error::MODE_NOT_SUPPORTED  | The peripheral is not in a master SPI mode.  |
+     * | @ref Error::ARGUMENT_POINTER_NULL | @a buffData_p pointer is a null pointer.   |
+     *
+    */
+    bool_t sendData(
+            uint8_t *buffData_p,
+            cuint16_t buffSize_p
+    );
+
+    /**
+     * @brief       Exchanges a block of data in master SPI mode.
+     * @details     Transmits the bytes of @a txBuffData_p and stores the bytes
+     *                  received in the same frames at @a rxBuffData_p.
+     * @param[in]   txBuffData_p        Pointer to the transmission buffer.
+     * @param[out]  rxBuffData_p        Pointer to the reception buffer.
+     * @param[in]   buffSize_p          Number of bytes to exchange.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     * @see         sendData(uint8_t *, cuint16_t).
+    */
+    bool_t sendData(
+            cuint8_t *txBuffData_p,
+            uint8_t *rxBuffData_p,
+            cuint16_t buffSize_p
+    );
+
+    /**
+     * @brief       Writes a block of data in master SPI mode.
+     * @details     Transmits the bytes of the buffer, discarding the received
+     *                  ones. The buffer is not modified.
+     * @param[in]   buffData_p          Pointer to the data buffer.
+     * @param[in]   buffSize_p          Number of bytes to write.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     * @see         sendData(uint8_t *, cuint16_t).
+    */
+    bool_t write(
+            uint8_t *buffData_p,
+            cuint16_t buffSize_p
+    );
+
+    /**
+     * @brief       Writes data at a register in master SPI mode.
+     * @details     Transmits the register address followed by the bytes of
+     *                  the buffer, discarding the received ones. The chip
+     *                  select is handled by the caller.
+     * @param[in]   reg_p               Register address.
+     * @param[in]   buffData_p          Pointer to the data buffer.
+     * @param[in]   buffSize_p          Number of bytes to write.
+     * @retval      true                if success.
+     * @retval      false               if an error occurred. Retrieve the error
+     *                                      by calling @ref getLastError().
+     * @see         sendData(uint8_t *, cuint16_t).
+    */
+    bool_t writeReg(
+            cuint8_t reg_p,
+            cuint8_t *buffData_p,
+            cuint16_t buffSize_p
+    );
+
 protected:
     // NONE
 
@@ -763,6 +875,16 @@ private:
             FILE *stream_p
     );
 
+    bool_t _exchangeSpi(
+            cuint8_t *txBuffData_p,
+            uint8_t *rxBuffData_p,
+            cuint16_t buffSize_p
+    );
+
+    bool_t _isMasterSpiMode(
+            void
+    );
+
     /**
      * @endcond
     */
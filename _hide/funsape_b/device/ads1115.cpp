@@ -20,11 +20,16 @@
 #    error "Version mismatch between source and header files!"
 #endif
 
+#if defined(_FUNSAPE_PLATFORM_AVR)
+#   include <util/atomic.h>
+#endif
+
 // =============================================================================
 // File exclusive - Constants
 // =============================================================================
 
-// NONE
+cint16_t constAds1115ReadyLowThreshold  = 0x0000;   // Lo_thresh MSB = 0 ...
+cint16_t constAds1115ReadyHighThreshold = (int16_t)0x8000;  // ... and Hi_thresh MSB = 1 select RDY
 
 // =============================================================================
 // File exclusive - New data types
@@ -64,6 +69,17 @@ Ads1115::Ads1115(void)
     this->_readyPinIsLatched            = false;
     this->_isInitialized                = false;
     this->_triggerConversion            = false;
+    this->_inputsCount                  = 0;
+    this->_isContinuous                 = false;
+    this->_convInput                    = 0;
+    this->_nextInput                    = 0;
+    this->_readInput                    = 0;
+    this->_writeInput                   = 0;
+    this->_discardCount                 = 0;
+    this->_transferStep                 = TransferStep::IDLE;
+    this->_sampleHead                   = 0;
+    this->_sampleTail                   = 0;
+    this->_overrunCount                 = 0;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -109,6 +125,17 @@ bool_t Ads1115::init(Bus *busHandler_p, const DeviceAddress deviceAddress_p)
     this->_readyPinIsLatched            = false;
     this->_isInitialized                = false;
     this->_triggerConversion            = false;
+    this->_inputsCount                  = 0;
+    this->_isContinuous                 = false;
+    this->_convInput                    = 0;
+    this->_nextInput                    = 0;
+    this->_readInput                    = 0;
+    this->_writeInput                   = 0;
+    this->_discardCount                 = 0;
+    this->_transferStep                 = TransferStep::IDLE;
+    this->_sampleHead                   = 0;
+    this->_sampleTail                   = 0;
+    this->_overrunCount                 = 0;
 
     // Check function arguments for errors
     if(!isPointerValid(busHandler_p)) {
@@ -525,6 +552,254 @@ bool_t Ads1115::startSingleConversion(void)
     return true;
 }
 
+bool_t Ads1115::startContinuous(const Input *inputs_p, cuint8_t inputsCount_p, const Mode mode_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ads1115::startContinuous(const Input *, cuint8_t, const Mode)", Debug::CodeIndex::ADS1115_MODULE);
+
+    // Local variables
+    uint8_t auxBuff[2];
+    Channel auxChannel;
+    Reference auxReference;
+
+    // Checks initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - the transfer chain calls Twi::startTransfer()
+    if(this->_busHandler->getBusType() != Bus::BusType::TWI) {
+        // Returns error
+        this->_lastError = Error::BUS_HANDLER_NOT_SUPPORTED;
+        debugMessage(Error::BUS_HANDLER_NOT_SUPPORTED, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - invalid pointers
+    if(!isPointerValid(inputs_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - invalid arguments
+    if((inputsCount_p == 0) || (inputsCount_p > constAds1115MaxInputs) || (mode_p == Mode::SINGLE_SHOT)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+
+    // Stops a running list
+    if(this->_isContinuous) {
+        if(!this->stopContinuous()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+            return false;
+        }
+    }
+
+    // Comparator as conversion ready pin
+    if(!this->setComparatorLowThreshold(constAds1115ReadyLowThreshold)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    if(!this->setComparatorHighThreshold(constAds1115ReadyHighThreshold)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+
+    // Encodes the configuration of each input
+    this->_mode                         = mode_p;
+    this->_comparatorMode               = ComparatorMode::TRADITIONAL_AFTER_1_CONVERSION;
+    this->_readyPinActiveLevel          = LogicLevel::LOW;
+    this->_readyPinIsLatched            = false;
+    auxChannel                          = this->_channel;
+    auxReference                        = this->_fullScaleReference;
+    for(uint8_t i = 0; i < inputsCount_p; i++) {
+        this->_channel                  = inputs_p[i].channel;
+        this->_fullScaleReference       = inputs_p[i].reference;
+        this->_encodeConfig(this->_inputConfig[i]);
+    }
+    this->_channel                      = auxChannel;
+    this->_fullScaleReference           = auxReference;
+    this->_inputsCount                  = inputsCount_p;
+
+    // Resets data members
+    this->_transferStep                 = TransferStep::IDLE;
+    this->_sampleHead                   = 0;
+    this->_sampleTail                   = 0;
+    this->_overrunCount                 = 0;
+    // First result is dropped, in case its pulse came before the start
+    this->_discardCount                 = 1;
+
+    // Starts converting the first input and queues the second one
+    if(!this->_busHandler->setDevice(this->_deviceAddress)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    if(!this->_busHandler->writeReg((uint8_t)Register::CONFIG, this->_inputConfig[0], 2)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    this->_convInput = 0;
+    this->_nextInput = 0;
+    if(inputsCount_p > 1) {
+        if(!this->_busHandler->writeReg((uint8_t)Register::CONFIG, this->_inputConfig[1], 2)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+            return false;
+        }
+        this->_nextInput = 1;
+    } else {
+        // Leaves the pointer at the conversion register
+        if(!this->_busHandler->readReg((uint8_t)Register::CONVERSION, auxBuff, 2)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+            return false;
+        }
+    }
+
+    // Enables the interrupt handler
+    this->_isContinuous = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::ADS1115_MODULE);
+    return true;
+}
+
+bool_t Ads1115::stopContinuous(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ads1115::stopContinuous(void)", Debug::CodeIndex::ADS1115_MODULE);
+
+    // Checks initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+
+    // Disables the interrupt handler and waits the last transfer
+    this->_isContinuous = false;
+    for(uint16_t i = 0; this->_transferStep != TransferStep::IDLE; i++) {
+        if(i >= (constAds1115StopTimeoutUs / 10)) {
+            // Returns error
+            this->_lastError = Error::COMMUNICATION_TIMEOUT;
+            debugMessage(Error::COMMUNICATION_TIMEOUT, Debug::CodeIndex::ADS1115_MODULE);
+            return false;
+        }
+        delayUs(10);
+    }
+
+    // Powers down the device
+    this->_mode                         = Mode::SINGLE_SHOT;
+    this->_comparatorMode               = ComparatorMode::DISABLED;
+    if(!this->_configDevice()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::ADS1115_MODULE);
+    return true;
+}
+
+bool_t Ads1115::getSample(int16_t *value_p, uint8_t *inputIndex_p)
+{
+    // Local variables
+    uint8_t auxIndex;
+
+    // CHECK FOR ERROR - invalid pointers
+    if((!isPointerValid(value_p)) || (!isPointerValid(inputIndex_p))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::ADS1115_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - no sample
+    if(this->_sampleHead == this->_sampleTail) {
+        // Returns error
+        this->_lastError = Error::BUFFER_EMPTY;
+        return false;
+    }
+
+    // Pops sample
+    auxIndex = this->_sampleTail & (ADS1115_SAMPLE_QUEUE_SIZE - 1);
+    *value_p = this->_sampleValue[auxIndex];
+    *inputIndex_p = this->_sampleInput[auxIndex];
+    this->_sampleTail++;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+uint16_t Ads1115::getOverrunCount(void)
+{
+    // Local variables
+    uint16_t auxCount;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        auxCount = this->_overrunCount;
+        this->_overrunCount = 0;
+    }
+
+    return auxCount;
+}
+
+void Ads1115::interruptHandler(void)
+{
+    // Local variables
+    uint8_t auxFinished;
+
+    // CHECK - not running
+    if(!this->_isContinuous) {
+        return;
+    }
+
+    // The new conversion uses the last configuration written
+    auxFinished = this->_convInput;
+    this->_convInput = this->_nextInput;
+
+    // CHECK - previous transfer still running; its result and the next one
+    //     have an unknown input
+    if(this->_transferStep != TransferStep::IDLE) {
+        if(this->_overrunCount < 0xFFFF) {
+            this->_overrunCount++;
+        }
+        this->_discardCount = 2;
+        return;
+    }
+
+    // Starts reading the result
+    this->_readInput = auxFinished;
+    if(this->_inputsCount == 1) {
+        this->_startTransferStep(TransferStep::READ_CONVERSION);
+    } else {
+        this->_writeInput = this->_convInput + 1;
+        if(this->_writeInput == this->_inputsCount) {
+            this->_writeInput = 0;
+        }
+        this->_startTransferStep(TransferStep::WRITE_CONFIG);
+    }
+
+    return;
+}
+
 // =============================================================================
 // Class private methods
 // =============================================================================
@@ -535,62 +810,160 @@ bool_t Ads1115::_configDevice(void)
     uint8_t auxBuff[2];
 
     // Prepares Buffer
-    auxBuff[0] = this->_triggerConversion << 7;
+    this->_encodeConfig(auxBuff);
+
+    if(!this->_busHandler->setDevice(this->_deviceAddress)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        return false;
+    }
+    if(!this->_busHandler->writeReg((uint8_t)Register::CONFIG, auxBuff, 2)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+void Ads1115::_encodeConfig(uint8_t *buff_p)
+{
+    // Prepares Buffer
+    buff_p[0] = this->_triggerConversion << 7;
     this->_triggerConversion = false;
-    auxBuff[0] |= (uint8_t)(this->_channel) << 4;
-    auxBuff[0] |= (uint8_t)(this->_fullScaleReference) << 1;
-    auxBuff[0] |= (this->_mode == Mode::SINGLE_SHOT) ? 1 : 0;
+    buff_p[0] |= (uint8_t)(this->_channel) << 4;
+    buff_p[0] |= (uint8_t)(this->_fullScaleReference) << 1;
+    buff_p[0] |= (this->_mode == Mode::SINGLE_SHOT) ? 1 : 0;
 
-    auxBuff[1] = ((this->_mode == Mode::SINGLE_SHOT) ? 0x0C : (uint8_t)(this->_mode)) << 5;
-    auxBuff[1] |= ((this->_readyPinActiveLevel == LogicLevel::LOW) ? 0 : 1) << 3;
-    auxBuff[1] |= this->_readyPinIsLatched << 2;
+    buff_p[1] = ((this->_mode == Mode::SINGLE_SHOT) ? 0x0C : (uint8_t)(this->_mode)) << 5;
+    buff_p[1] |= ((this->_readyPinActiveLevel == LogicLevel::LOW) ? 0 : 1) << 3;
+    buff_p[1] |= this->_readyPinIsLatched << 2;
     switch(this->_comparatorMode) {
     case ComparatorMode::DISABLED:
-        auxBuff[1] |= 0 << 4;
-        auxBuff[1] |= 3 << 0;
+        buff_p[1] |= 0 << 4;
+        buff_p[1] |= 3 << 0;
         break;
     case ComparatorMode::TRADITIONAL_AFTER_1_CONVERSION:
-        auxBuff[1] |= 0 << 4;
-        auxBuff[1] |= 0 << 0;
+        buff_p[1] |= 0 << 4;
+        buff_p[1] |= 0 << 0;
         break;
     case ComparatorMode::TRADITIONAL_AFTER_2_CONVERSIONS:
-        auxBuff[1] |= 0 << 4;
-        auxBuff[1] |= 1 << 0;
+        buff_p[1] |= 0 << 4;
+        buff_p[1] |= 1 << 0;
         break;
     case ComparatorMode::TRADITIONAL_AFTER_4_CONVERSIONS:
-        auxBuff[1] |= 0 << 4;
-        auxBuff[1] |= 2 << 0;
+        buff_p[1] |= 0 << 4;
+        buff_p[1] |= 2 << 0;
         break;
     case ComparatorMode::WINDOW_AFTER_1_CONVERSION:
-        auxBuff[1] |= 1 << 4;
-        auxBuff[1] |= 0 << 0;
+        buff_p[1] |= 1 << 4;
+        buff_p[1] |= 0 << 0;
         break;
     case ComparatorMode::WINDOW_AFTER_2_CONVERSIONS:
-        auxBuff[1] |= 1 << 4;
-        auxBuff[1] |= 1 << 0;
+        buff_p[1] |= 1 << 4;
+        buff_p[1] |= 1 << 0;
         break;
     case ComparatorMode::WINDOW_AFTER_4_CONVERSIONS:
-        auxBuff[1] |= 1 << 4;
-        auxBuff[1] |= 2 << 0;
+        buff_p[1] |= 1 << 4;
+        buff_p[1] |= 2 << 0;
         break;
     }
 
-    if(!this->_busHandler->setDevice(this->_deviceAddress)) {
-        // Returns error
-        this->_lastError = this->_busHandler->getLastError();
+    return;
+}
+
+bool_t Ads1115::_startTransferStep(const TransferStep step_p)
+{
+    // Local variables - startContinuous() only accepts TWI bus handlers
+    Twi *auxTwi = (Twi *)(this->_busHandler);
+    Twi::Operation auxOperation = Twi::Operation::WRITE;
+    uint8_t auxSize = 0;
+
+    // Prepares buffer
+    switch(step_p) {
+    case TransferStep::WRITE_CONFIG:
+        this->_transferBuffer[0] = (uint8_t)Register::CONFIG;
+        this->_transferBuffer[1] = this->_inputConfig[this->_writeInput][0];
+        this->_transferBuffer[2] = this->_inputConfig[this->_writeInput][1];
+        auxSize = 3;
+        break;
+    case TransferStep::WRITE_POINTER:
+        this->_transferBuffer[0] = (uint8_t)Register::CONVERSION;
+        auxSize = 1;
+        break;
+    case TransferStep::READ_CONVERSION:
+        auxOperation = Twi::Operation::READ;
+        auxSize = 2;
+        break;
+    default:
+        this->_transferStep = TransferStep::IDLE;
         return false;
     }
-    if(!this->_busHandler->writeReg((uint8_t)Register::CONFIG, auxBuff, 2)) {
-        // Returns error
-        this->_lastError = this->_busHandler->getLastError();
+
+    // Starts transfer
+    this->_transferStep = step_p;
+    if(!auxTwi->startTransfer(this->_deviceAddress, auxOperation, this->_transferBuffer, auxSize,
+                    &Ads1115::_transferCallback, this)) {
+        this->_transferStep = TransferStep::IDLE;
+        if(this->_overrunCount < 0xFFFF) {
+            this->_overrunCount++;
+        }
         return false;
     }
 
-    // Returns successfully
-    this->_lastError = Error::NONE;
     return true;
 }
 
+void Ads1115::_transferCallback(void *context_p, cbool_t success_p)
+{
+    // Local variables
+    Ads1115 *auxDevice = (Ads1115 *)context_p;
+    uint8_t auxIndex;
+
+    // CHECK - transfer failed, sample lost
+    if(!success_p) {
+        auxDevice->_transferStep = TransferStep::IDLE;
+        if(auxDevice->_overrunCount < 0xFFFF) {
+            auxDevice->_overrunCount++;
+        }
+        return;
+    }
+
+    // Chains the next step
+    switch(auxDevice->_transferStep) {
+    case TransferStep::WRITE_CONFIG:
+        auxDevice->_nextInput = auxDevice->_writeInput;
+        auxDevice->_startTransferStep(TransferStep::WRITE_POINTER);
+        break;
+    case TransferStep::WRITE_POINTER:
+        auxDevice->_startTransferStep(TransferStep::READ_CONVERSION);
+        break;
+    case TransferStep::READ_CONVERSION:
+        auxDevice->_transferStep = TransferStep::IDLE;
+        if(auxDevice->_discardCount > 0) {
+            auxDevice->_discardCount--;
+        } else if((uint8_t)(auxDevice->_sampleHead - auxDevice->_sampleTail) >= ADS1115_SAMPLE_QUEUE_SIZE) {
+            if(auxDevice->_overrunCount < 0xFFFF) {
+                auxDevice->_overrunCount++;
+            }
+        } else {
+            auxIndex = auxDevice->_sampleHead & (ADS1115_SAMPLE_QUEUE_SIZE - 1);
+            auxDevice->_sampleValue[auxIndex] = (int16_t)(((uint16_t)auxDevice->_transferBuffer[0] << 8) |
+                            auxDevice->_transferBuffer[1]);
+            auxDevice->_sampleInput[auxIndex] = auxDevice->_readInput;
+            auxDevice->_sampleHead++;
+        }
+        break;
+    default:
+        auxDevice->_transferStep = TransferStep::IDLE;
+        break;
+    }
+
+    return;
+}
+
 // =============================================================================
 // Class protected methods
 // =============================================================================
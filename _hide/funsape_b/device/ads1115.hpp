@@ -45,6 +45,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibBus.hpp)!"
 #endif
 
+#include "../peripheral/funsapeLibTwi.hpp"
+#if !defined(__FUNSAPE_LIB_TWI_HPP)
+#   error "Header file (funsapeLibTwi.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TWI_HPP != __FUNSAPE_LIB_ADS1115_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTwi.hpp)!"
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -63,7 +70,22 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+cuint8_t constAds1115MaxInputs          = 8;        //!< Inputs in the continuous mode list
+cuint16_t constAds1115StopTimeoutUs     = 10000;    //!< Wait for the last continuous mode transfer
+
+#ifndef ADS1115_SAMPLE_QUEUE_SIZE
+//!
+//! \brief          Ads1115 sample queue size
+//! \details        Number of samples buffered between the conversion-ready
+//!                     interrupt and the application.
+//!
+#   define ADS1115_SAMPLE_QUEUE_SIZE    16
+#endif
+#if (ADS1115_SAMPLE_QUEUE_SIZE & (ADS1115_SAMPLE_QUEUE_SIZE - 1)) != 0
+#   error "ADS1115_SAMPLE_QUEUE_SIZE must be a power of two!"
+#elif ADS1115_SAMPLE_QUEUE_SIZE > 128
+#   error "ADS1115_SAMPLE_QUEUE_SIZE must be at most 128!"
+#endif
 
 // =============================================================================
 // New data types
@@ -90,6 +112,32 @@
 //!
 //! \brief          Ads1115 class
 //! \details        Ads1115 class.
+//!                 In continuous mode the device free-runs through a list of
+//!                     inputs and the ALERT/RDY pin pulses low at the end of
+//!                     each conversion. The pin is wired to INT0/INT1
+//!                     (SenseMode::FALLING_EDGE) or to a pin change interrupt
+//!                     (falling edge only), whose callback must call
+//!                     \ref interruptHandler():
+//! \code
+//!                 void int0InterruptCallback(void)
+//!                 {
+//!                     adc.interruptHandler();
+//!                 }
+//! \endcode
+//!                 The handler reads the result and selects the next input
+//!                     with asynchronous TWI transfers, chained from the TWI
+//!                     interrupt, and queues the sample for \ref getSample().
+//!                     A new configuration takes effect after the conversion
+//!                     in progress, so the input is written one conversion
+//!                     ahead. With a single input the register pointer is
+//!                     left at the conversion register and each sample is a
+//!                     single 2-byte read. With several inputs each sample
+//!                     also needs a config and a pointer write, which fits in
+//!                     a 860 SPS period only at 400 kHz.
+//!                 While continuous mode is running, other devices may still
+//!                     use blocking TWI transfers. A conversion that ends while
+//!                     the bus is claimed by one of them is counted as lost,
+//!                     and the next conversion is read normally.
 //!
 class Ads1115
 {
@@ -146,8 +194,25 @@ public:
         WINDOW_AFTER_4_CONVERSIONS      = 6
     };
 
+    //!
+    //! \brief      Continuous mode input
+    //! \details    Input and full scale of an entry of the continuous mode
+    //!                 list.
+    //!
+    struct Input {
+        Channel     channel;                    //!< Input multiplexer setting.
+        Reference   reference;                  //!< Full scale reference.
+    };
+
 private:
 
+    enum class TransferStep : uint8_t {
+        IDLE            = 0,
+        WRITE_CONFIG    = 1,
+        WRITE_POINTER   = 2,
+        READ_CONVERSION = 3
+    };
+
     enum class Register : uint8_t {
         CONVERSION      = 0,
         CONFIG          = 1,
@@ -278,10 +343,94 @@ public:
             cint16_t highThresholdValue_p
     );
 
+    // Continuous conversion
+
+    //!
+    //! \brief      Starts the continuous conversion mode.
+    //! \details    Sets the ALERT/RDY pin as conversion ready (active low)
+    //!                 and starts converting the inputs in turn. Only TWI
+    //!                 bus handlers are supported. The channel and full scale
+    //!                 reference used by the single shot reads are kept; the
+    //!                 comparator thresholds, comparator mode and ALERT/RDY
+    //!                 pin settings are overwritten and must be set again
+    //!                 after \ref stopContinuous() if the comparator is used.
+    //! \param[in]  inputs_p        list of inputs, copied.
+    //! \param[in]  inputsCount_p   number of inputs (1-8).
+    //! \param[in]  mode_p          data rate, one of the CONTINUOUS modes.
+    //! \return true
+    //! \return false
+    //!
+    bool_t startContinuous(
+            const Input *inputs_p,
+            cuint8_t inputsCount_p,
+            const Mode mode_p = Mode::CONTINUOUS_860_SPS
+    );
+
+    //!
+    //! \brief      Stops the continuous conversion mode.
+    //! \details    Waits for the current transfer and powers the device
+    //!                 down in single shot mode, with the comparator
+    //!                 disabled. Fails with Error::COMMUNICATION_TIMEOUT if
+    //!                 the transfer does not end in \ref
+    //!                 constAds1115StopTimeoutUs.
+    //! \return true
+    //! \return false
+    //!
+    bool_t stopContinuous(
+            void
+    );
+
+    //!
+    //! \brief      Pops a sample from the queue.
+    //! \param[out] value_p         pointer to the variable where the conversion
+    //!                                 value will be saved.
+    //! \param[out] inputIndex_p    pointer to the variable where the index of
+    //!                                 the input in the list will be saved.
+    //! \return true
+    //! \return false              Error::BUFFER_EMPTY if there is no sample.
+    //!
+    bool_t getSample(
+            int16_t *value_p,
+            uint8_t *inputIndex_p
+    );
+
+    //!
+    //! \brief      Returns and clears the number of lost samples.
+    //! \details    Samples are lost when the queue is full, when the
+    //!                 previous transfer has not ended at the next conversion,
+    //!                 or when the TWI bus is claimed by a blocking transfer.
+    //! \return     uint16_t        Number of lost samples.
+    //!
+    uint16_t getOverrunCount(
+            void
+    );
+
+    //!
+    //! \brief      Handles a conversion ready pulse.
+    //! \details    Must be called from the interrupt callback of the pin
+    //!                 connected to ALERT/RDY.
+    //!
+    void interruptHandler(
+            void
+    );
+
 private:
 
     bool_t _configDevice(void);
 
+    void _encodeConfig(
+            uint8_t *buff_p
+    );
+
+    bool_t _startTransferStep(
+            const TransferStep step_p
+    );
+
+    static void _transferCallback(
+            void *context_p,
+            cbool_t success_p
+    );
+
 protected:
 
     // NONE
@@ -311,6 +460,24 @@ private:
     bool_t          _isInitialized      : 1;
     bool_t          _triggerConversion  : 1;
 
+    //     ////////////////    CONTINUOUS CONVERSION     ////////////////     //
+
+    uint8_t         _inputConfig[constAds1115MaxInputs][2];
+    uint8_t         _inputsCount;
+    vbool_t         _isContinuous;
+    uint8_t         _convInput;                 // Input of the conversion in progress
+    uint8_t         _nextInput;                 // Input of the next conversion
+    uint8_t         _readInput;                 // Input of the result being read
+    uint8_t         _discardCount;              // Results with unknown input
+    uint8_t         _writeInput;                // Input of the config being written
+    volatile TransferStep _transferStep;
+    uint8_t         _transferBuffer[3];
+    int16_t         _sampleValue[ADS1115_SAMPLE_QUEUE_SIZE];
+    uint8_t         _sampleInput[ADS1115_SAMPLE_QUEUE_SIZE];
+    vuint8_t        _sampleHead;
+    vuint8_t        _sampleTail;
+    vuint16_t       _overrunCount;
+
 protected:
 
     // NONE
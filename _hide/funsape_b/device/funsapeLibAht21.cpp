@@ -59,6 +59,8 @@ Aht21::Aht21(void)
     this->_isCalibrated                 = false;
     this->_isDataValid                  = false;
     this->_newDataReady                 = false;
+    this->_measurementRequested         = false;
+    this->_measurementError             = Error::NONE;
     this->_humidity                     = 0;
     this->_temperature                  = 0;
 
@@ -412,6 +414,67 @@ bool_t Aht21::calibrate(void)
     return true;
 }
 
+//     ////////////////////     NON-BLOCKING     ////////////////////     //
+
+bool_t Aht21::requestMeasurement(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Aht21::requestMeasurement(void)", Debug::CodeIndex::AHT21_MODULE);
+
+    // Check for errors - Not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::AHT21_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    this->_newDataReady                 = false;
+    this->_measurementRequested         = true;
+    this->_measurementError             = Error::NONE;
+    this->_pollTask.restart();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::AHT21_MODULE);
+    return true;
+}
+
+TaskStatus Aht21::poll(void)
+{
+    taskBegin(&this->_pollTask);
+    while(1) {
+        taskWaitUntil(&this->_pollTask, this->_measurementRequested);
+        if(!this->startMeasurement()) {
+            this->_measurementError     = this->_lastError;
+            this->_measurementRequested = false;
+            continue;
+        }
+
+        // Measurement takes up to 80 ms
+        taskSleepFor(&this->_pollTask, schedulerMsToTicks(80));
+        while(1) {
+            if(!this->checkStatus()) {
+                // Bus error, not a busy device; ends the measurement
+                this->_measurementError = this->_lastError;
+                break;
+            }
+            if(this->_newDataReady) {
+                break;
+            }
+            taskSleepFor(&this->_pollTask, schedulerMsToTicks(10));
+        }
+        this->_measurementRequested     = false;
+    }
+    taskEnd(&this->_pollTask);
+}
+
+TaskStatus Aht21::pollTask(void *context_p)
+{
+    return ((Aht21 *)context_p)->poll();
+}
+
 // =============================================================================
 // Class private methods
 // =============================================================================
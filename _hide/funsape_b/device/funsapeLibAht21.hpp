@@ -45,6 +45,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibBus.hpp)!"
 #endif
 
+#include "../util/funsapeLibScheduler.hpp"
+#if !defined(__FUNSAPE_LIB_SCHEDULER_HPP)
+#   error "Header file (funsapeLibScheduler.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_SCHEDULER_HPP != __FUNSAPE_LIB_AHT21_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibScheduler.hpp)!"
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -273,6 +280,69 @@ public:
             void
     );
 
+    //     ////////////////////     NON-BLOCKING     ////////////////////     //
+
+    //!
+    //! \brief      Requests a non-blocking measurement.
+    //! \details    Requests a measurement to be performed by \ref poll().
+    //!                 The 80 ms conversion time is spent sleeping instead of
+    //!                 busy-waiting. When isReady() returns true, the data can
+    //!                 be retrieved using getData(). If isMeasuring() returns
+    //!                 false and isReady() is still false, the measurement
+    //!                 failed; the reason is given by getMeasurementError().
+    //! \return true
+    //! \return false
+    //!
+    bool_t requestMeasurement(
+            void
+    );
+
+    //!
+    //! \brief      Checks if a non-blocking measurement is in progress.
+    //! \return true
+    //! \return false
+    //!
+    inlined bool_t isMeasuring(
+            void
+    ) {
+        return this->_measurementRequested;
+    }
+
+    //!
+    //! \brief      Returns the error of the last non-blocking measurement.
+    //! \details    Returns the error of the last non-blocking measurement.
+    //!                 Unlike getLastError(), it is not overwritten by the
+    //!                 other member functions.
+    //! \return     Error               Error::NONE if the measurement
+    //!                                     succeeded or is in progress.
+    //!
+    inlined Error getMeasurementError(
+            void
+    ) {
+        return this->_measurementError;
+    }
+
+    //!
+    //! \brief      Runs one step of the non-blocking measurement.
+    //! \details    Runs one step of the non-blocking measurement. Must be
+    //!                 called periodically, usually through pollTask().
+    //! \return     TaskStatus          Task status
+    //!
+    TaskStatus poll(
+            void
+    );
+
+    //!
+    //! \brief      Scheduler task wrapper.
+    //! \details    Scheduler task wrapper, to be registered as
+    //!                 scheduler.addTask(Aht21::pollTask, &sensor).
+    //! \param[in]  context_p           pointer to the Aht21 object
+    //! \return     TaskStatus          Task status
+    //!
+    static TaskStatus pollTask(
+            void *context_p
+    );
+
 private:
 
     bool_t _resetRegister(
@@ -305,6 +375,9 @@ private:
     bool_t          _isCalibrated               : 1;
     bool_t          _newDataReady               : 1;
     bool_t          _isDataValid                : 1;
+    bool_t          _measurementRequested       : 1;
+    TaskContext     _pollTask;
+    Error           _measurementError;
     uint16_t        _humidity;
     uint16_t        _temperature;
     Error           _lastError;
@@ -20,12 +20,21 @@
 #    error "Version mismatch between source and header files!"
 #endif
 
+#if defined(_FUNSAPE_PLATFORM_AVR)
+#   include <util/atomic.h>
+#endif
+
 // =============================================================================
 // File exclusive - Constants
 // =============================================================================
 
 cuint8_t constDs1307DeviceAddress       = 0x68;
 cuint8_t constDs1307RamSize             = 56;
+cuint32_t constDs1307SecondsPerDay      = 86400UL;
+cuint8_t constDs1307ResyncAttempts      = 3;
+cuint8_t constDs1307LogRecordSize       = 5;        // Sequence, code, value (2) and CRC
+cuint8_t constDs1307LogCrcSeed          = 0xA5;     // Blank RAM (0x00 or 0xFF) is invalid
+cuint8_t constDs1307RamBurstSize        = 8;        // Fits the smallest TWI buffer (10 bytes)
 
 // =============================================================================
 // File exclusive - New data types
@@ -243,6 +252,76 @@ bool_t Ds1307::setSquareWaveGenerator(const SquareWave squareWave_p)
     return true;
 }
 
+//     //////////////////////     TIME CACHE     //////////////////////     //
+
+bool_t Ds1307::enableTimeCache(cuint16_t resyncPeriod_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::enableTimeCache(cuint16_t)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Checks initialization
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - resync period invalid
+    if(resyncPeriod_p == 0) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Configure the 1 Hz tick source
+    if(!this->setSquareWaveGenerator(SquareWave::CLOCK_1_HZ)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Seed the local copy
+    this->_cacheResyncPeriod = resyncPeriod_p;
+    this->_cacheEnabled = true;
+    if(!this->_resyncTimeCache()) {
+        this->_cacheEnabled = false;
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+bool_t Ds1307::disableTimeCache(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::disableTimeCache(void)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Update data members
+    this->_cacheEnabled = false;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+void Ds1307::interruptHandler(void)
+{
+    // CHECK - cache disabled or counter saturated
+    if((!this->_cacheEnabled) || (this->_cacheElapsed == 0xFFFF)) {
+        return;
+    }
+
+    this->_cacheElapsed++;
+
+    return;
+}
+
 //     /////////////////    DATE HANDLING FUNCTIONS     /////////////////     //
 
 bool_t Ds1307::getDate(uint16_t *year_p, uint8_t *month_p, uint8_t *monthDay_p, uint8_t *weekDay_p)
@@ -271,7 +350,7 @@ bool_t Ds1307::getDate(uint16_t *year_p, uint8_t *month_p, uint8_t *monthDay_p,
     }
 
     // Get last data from device
-    if(!this->_getData()) {
+    if(!this->_updateData()) {
         // Returns error
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
@@ -324,7 +403,7 @@ bool_t Ds1307::getDateTime(DateTime *dateTime_p)
     }
 
     // Get last data from device
-    if(!this->_getData()) {
+    if(!this->_updateData()) {
         // Returns error
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
@@ -351,6 +430,15 @@ bool_t Ds1307::setDate(uint16_t year_p, uint8_t month_p, uint8_t monthDay_p)
         return false;
     }
 
+    // Bring the remaining fields up to date
+    if(this->_cacheEnabled) {
+        if(!this->_updateData()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+    }
+
     // Update data members - Date is checked inside DateTime class
     if(!this->_dateTime.setDate(year_p, (DateTime::Month)month_p, monthDay_p)) {
         // Returns error
@@ -443,7 +531,7 @@ bool_t Ds1307::getTime(uint8_t *hours_p, uint8_t *minutes_p, uint8_t *seconds_p,
     }
 
     // Get last data from device
-    if(!this->_getData()) {
+    if(!this->_updateData()) {
         // Returns error
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
@@ -477,6 +565,15 @@ bool_t Ds1307::setTime(uint8_t hours_p, uint8_t minutes_p, uint8_t seconds_p, Da
         return false;
     }
 
+    // Bring the remaining fields up to date
+    if(this->_cacheEnabled) {
+        if(!this->_updateData()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+    }
+
     // Update data members - Time is checked inside DateTime class
     if(!this->_dateTime.setTime(hours_p, minutes_p, seconds_p, timeFormat_p, amPmFlag_p)) {
         // Returns error
@@ -541,14 +638,7 @@ bool_t Ds1307::getRamData(uint8_t position_p, uint8_t *buffer_p, uint8_t size_p)
     }
 
     // Read RAM data
-    if(!this->_busHandler->setDevice(constDs1307DeviceAddress)) {
-        // Returns error
-        this->_lastError = this->_busHandler->getLastError();
-        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
-        return false;
-    }
-    position_p += (uint8_t)(Register::RAM_START);
-    if(!this->_busHandler->readReg(position_p, buffer_p, size_p)) {
+    if(!this->_readRam(position_p, buffer_p, size_p)) {
         // Returns error
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
@@ -601,19 +691,225 @@ bool_t Ds1307::setRamData(uint8_t position_p, uint8_t *buffer_p, uint8_t size_p)
     }
 
     // Write RAM data
+    if(!this->_writeRam(position_p, buffer_p, size_p)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+//     ////////////////////////     RAM LOG     ///////////////////////     //
+
+bool_t Ds1307::initLog(cuint8_t position_p, cuint8_t records_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::initLog(cuint8_t, cuint8_t)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint8_t auxBuffer[constDs1307RamSize];
+    uint8_t *auxRecord;
+    uint8_t *auxNext;
+    uint8_t auxRecords = records_p;
+    uint8_t auxNewest = 0xFF;
+
+    // Checks initialization
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - position invalid
+    if(position_p > (constDs1307RamSize - constDs1307LogRecordSize)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    if(auxRecords == 0) {
+        auxRecords = (constDs1307RamSize - position_p) / constDs1307LogRecordSize;
+    }
+    // CHECK FOR ERROR - memory overlap
+    if((position_p + ((uint16_t)auxRecords * constDs1307LogRecordSize)) > constDs1307RamSize) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        debugMessage(Error::BUFFER_SIZE_TOO_LARGE, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Read the log area
+    this->_logRecords = 0;
+    if(!this->_readRam(position_p, auxBuffer, auxRecords * constDs1307LogRecordSize)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // The newest record is the valid one not followed by its successor. A
+    //     record torn by a power loss is invalid, so the previous one wins
+    for(uint8_t i = 0; i < auxRecords; i++) {
+        auxRecord = &auxBuffer[i * constDs1307LogRecordSize];
+        auxNext = &auxBuffer[((i + 1) % auxRecords) * constDs1307LogRecordSize];
+        if(auxRecord[4] != this->_logChecksum(auxRecord)) {
+            continue;
+        }
+        if((auxNext[4] != this->_logChecksum(auxNext)) || (auxNext[0] != (uint8_t)(auxRecord[0] + 1))) {
+            auxNewest = i;
+            break;
+        }
+    }
+
+    // Update data members
+    this->_logPosition = position_p;
+    this->_logRecords = auxRecords;
+    if(auxNewest == 0xFF) {
+        this->_logHead = 0;
+        this->_logSequence = 0;
+    } else {
+        this->_logHead = (auxNewest + 1) % auxRecords;
+        this->_logSequence = auxBuffer[auxNewest * constDs1307LogRecordSize] + 1;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+bool_t Ds1307::clearLog(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::clearLog(void)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint8_t auxBuffer[constDs1307RamSize];
+
+    // Checks initialization
+    if(!this->_isLogInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Fill the log area with invalid records
+    for(uint8_t i = 0; i < (this->_logRecords * constDs1307LogRecordSize); i++) {
+        auxBuffer[i] = 0;
+    }
+    if(!this->_writeRam(this->_logPosition, auxBuffer, this->_logRecords * constDs1307LogRecordSize)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Update data members
+    this->_logHead = 0;
+    this->_logSequence = 0;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+bool_t Ds1307::readLog(LogEntry *entries_p, cuint8_t maxEntries_p, uint8_t *count_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::readLog(LogEntry *, cuint8_t, uint8_t *)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint8_t auxBuffer[constDs1307RamSize];
+    uint8_t *auxRecord;
+    uint8_t auxIndex;
+    uint8_t auxCount = 0;
+
+    // Checks initialization
+    if(!this->_isLogInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - invalid pointers
+    if((!isPointerValid(entries_p)) || (!isPointerValid(count_p))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Read the log area
+    if(!this->_readRam(this->_logPosition, auxBuffer, this->_logRecords * constDs1307LogRecordSize)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Walk backwards from the newest record while the sequence is unbroken
+    auxIndex = this->_logHead;
+    while((auxCount < maxEntries_p) && (auxCount < this->_logRecords)) {
+        auxIndex = (auxIndex == 0) ? (this->_logRecords - 1) : (auxIndex - 1);
+        auxRecord = &auxBuffer[auxIndex * constDs1307LogRecordSize];
+        if((auxRecord[4] != this->_logChecksum(auxRecord)) ||
+                (auxRecord[0] != (uint8_t)(this->_logSequence - 1 - auxCount))) {
+            break;
+        }
+        entries_p[auxCount].sequence = auxRecord[0];
+        entries_p[auxCount].code = auxRecord[1];
+        entries_p[auxCount].value = ((uint16_t)auxRecord[3] << 8) | auxRecord[2];
+        auxCount++;
+    }
+    *count_p = auxCount;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+bool_t Ds1307::writeLog(cuint8_t code_p, cuint16_t value_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::writeLog(cuint8_t, cuint16_t)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint8_t auxRecord[constDs1307LogRecordSize];
+
+    // Checks initialization
+    if(!this->_isLogInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Encode the record
+    auxRecord[0] = this->_logSequence;
+    auxRecord[1] = code_p;
+    auxRecord[2] = (uint8_t)(value_p & 0xFF);
+    auxRecord[3] = (uint8_t)(value_p >> 8);
+    auxRecord[4] = this->_logChecksum(auxRecord);
+
+    // Writes data at device
     if(!this->_busHandler->setDevice(constDs1307DeviceAddress)) {
         // Returns error
         this->_lastError = this->_busHandler->getLastError();
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
     }
-    position_p += (uint8_t)(Register::RAM_START);
-    if(!this->_busHandler->writeReg(position_p, buffer_p, size_p)) {
+    if(!this->_busHandler->writeReg((uint8_t)(Register::RAM_START) + this->_logPosition +
+                    (this->_logHead * constDs1307LogRecordSize), auxRecord, constDs1307LogRecordSize)) {
         // Returns error
+        this->_lastError = this->_busHandler->getLastError();
         debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
         return false;
     }
 
+    // Update data members
+    this->_logHead = (this->_logHead + 1) % this->_logRecords;
+    this->_logSequence++;
+
     // Returns successfully
     this->_lastError = Error::NONE;
     debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
@@ -635,6 +931,16 @@ void Ds1307::_clearData(void)
     this->_countingHalted               = false;
     this->_initialized                  = false;
     this->_squareWave                   = SquareWave::OFF_LOW;
+    //     /////////////////////     TIME CACHE     ////////////////////     //
+    this->_cacheEnabled                 = false;
+    this->_cacheElapsed                 = 0;
+    this->_cacheAge                     = 0;
+    this->_cacheResyncPeriod            = 0;
+    //     //////////////////////     RAM LOG     /////////////////////     //
+    this->_logPosition                  = 0;
+    this->_logRecords                   = 0;
+    this->_logHead                      = 0;
+    this->_logSequence                  = 0;
     this->_dateTime.setDate(
             2000,
             DateTime::Month::JANUARY,
@@ -671,6 +977,121 @@ bool_t Ds1307::_isInitialized(void)
     return true;
 }
 
+bool_t Ds1307::_isLogInitialized(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::_isLogInitialized(void)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Checks initialization
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - log not initialized
+    if(this->_logRecords == 0) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+uint8_t Ds1307::_logChecksum(cuint8_t *record_p)
+{
+    // Local variables
+    uint8_t auxCrc = constDs1307LogCrcSeed;
+
+    // CRC-8 (polynomial 0x07) over sequence, code and value
+    for(uint8_t i = 0; i < (constDs1307LogRecordSize - 1); i++) {
+        auxCrc ^= record_p[i];
+        for(uint8_t j = 0; j < 8; j++) {
+            auxCrc = (auxCrc & 0x80) ? ((auxCrc << 1) ^ 0x07) : (auxCrc << 1);
+        }
+    }
+
+    return auxCrc;
+}
+
+bool_t Ds1307::_readRam(cuint8_t position_p, uint8_t *buffer_p, cuint8_t size_p)
+{
+    // Local variables
+    uint8_t auxSize;
+
+    // Selects device
+    if(!this->_busHandler->setDevice(constDs1307DeviceAddress)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        return false;
+    }
+
+    // Reads in bursts that fit the bus buffer
+    for(uint8_t i = 0; i < size_p; i += auxSize) {
+        auxSize = ((size_p - i) > constDs1307RamBurstSize) ? constDs1307RamBurstSize : (size_p - i);
+        if(!this->_busHandler->readReg((uint8_t)(Register::RAM_START) + position_p + i, &buffer_p[i], auxSize)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            return false;
+        }
+    }
+
+    // Returns successfully
+    return true;
+}
+
+bool_t Ds1307::_resyncTimeCache(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::_resyncTimeCache(void)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint16_t auxElapsed;
+
+    // Retry if a tick arrives during the transfer, since the read may have
+    //     happened before or after the device incremented its seconds
+    for(uint8_t i = 0; i < constDs1307ResyncAttempts; i++) {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            this->_cacheElapsed = 0;
+        }
+        if(!this->_getData()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            auxElapsed = this->_cacheElapsed;
+        }
+        if(auxElapsed == 0) {
+            break;
+        }
+    }
+
+    // CHECK FOR ERROR - every attempt saw a tick; the copy may be one second
+    //     behind, so drop the counted ticks (they would be added twice) and
+    //     force a new resync at the next update
+    if(auxElapsed != 0) {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            this->_cacheElapsed = 0;
+        }
+        this->_cacheAge = this->_cacheResyncPeriod;
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    this->_cacheAge = 0;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
 bool_t Ds1307::_getData(void)
 {
     // Mark passage for debugging purpose
@@ -809,6 +1230,12 @@ bool_t Ds1307::_sendData(void)
         return false;
     }
 
+    // Writing the seconds register restarts the device 1 Hz divider
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_cacheElapsed = 0;
+    }
+    this->_cacheAge = 0;
+
     // Returns successfully
     this->_lastError = Error::NONE;
     debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
@@ -870,6 +1297,145 @@ bool_t Ds1307::_setCounting(bool counting_p)
     return true;
 }
 
+bool_t Ds1307::_updateData(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Ds1307::_updateData(void)", Debug::CodeIndex::DS1307_MODULE);
+
+    // Local variables
+    uint16_t auxElapsed;
+    uint32_t auxSecondsOfDay;
+    uint8_t auxHours;
+    uint8_t auxMinutes;
+    uint8_t auxSeconds;
+    DateTime::TimeFormat auxTimeFormat;
+    DateTime::AmPmFlag auxAmPmFlag;
+
+    // Cache disabled - read the device
+    if(!this->_cacheEnabled) {
+        if(!this->_getData()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+        return true;
+    }
+
+    // Take the seconds counted since the last update
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        auxElapsed = this->_cacheElapsed;
+        this->_cacheElapsed = 0;
+    }
+    if(auxElapsed == 0) {
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+        return true;
+    }
+
+    // Resync period expired
+    if(auxElapsed >= (uint16_t)(this->_cacheResyncPeriod - this->_cacheAge)) {
+        if(!this->_resyncTimeCache()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+        return true;
+    }
+    this->_cacheAge += auxElapsed;
+
+    // Advance the local copy
+    if(!this->_dateTime.getTimeFormat(&auxTimeFormat)) {
+        // Returns error
+        this->_lastError = this->_dateTime.getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    if(!this->_dateTime.getTime(&auxHours, &auxMinutes, &auxSeconds, DateTime::TimeFormat::FORMAT_24_HOURS,
+                    &auxAmPmFlag)) {
+        // Returns error
+        this->_lastError = this->_dateTime.getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    auxSecondsOfDay = ((uint32_t)auxHours * 3600) + ((uint16_t)auxMinutes * 60) + auxSeconds + auxElapsed;
+
+    // Midnight crossed - let the device handle the date rollover
+    if(auxSecondsOfDay >= constDs1307SecondsPerDay) {
+        if(!this->_resyncTimeCache()) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+        return true;
+    }
+
+    // Update data members, keeping the time format
+    auxHours = (uint8_t)(auxSecondsOfDay / 3600);
+    auxMinutes = (uint8_t)((auxSecondsOfDay % 3600) / 60);
+    auxSeconds = (uint8_t)(auxSecondsOfDay % 60);
+    if(!this->_dateTime.setTime(auxHours, auxMinutes, auxSeconds)) {
+        // Returns error
+        this->_lastError = this->_dateTime.getLastError();
+        debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+        return false;
+    }
+    if(auxTimeFormat == DateTime::TimeFormat::FORMAT_12_HOURS) {
+        if(!this->_dateTime.getTime(&auxHours, &auxMinutes, &auxSeconds, auxTimeFormat, &auxAmPmFlag)) {
+            // Returns error
+            this->_lastError = this->_dateTime.getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+        if(!this->_dateTime.setTime(auxHours, auxMinutes, auxSeconds, auxTimeFormat, auxAmPmFlag)) {
+            // Returns error
+            this->_lastError = this->_dateTime.getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::DS1307_MODULE);
+            return false;
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::DS1307_MODULE);
+    return true;
+}
+
+bool_t Ds1307::_writeRam(cuint8_t position_p, cuint8_t *buffer_p, cuint8_t size_p)
+{
+    // Local variables
+    uint8_t auxSize;
+
+    // Selects device
+    if(!this->_busHandler->setDevice(constDs1307DeviceAddress)) {
+        // Returns error
+        this->_lastError = this->_busHandler->getLastError();
+        return false;
+    }
+
+    // Writes in bursts that fit the bus buffer
+    for(uint8_t i = 0; i < size_p; i += auxSize) {
+        auxSize = ((size_p - i) > constDs1307RamBurstSize) ? constDs1307RamBurstSize : (size_p - i);
+        if(!this->_busHandler->writeReg((uint8_t)(Register::RAM_START) + position_p + i, &buffer_p[i], auxSize)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            return false;
+        }
+    }
+
+    // Returns successfully
+    return true;
+}
+
 // =============================================================================
 // Class protected methods
 // =============================================================================
@@ -97,6 +97,29 @@
 //!
 //! \brief          Ds1307 class
 //! \details        Ds1307 class.
+//!                 The optional time cache avoids a TWI transaction at each
+//!                     date or time read. The 1 Hz SQW/OUT output is wired to
+//!                     INT0 or INT1 (open-drain, needs a pull-up) set to
+//!                     SenseMode::FALLING_EDGE, the edge at which the device
+//!                     increments its seconds register, and the interrupt
+//!                     callback must call \ref interruptHandler():
+//! \code
+//!                 void int0InterruptCallback(void)
+//!                 {
+//!                     rtc.interruptHandler();
+//!                 }
+//! \endcode
+//!                 Reads then only add the elapsed seconds to the local copy.
+//!                     The device is read again when the resync period
+//!                     expires or when the time crosses midnight, so the
+//!                     date rollover is always taken from the device.
+//!                 The battery-backed RAM can also hold a small ring log of
+//!                     \ref LogEntry records (5 bytes each: sequence, code,
+//!                     16-bit value and CRC-8), e.g. error codes, reset
+//!                     causes or last-known states. Each \ref writeLog() is
+//!                     a single 5-byte TWI write and \ref readLog() reads the
+//!                     whole log in a single transaction. A record torn by a
+//!                     power loss fails its CRC and is skipped.
 //!
 class Ds1307
 {
@@ -119,6 +142,18 @@ public:
         CLOCK_32_KHZ                    = 5
     };
 
+    //     ///////////////////////     RAM LOG     ///////////////////////     //
+
+    //!
+    //! \brief      Ring log record
+    //! \details    Record stored at the device RAM by \ref writeLog().
+    //!
+    struct LogEntry {
+        uint8_t     sequence;                   //!< Sequence number, wraps at 255.
+        uint8_t     code;                       //!< Event code.
+        uint16_t    value;                      //!< Event value.
+    };
+
 private:
 
     //!
@@ -244,6 +279,44 @@ public:
             const SquareWave squareWave_p
     );
 
+    //     ////////////////////     TIME CACHE     ////////////////////     //
+
+    //!
+    //! \brief      Enables the time cache.
+    //! \details    Sets the square wave generator to 1 Hz and reads the
+    //!                 device to seed the local copy. After that, date and
+    //!                 time reads only access the device once every
+    //!                 resyncPeriod_p seconds. A resync that sees a tick
+    //!                 during every read attempt fails with Error::NOT_READY
+    //!                 and is retried at the next update.
+    //! \param[in]  resyncPeriod_p      seconds between device reads (1-65535).
+    //! \return true
+    //! \return false
+    //!
+    bool_t enableTimeCache(
+            cuint16_t resyncPeriod_p = 3600
+    );
+
+    //!
+    //! \brief      Disables the time cache.
+    //! \details    Every read accesses the device again. The square wave
+    //!                 generator is left unchanged.
+    //! \return true
+    //! \return false
+    //!
+    bool_t disableTimeCache(
+            void
+    );
+
+    //!
+    //! \brief      Counts one second of the time cache.
+    //! \details    Must be called from the interrupt callback of the pin
+    //!                 connected to the SQW/OUT output.
+    //!
+    void interruptHandler(
+            void
+    );
+
     //     ///////////////    DATE HANDLING FUNCTIONS     ///////////////     //
 
     //!
@@ -385,6 +458,67 @@ public:
             uint8_t size_p = 1
     );
 
+    //     //////////////////////     RAM LOG     //////////////////////     //
+
+    //!
+    //! \brief      Initializes the RAM ring log.
+    //! \details    Reads the log area in a single transaction and finds the
+    //!                 newest valid record, so logging resumes after it. The
+    //!                 bus buffer must hold the whole log area (records_p * 5
+    //!                 bytes), e.g. Twi::init(100000, 56).
+    //! \param[in]  position_p  RAM start position of the log area (0-55).
+    //! \param[in]  records_p   number of records; 0 uses all the RAM after
+    //!                             position_p.
+    //! \return true
+    //! \return false
+    //!
+    bool_t initLog(
+            cuint8_t position_p = 0,
+            cuint8_t records_p = 0
+    );
+
+    //!
+    //! \brief      Erases the RAM ring log.
+    //! \details    Invalidates all records in a single transaction.
+    //! \return true
+    //! \return false
+    //!
+    bool_t clearLog(
+            void
+    );
+
+    //!
+    //! \brief      Reads the RAM ring log.
+    //! \details    Reads the log area in a single transaction and returns the
+    //!                 valid records, newest first.
+    //! \param[out] entries_p       pointer to the array where the records will
+    //!                                 be saved.
+    //! \param[in]  maxEntries_p    size of the array.
+    //! \param[out] count_p         pointer to the variable where the number of
+    //!                                 records read will be saved.
+    //! \return true
+    //! \return false
+    //!
+    bool_t readLog(
+            LogEntry *entries_p,
+            cuint8_t maxEntries_p,
+            uint8_t *count_p
+    );
+
+    //!
+    //! \brief      Appends a record to the RAM ring log.
+    //! \details    Overwrites the oldest record when the log is full. Costs a
+    //!                 single 5-byte TWI write.
+    //! \param[in]  code_p      event code.
+    //! \param[in]  value_p     event value.
+    //! \return true
+    //! \return false
+    //!
+    bool_t writeLog(
+            cuint8_t code_p,
+            cuint16_t value_p = 0
+    );
+
 private:
 
     void _clearData(
@@ -399,6 +533,24 @@ private:
             void
     );
 
+    bool_t _isLogInitialized(
+            void
+    );
+
+    uint8_t _logChecksum(
+            cuint8_t *record_p
+    );
+
+    bool_t _readRam(
+            cuint8_t position_p,
+            uint8_t *buffer_p,
+            cuint8_t size_p
+    );
+
+    bool_t _resyncTimeCache(
+            void
+    );
+
     bool_t _sendData(
             void
     );
@@ -407,6 +559,16 @@ private:
             bool_t counting_p
     );
 
+    bool_t _updateData(
+            void
+    );
+
+    bool_t _writeRam(
+            cuint8_t position_p,
+            cuint8_t *buffer_p,
+            cuint8_t size_p
+    );
+
 protected:
 
     // NONE
@@ -434,6 +596,20 @@ private:
 
     DateTime        _dateTime;
 
+    //     /////////////////////     TIME CACHE     /////////////////////     //
+
+    vbool_t         _cacheEnabled;
+    vuint16_t       _cacheElapsed;              // Seconds not yet added to _dateTime
+    uint16_t        _cacheAge;                  // Seconds since last device read
+    uint16_t        _cacheResyncPeriod;
+
+    //     //////////////////////     RAM LOG     //////////////////////     //
+
+    uint8_t         _logPosition;
+    uint8_t         _logRecords;                // 0 if the log is not initialized
+    uint8_t         _logHead;                   // Next record to be written
+    uint8_t         _logSequence;               // Next sequence number
+
 protected:
 
     // NONE
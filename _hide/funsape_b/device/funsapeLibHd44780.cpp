@@ -117,6 +117,19 @@ Hd44780::Hd44780()
     this->_isInterfaceInitialized       = false;
     this->_isControlPortSet             = false;
     this->_isDataPortSet                = false;
+    this->_asyncString                  = nullptr;
+    this->_asyncIndex                   = 0;
+    this->_asyncClear                   = false;
+    this->_shadow.reset();
+    this->_queueHead                    = 0;
+    this->_queueTail                    = 0;
+    this->_queueWait                    = 0;
+    this->_queuePhase                   = 0;
+    this->_queueEntry                   = 0;
+    this->_queueEntryIsData             = false;
+    this->_queueShortWait               = 0;
+    this->_queueLongWait                = 0;
+    this->_queueEnabled                 = false;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -232,6 +245,7 @@ bool_t Hd44780::init(const Size size_p, const Font font_p)
     this->_lines                        = ((((uint8_t)size_p) * 2) / 100) - 1;
     this->_columns                      = ((((uint8_t)size_p) * 2) % 100) - 1;
     this->_isInterfaceInitialized       = true;
+    this->_shadow.setSize(this->_lines + 1, this->_columns + 1);
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -375,6 +389,7 @@ bool_t Hd44780::clearScreen(void)
     }
     this->_cursorLine                   = 0;
     this->_cursorColumn                 = 0;
+    this->_shadow.reset();
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -398,37 +413,15 @@ bool_t Hd44780::cursorGoTo(cuint8_t line_p, cuint8_t column_p)
         return false;
     }
 
-    switch(line_p) {
-    case 0:     // Go to line 0
-        address = column_p;
-        break;
-    case 1:     // Go to line 1
-        address = (this->_lines >= 1) ? (0x40 + column_p) : 0xFF;
-        break;
-    case 2:     // Go to line 2
-        if((this->_lines == 3) && (this->_columns == 11)) {             // Display 12x4
-            address = 0x0C + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 15)) {      // Display 16x4
-            address = 0x10 + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 19)) {      // Display 20x4
-            address = 0x14 + column_p;
-        }
-        break;
-    case 3:     // Go to line 3
-        if((this->_lines == 3) && (this->_columns == 11)) {             // Display 12x4
-            address = 0x4C + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 15)) {      // Display 16x4
-            address = 0x50 + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 19)) {      // Display 20x4
-            address = 0x54 + column_p;
-        }
-        break;
-    }
-
+    address = this->_shadow.getDdramAddress(line_p, column_p);
     if(address != 0xFF) {
+        if(!this->_writeCommand((LCD_DDRAM_ADDRESS_SET | address))) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+            return false;
+        }
         this->_cursorLine               = line_p;
         this->_cursorColumn             = column_p;
-        this->_writeCommand((LCD_DDRAM_ADDRESS_SET | address));
     }
 
     // Returns successfully
@@ -481,12 +474,16 @@ bool_t Hd44780::cursorMove(const Direction direction_p)
     }
 
     auxCommand |= (direction_p == Direction::LEFT) ? LCD_MOVE_CURSOR_OR_DISPLAY_LEFT : LCD_MOVE_CURSOR_OR_DISPLAY_RIGHT;
+    if(!this->_writeCommand(auxCommand)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
     if(direction_p == Direction::LEFT) {
         this->_cursorColumn--;
     } else {
         this->_cursorColumn++;
     }
-    this->_writeCommand(auxCommand);
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -582,7 +579,11 @@ bool_t Hd44780::setDisplayState(const DisplayState displayState_p)
     auxCommand |= (auxDisplayOn) ? LCD_DISPLAY_CONTROL_DISPLAY_ON : LCD_DISPLAY_CONTROL_DISPLAY_OFF;
     auxCommand |= (auxCursorOn) ? LCD_DISPLAY_CONTROL_CURSOR_ON : LCD_DISPLAY_CONTROL_CURSOR_OFF;
     auxCommand |= (auxBlinkOn) ? LCD_DISPLAY_CONTROL_CURSOR_BLINK_ON : LCD_DISPLAY_CONTROL_CURSOR_BLINK_OFF;
-    this->_writeCommand(auxCommand);
+    if(!this->_writeCommand(auxCommand)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
 
     // Updates data members
     this->_cursorBlink                  = auxBlinkOn;
@@ -612,12 +613,16 @@ bool_t Hd44780::displayShift(const Direction direction_p)
     uint8_t auxCommand                  = LCD_MOVE_CURSOR_OR_DISPLAY | LCD_MOVE_CURSOR_OR_DISPLAY_SHIFT_DISPLAY;
 
     auxCommand |= (direction_p == Direction::LEFT) ? LCD_MOVE_CURSOR_OR_DISPLAY_LEFT : LCD_MOVE_CURSOR_OR_DISPLAY_RIGHT;
+    if(!this->_writeCommand(auxCommand)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
     if(direction_p == Direction::LEFT) {
         this->_cursorColumn--;
     } else {
         this->_cursorColumn++;
     }
-    this->_writeCommand(auxCommand);
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -644,7 +649,11 @@ bool_t Hd44780::setEntryMode(const Step incDec_p, const DisplayMode mode_p)
     auxCommand |= (this->_entryIncDec == Step::INCREMENT) ? LCD_ENTRY_MODE_SET_INCREMENT : LCD_ENTRY_MODE_SET_DECREMENT;
     auxCommand |= (this->_entryShiftDisplay == DisplayMode::SHIFT) ? LCD_ENTRY_MODE_SET_SHIFT :
             LCD_ENTRY_MODE_SET_OVERWRITE;
-    this->_writeCommand(auxCommand);
+    if(!this->_writeCommand(auxCommand)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
 
     this->_entryIncDec                  = incDec_p;
     this->_entryShiftDisplay            = mode_p;
@@ -682,6 +691,12 @@ bool_t Hd44780::setCustomCharacter(cuint8_t charAddress_p, cuint8_t *charData_p)
         return false;
     }
 
+    if(!this->_checkQueueRoom((this->_font == Font::FONT_5X8) ? 9 : 11)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
     if(this->_font == Font::FONT_5X8) {
         if(charAddress_p > 7) {
             return false;
@@ -719,13 +734,23 @@ bool_t Hd44780::print(cchar_t character_p)
         return false;
     }
 
+    // A line feed interrupted by a full queue resumes from the cursor column
     if(character_p == '\n') {
-        for(uint8_t i = this->_cursorColumn; i < (this->_columns + 1); i++) {
-            this->_writeCharacter(' ', true);
+        while(this->_cursorColumn < (this->_columns + 1)) {
+            if(!this->_writeCharacter(' ', true)) {
+                // Returns error
+                debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+                return false;
+            }
         }
-        this->cursorMoveNextLine();
-    } else {
-        this->_writeCharacter(character_p, true);
+        if(!this->cursorMoveNextLine()) {
+            // Returns error
+            return false;
+        }
+    } else if(!this->_writeCharacter(character_p, true)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
     }
 
     // Returns successfully
@@ -751,7 +776,10 @@ bool_t Hd44780::print(cchar_t *string_p)
     }
 
     while(string_p[i]) {
-        this->print(string_p[i]);
+        if(!this->print(string_p[i])) {
+            // Returns error
+            return false;
+        }
         i++;
     }
 
@@ -761,6 +789,345 @@ bool_t Hd44780::print(cchar_t *string_p)
     return true;
 }
 
+//     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+bool_t Hd44780::bufferClear(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::bufferClear(void)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Fills buffer with spaces
+    this->_shadow.clear();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::bufferGoTo(cuint8_t line_p, cuint8_t column_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::bufferGoTo(cuint8_t, cuint8_t)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Updates buffer cursor
+    if(!this->_shadow.goTo(line_p, column_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::bufferPrint(cchar_t character_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::bufferPrint(cchar_t)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    this->_shadow.print(character_p);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::bufferPrint(cchar_t *string_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::bufferPrint(cchar_t *)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Local variables
+    uint8_t i = 0;
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+    if(!isPointerValid(string_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    while(string_p[i]) {
+        this->bufferPrint(string_p[i]);
+        i++;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::bufferInvalidate(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::bufferInvalidate(void)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Marks all positions as dirty
+    this->_shadow.invalidate();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::refresh(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::refresh(void)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Sends dirty runs, then restores cursor position
+    this->_shadow.refresh(&Hd44780::_shadowWrite, this,
+            this->_shadow.getDdramAddress(this->_cursorLine, this->_cursorColumn));
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+//     ////////////////////     NON-BLOCKING     ////////////////////     //
+
+bool_t Hd44780::printAsync(cchar_t *string_p, cbool_t clearScreen_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::printAsync(cchar_t *, cbool_t)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+    if(!isPointerValid(string_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+    if(this->isPrinting()) {
+        // Returns error
+        this->_lastError = Error::LOCKED;
+        debugMessage(Error::LOCKED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Schedules print
+    this->_asyncString                  = string_p;
+    this->_asyncIndex                   = 0;
+    this->_asyncClear                   = clearScreen_p;
+    this->_asyncTask.restart();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+TaskStatus Hd44780::poll(void)
+{
+    taskBegin(&this->_asyncTask);
+    while(1) {
+        taskWaitUntil(&this->_asyncTask, this->isPrinting());
+        if(this->_asyncClear) {
+            this->_cursorLine           = 0;
+            this->_cursorColumn         = 0;
+            if(this->_queueEnabled) {
+                taskWaitUntil(&this->_asyncTask, (this->getQueueFree() > 0));
+                this->_writeCommand(LCD_CLEAR_DISPLAY);         // Paced by the queue
+            } else {
+                this->_sendCommand(LCD_CLEAR_DISPLAY);
+                // One extra tick covers the partial tick already elapsed
+                taskSleepFor(&this->_asyncTask, (schedulerMsToTicks(2) + 1));
+            }
+            this->_asyncClear           = false;
+        }
+        while(isPointerValid(this->_asyncString) && (this->_asyncString[this->_asyncIndex])) {
+            // Retries on the next call if the queue is full
+            if(this->print(this->_asyncString[this->_asyncIndex])) {
+                this->_asyncIndex++;
+            }
+            taskYield(&this->_asyncTask);
+        }
+        this->_asyncString              = nullptr;
+    }
+    taskEnd(&this->_asyncTask);
+}
+
+TaskStatus Hd44780::pollTask(void *context_p)
+{
+    return ((Hd44780 *)context_p)->poll();
+}
+
+//     /////////////////////    QUEUED MODE     /////////////////////     //
+
+bool_t Hd44780::enableQueue(cuint8_t tickPeriodUs_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::enableQueue(cuint8_t)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+    if(tickPeriodUs_p < 8) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::Hd44780_MODULE);
+        return false;
+    }
+
+    // Extra ticks to wait after each entry (40 us or 2 ms execution time)
+    this->_queueShortWait               = 40 / tickPeriodUs_p;
+    this->_queueLongWait                = 2000 / tickPeriodUs_p;
+
+    // The handler does not drive RW
+    if(this->_useBusyFlag) {
+        this->_gpioControlRw->low();                            // LCD in write mode
+    }
+    this->_queueEnabled                 = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+bool_t Hd44780::disableQueue(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Hd44780::disableQueue(void)", Debug::CodeIndex::Hd44780_MODULE);
+
+    // Drains queue
+    this->waitIdle();
+    this->_queueEnabled                 = false;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::Hd44780_MODULE);
+    return true;
+}
+
+void Hd44780::waitIdle(void)
+{
+    while(this->isBusy()) {
+        doNothing();
+    }
+
+    return;
+}
+
+void Hd44780::queueHandler(void)
+{
+    // Local variables
+    uint8_t tail                        = this->_queueTail;
+    uint8_t index;
+
+    switch(this->_queuePhase) {
+    case 1:     // Ends the enable pulse of the byte or higher nibble
+        this->_gpioControlE->low();
+        if(this->_use4LinesData) {
+            this->_queuePhase = 2;
+            return;
+        }
+        break;
+    case 2:     // Starts the enable pulse of the lower nibble
+        this->_gpioDataBus->write(this->_queueEntry & 0x0F);
+        this->_gpioControlE->high();
+        this->_queuePhase = 3;
+        return;
+    case 3:     // Ends the enable pulse of the lower nibble
+        this->_gpioControlE->low();
+        break;
+    default:    // Starts the next entry
+        // Waits for the execution of the last entry
+        if(this->_queueWait) {
+            this->_queueWait--;
+            return;
+        }
+        if(tail == this->_queueHead) {
+            return;
+        }
+        index = tail & (HD44780_QUEUE_SIZE - 1);
+        this->_queueEntry = this->_queue[index];
+        this->_queueEntryIsData = isBitSet(this->_queueIsData[index >> 3], (index & 0x07));
+        this->_queueTail = tail + 1;
+        if(this->_queueEntryIsData) {
+            this->_gpioControlRs->high();                       // LCD in data mode
+        } else {
+            this->_gpioControlRs->low();                        // LCD in command mode
+        }
+        if(this->_use4LinesData) {
+            this->_gpioDataBus->write(this->_queueEntry >> 4);  // Higher nibble
+        } else {
+            this->_gpioDataBus->write(this->_queueEntry);
+        }
+        this->_gpioControlE->high();                            // Enable pulse start
+        this->_queuePhase = 1;
+        return;
+    }
+
+    // Entry sent, waits for its execution
+    this->_queuePhase = 0;
+    if((!this->_queueEntryIsData) &&
+            ((this->_queueEntry == LCD_CLEAR_DISPLAY) || (this->_queueEntry == LCD_RETURN_HOME))) {
+        this->_queueWait = this->_queueLongWait;
+    } else {
+        this->_queueWait = this->_queueShortWait;
+    }
+
+    return;
+}
+
 Error Hd44780::getLastError(void)
 {
     // Returns error
@@ -793,40 +1160,100 @@ bool_t Hd44780::_functionSet8Bits(uint8_t command_p)
 }
 
 bool_t Hd44780::_writeCommand(uint8_t command_p)
+{
+    if(this->_queueEnabled) {
+        if(!this->_queuePush(command_p, false)) {
+            this->_lastError = Error::NOT_READY;
+            return false;
+        }
+        return true;
+    }
+
+    this->_sendCommand(command_p);
+
+    if(!this->_useBusyFlag) {
+        if((command_p == LCD_CLEAR_DISPLAY) || (command_p == LCD_RETURN_HOME)) {
+            delayMs(2);
+        } else {
+            delayUs(40);
+        }
+    }
+
+    // Returns successfully
+    return true;
+}
+
+bool_t Hd44780::_sendCommand(uint8_t command_p)
 {
     if(this->_useBusyFlag) {
         if(this->_isBusyInitialized) {
             this->_waitUntilReady();
         }
+    }
+    this->_sendByte(command_p, false);
+
+    // Returns successfully
+    return true;
+}
+
+void Hd44780::_sendByte(uint8_t data_p, bool_t isData_p)
+{
+    if(this->_useBusyFlag) {
         this->_gpioControlRw->low();                            // LCD in write mode
     }
-    this->_gpioControlRs->low();                                // LCD in command mode
+    if(isData_p) {
+        this->_gpioControlRs->high();                           // LCD in data mode
+    } else {
+        this->_gpioControlRs->low();                            // LCD in command mode
+    }
     this->_gpioControlE->low();                                 // Makes sure enable is LOW
 
     if(this->_use4LinesData) {
-        this->_gpioDataBus->write(command_p >> 4);              // Writes data (higher nibble)
+        this->_gpioDataBus->write(data_p >> 4);                 // Writes data (higher nibble)
         this->_gpioControlE->high();                            // Enable pulse start
         delayUs(1);
         this->_gpioControlE->low();                             // Enable pulse end
         delayUs(1);
-        this->_gpioDataBus->write(command_p & 0x0F);            // Writes data (lower nibble)
+        this->_gpioDataBus->write(data_p & 0x0F);               // Writes data (lower nibble)
     } else {
-        this->_gpioDataBus->write(command_p);                   // Writes data
+        this->_gpioDataBus->write(data_p);                      // Writes data
     }
     this->_gpioControlE->high();                                // Enable pulse start
     delayUs(1);
     this->_gpioControlE->low();                                 // Enable pulse end
     delayUs(1);
 
-    if(!this->_useBusyFlag) {
-        if((command_p == LCD_CLEAR_DISPLAY) || (command_p == LCD_RETURN_HOME)) {
-            delayMs(2);
-        } else {
-            delayUs(40);
-        }
+    return;
+}
+
+bool_t Hd44780::_queuePush(uint8_t data_p, bool_t isData_p)
+{
+    // Local variables
+    uint8_t head                        = this->_queueHead;
+    uint8_t index                       = head & (HD44780_QUEUE_SIZE - 1);
+
+    // Fails if full; the interrupt only reads the entries
+    if((uint8_t)(head - this->_queueTail) >= HD44780_QUEUE_SIZE) {
+        return false;
+    }
+    this->_queue[index] = data_p;
+    if(isData_p) {
+        setBit(this->_queueIsData[index >> 3], (index & 0x07));
+    } else {
+        clrBit(this->_queueIsData[index >> 3], (index & 0x07));
+    }
+    this->_queueHead = head + 1;
+
+    return true;
+}
+
+bool_t Hd44780::_checkQueueRoom(cuint8_t entries_p)
+{
+    if(this->_queueEnabled && (this->getQueueFree() < entries_p)) {
+        this->_lastError = Error::NOT_READY;
+        return false;
     }
 
-    // Returns successfully
     return true;
 }
 
@@ -867,30 +1294,19 @@ bool_t Hd44780::_waitUntilReady(void)
 bool_t Hd44780::_writeCharacter(uint8_t character_p, bool_t ddramChar_p)
 {
     if((this->_cursorColumn < 40) || (!ddramChar_p)) {
-        if(this->_useBusyFlag) {
-            this->_waitUntilReady();
-            this->_gpioControlRw->low();                                // LCD in write mode
-        }
-        this->_gpioControlRs->high();                                   // LCD in data mode
-        this->_gpioControlE->low();                                     // Makes sure enable is LOW
-
-        if(this->_use4LinesData) {
-            this->_gpioDataBus->write(character_p >> 4);                // Writes data (higher nibble)
-            this->_gpioControlE->high();                                // Enable pulse start
-            delayUs(1);
-            this->_gpioControlE->low();                                 // Enable pulse end
-            delayUs(1);
-            this->_gpioDataBus->write(character_p & 0x0F);              // Writes data (lower nibble)
+        if(this->_queueEnabled) {
+            if(!this->_queuePush(character_p, true)) {
+                this->_lastError = Error::NOT_READY;
+                return false;
+            }
         } else {
-            this->_gpioDataBus->write(character_p);                     // Writes data
-        }
-        this->_gpioControlE->high();                                    // Enable pulse start
-        delayUs(1);
-        this->_gpioControlE->low();                                     // Enable pulse end
-        delayUs(1);
-
-        if(!this->_useBusyFlag) {
-            delayUs(40);
+            if(this->_useBusyFlag) {
+                this->_waitUntilReady();
+            }
+            this->_sendByte(character_p, true);
+            if(!this->_useBusyFlag) {
+                delayUs(40);
+            }
         }
         if(ddramChar_p) {
             this->_cursorColumn++;
@@ -901,6 +1317,20 @@ bool_t Hd44780::_writeCharacter(uint8_t character_p, bool_t ddramChar_p)
     return true;
 }
 
+void Hd44780::_shadowWrite(void *context_p, cuint8_t data_p, cbool_t isData_p)
+{
+    // Local variables
+    Hd44780 *display                    = (Hd44780 *)context_p;
+
+    if(isData_p) {
+        display->_writeCharacter(data_p, false);
+    } else {
+        display->_writeCommand(data_p);
+    }
+
+    return;
+}
+
 // =============================================================================
 // Class protected methods
 // =============================================================================
@@ -46,6 +46,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibGpioPin.hpp)!"
 #endif
 
+#include "funsapeLibHd44780Shadow.hpp"
+#if !defined(__FUNSAPE_LIB_HD44780_SHADOW_HPP)
+#   error "Header file (funsapeLibHd44780Shadow.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_HD44780_SHADOW_HPP != __FUNSAPE_LIB_HD44780_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibHd44780Shadow.hpp)!"
+#endif
+
 #include "../util/funsapeLibDebug.hpp"
 #if !defined(__FUNSAPE_LIB_DEBUG_HPP)
 #   error "Header file (funsapeLibDebug.hpp) is corrupted!"
@@ -53,6 +60,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
 #endif
 
+#include "../util/funsapeLibScheduler.hpp"
+#if !defined(__FUNSAPE_LIB_SCHEDULER_HPP)
+#   error "Header file (funsapeLibScheduler.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_SCHEDULER_HPP != __FUNSAPE_LIB_HD44780_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibScheduler.hpp)!"
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -71,7 +85,23 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef HD44780_QUEUE_SIZE
+//!
+//! \brief          Size of the Hd44780 command queue.
+//! \details        Maximum number of commands and characters waiting to be
+//!                     sent in queued mode. Must be a power of two, from 16
+//!                     to 128. Each entry takes one byte plus one bit.
+//!
+#   define HD44780_QUEUE_SIZE                   32
+#endif
+
+#if (HD44780_QUEUE_SIZE & (HD44780_QUEUE_SIZE - 1)) != 0
+#   error "HD44780_QUEUE_SIZE must be a power of two!"
+#elif HD44780_QUEUE_SIZE > 128
+#   error "HD44780_QUEUE_SIZE must not be greater than 128!"
+#elif HD44780_QUEUE_SIZE < 16
+#   error "HD44780_QUEUE_SIZE must not be lower than 16!"
+#endif
 
 // =============================================================================
 // New data types
@@ -98,6 +128,30 @@
 //!
 //! \brief          Hd44780 class
 //! \details        Hd44780 class.
+//!                 In queued mode (\ref enableQueue()), commands and characters
+//!                     are stored in a FIFO and sent by \ref queueHandler(),
+//!                     which must be called from a periodic timer compare
+//!                     interrupt callback:
+//! \code
+//!                 void timer2CompareACallback(void)
+//!                 {
+//!                     display.queueHandler();
+//!                 }
+//! \endcode
+//!                 In direct mode each character blocks the main loop for its
+//!                     40 us execution time (datasheet value), so a full 20x4
+//!                     screen takes at least 3.4 ms. In queued mode a character
+//!                     only costs the store in the queue; the main loop time
+//!                     has not been measured on hardware. When the queue is
+//!                     full, the calls fail with Error::NOT_READY instead of
+//!                     waiting; \ref getQueueFree() tells how many entries
+//!                     fit, and \ref printAsync() retries on its own.
+//!                 While the queue is active, the interrupt drives RS, E and the
+//!                     data pins. GpioPin and GpioBus writes are atomic, so
+//!                     other pins of the same ports can still be driven
+//!                     through them from the main loop; direct PORTx
+//!                     read-modify-write code touching those ports must be
+//!                     wrapped in an ATOMIC_BLOCK.
 //!
 class Hd44780
 {
@@ -403,6 +457,210 @@ public:
             cchar_t *string_p
     );
 
+    //     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+    //!
+    //! \brief      Clears the shadow buffer.
+    //! \details    Fills the shadow buffer with spaces and moves the buffer
+    //!                 cursor to the first position. The display is only
+    //!                 updated by \ref refresh().
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferClear(
+            void
+    );
+
+    //!
+    //! \brief      Moves the shadow buffer cursor.
+    //! \details    Moves the cursor used by \ref bufferPrint().
+    //! \param      line_p              Line (0 to lines - 1)
+    //! \param      column_p            Column (0 to columns - 1)
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferGoTo(
+            cuint8_t line_p,
+            cuint8_t column_p
+    );
+
+    //!
+    //! \brief      Prints a character to the shadow buffer.
+    //! \details    Writes a character at the buffer cursor and marks it as
+    //!                 dirty if it differs from the buffered one. A line feed
+    //!                 fills the rest of the line with spaces and moves to the
+    //!                 next line. Characters past the end of the line are
+    //!                 discarded.
+    //! \param      character_p         Character to be printed
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferPrint(
+            cchar_t character_p
+    );
+
+    //!
+    //! \brief      Prints a string to the shadow buffer.
+    //! \details    Prints each character of the string with \ref
+    //!                 bufferPrint(cchar_t).
+    //! \param      string_p            String to be printed
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferPrint(
+            cchar_t *string_p
+    );
+
+    //!
+    //! \brief      Marks the whole shadow buffer as dirty.
+    //! \details    Forces the next \ref refresh() to redraw every character.
+    //!                 Must be called after the display is written directly
+    //!                 with \ref print() or \ref printAsync().
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferInvalidate(
+            void
+    );
+
+    //!
+    //! \brief      Sends the changed characters to the display.
+    //! \details    Sends only the dirty runs of the shadow buffer. A DDRAM
+    //!                 address command is only sent when the next dirty
+    //!                 character is not at the controller address counter; a
+    //!                 single clean character between two runs is rewritten
+    //!                 instead, since it costs the same as the command. The
+    //!                 display must be in Step::INCREMENT / DisplayMode::OVERWRITE
+    //!                 entry mode. The cursor position is restored at the end.
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t refresh(
+            void
+    );
+
+    //     /////////////////////    QUEUED MODE     /////////////////////     //
+
+    //!
+    //! \brief      Enables the queued mode.
+    //! \details    From now on, commands and characters are stored in a FIFO
+    //!                 and return immediately; if the FIFO is full they fail
+    //!                 with Error::NOT_READY. The busy flag is not used in
+    //!                 queued mode; the pacing is derived from the interrupt
+    //!                 period, which is also the enable pulse width.
+    //! \param      tickPeriodUs_p      Period of the \ref queueHandler()
+    //!                                     calls, in microseconds (8 to 255)
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t enableQueue(
+            cuint8_t tickPeriodUs_p
+    );
+
+    //!
+    //! \brief      Disables the queued mode.
+    //! \details    Waits until the FIFO is empty and returns to direct mode.
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t disableQueue(
+            void
+    );
+
+    //!
+    //! \brief      Checks if the queue is still sending.
+    //! \details    Checks if there are entries in the FIFO or if the last
+    //!                 command is still being executed.
+    //! \retval     true                Busy.
+    //! \retval     false               Idle.
+    //!
+    bool_t inlined isBusy(
+            void
+    ) {
+        return (bool_t)((this->_queueHead != this->_queueTail) || (this->_queueWait != 0) ||
+                        (this->_queuePhase != 0));
+    }
+
+    //!
+    //! \brief      Returns the free room in the queue.
+    //! \details    Returns how many commands and characters can be stored in
+    //!                 the queue before the calls fail with Error::NOT_READY.
+    //!                 A line feed takes one entry per column left plus one.
+    //! \return     uint8_t             Free entries.
+    //!
+    uint8_t inlined getQueueFree(
+            void
+    ) {
+        return (uint8_t)(HD44780_QUEUE_SIZE - (uint8_t)(this->_queueHead - this->_queueTail));
+    }
+
+    //!
+    //! \brief      Waits until the queue is idle.
+    //! \details    Blocks until every queued entry has been sent and
+    //!                 executed. Interrupts must be enabled.
+    //!
+    void waitIdle(
+            void
+    );
+
+    //!
+    //! \brief      Sends the next queued entry.
+    //! \details    Must be called every tick period given to \ref
+    //!                 enableQueue(), from a timer compare interrupt callback.
+    //!                 Each call does a single step (start of the entry, end
+    //!                 of an enable pulse, next nibble or execution wait), so
+    //!                 the enable pulses last one tick and the handler never
+    //!                 busy-waits.
+    //!
+    void queueHandler(
+            void
+    );
+
+    //     ////////////////////     NON-BLOCKING     ////////////////////     //
+
+    //!
+    //! \brief      Prints a string without blocking.
+    //! \details    Schedules a string to be printed by \ref poll(), one
+    //!                 character per call. The string must remain valid until
+    //!                 \ref isPrinting() returns false. If \a clearScreen_p is
+    //!                 true, the screen is cleared first and the 2 ms clear
+    //!                 time is spent sleeping instead of busy-waiting.
+    //! \param[in]  string_p            String to be printed.
+    //! \param[in]  clearScreen_p       Clears the screen before printing.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t printAsync(
+            cchar_t *string_p,
+            cbool_t clearScreen_p               = false
+    );
+
+    //!
+    //! \brief      Checks if a non-blocking print is in progress.
+    //! \details    Checks if a non-blocking print is in progress.
+    //! \retval     true                Print in progress.
+    //! \retval     false               Idle.
+    //!
+    bool_t inlined isPrinting(
+            void
+    ) {
+        return (bool_t)(isPointerValid(this->_asyncString) || this->_asyncClear);
+    }
+
+    //!
+    //! \brief      Runs one step of the non-blocking print.
+    //! \details    Runs one step of the non-blocking print. Must be called
+    //!                 periodically, usually through \ref pollTask().
+    //! \return     TaskStatus          Task status.
+    //!
+    TaskStatus poll(
+            void
+    );
+
+    //!
+    //! \brief      Scheduler task wrapper.
+    //! \details    Scheduler task wrapper, to be registered as
+    //!                 scheduler.addTask(Hd44780::pollTask, &display).
+    //! \param[in]  context_p           Pointer to the Hd44780 object.
+    //! \return     TaskStatus          Task status.
+    //!
+    static TaskStatus pollTask(
+            void *context_p
+    );
+
     //!
     //! \brief      Brief description
     //! \details    Long description
@@ -434,6 +692,71 @@ private:
             uint8_t command_p
     );
 
+    //!
+    //! \brief      Sends a command without the execution delay.
+    //! \details    Sends a command to the LCD controller without waiting for
+    //!                 the command execution time.
+    //! \param      command_p           Command to be sent.
+    //! \return     bool_t              Return info
+    //!
+    bool_t _sendCommand(
+            uint8_t command_p
+    );
+
+    //!
+    //! \brief      Sends a byte to the controller.
+    //! \details    Sends a byte to the LCD controller, without checking the
+    //!                 busy flag nor waiting for the execution time.
+    //! \param      data_p              Byte to be sent.
+    //! \param      isData_p            True for DDRAM/CGRAM data, false for
+    //!                                     commands.
+    //!
+    void _sendByte(
+            uint8_t data_p,
+            bool_t isData_p
+    );
+
+    //!
+    //! \brief      Stores an entry in the queue.
+    //! \details    Stores a command or character in the queue. Does not wait
+    //!                 for room.
+    //! \param      data_p              Byte to be sent.
+    //! \param      isData_p            True for DDRAM/CGRAM data, false for
+    //!                                     commands.
+    //! \retval     true                Success.
+    //! \retval     false               Queue is full.
+    //!
+    bool_t _queuePush(
+            uint8_t data_p,
+            bool_t isData_p
+    );
+
+    //!
+    //! \brief      Checks the room in the queue.
+    //! \details    Checks if a sequence of entries fits the queue, so that it
+    //!                 is not split by a full queue. Always succeeds in direct
+    //!                 mode.
+    //! \param      entries_p           Number of entries.
+    //! \return     bool_t              True if it fits / False otherwise
+    //!                                     (Error::NOT_READY).
+    //!
+    bool_t _checkQueueRoom(
+            cuint8_t entries_p
+    );
+
+    //!
+    //! \brief      Shadow buffer write function.
+    //! \details    Sends a byte on behalf of \ref Hd44780ShadowBuffer::refresh().
+    //! \param      context_p           Display object
+    //! \param      data_p              Byte to be sent
+    //! \param      isData_p            True for DDRAM data, false for commands
+    //!
+    static void _shadowWrite(
+            void *context_p,
+            cuint8_t data_p,
+            cbool_t isData_p
+    );
+
     //!
     //! \brief      Brief description
     //! \details    Long description
@@ -499,6 +822,31 @@ private:
     bool_t          _cursorOn                   : 1;    // 0 off, 1 on
     bool_t          _displayOn                  : 1;    // 0 off, 1 on
 
+    //     ////////////////////     NON-BLOCKING     ////////////////////     //
+
+    TaskContext     _asyncTask;
+    cchar_t         *_asyncString;
+    uint8_t         _asyncIndex;
+    bool_t          _asyncClear                 : 1;
+
+    //     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+    Hd44780ShadowBuffer _shadow;
+
+    //     /////////////////////    QUEUED MODE     /////////////////////     //
+
+    uint8_t         _queue[HD44780_QUEUE_SIZE];
+    uint8_t         _queueIsData[HD44780_QUEUE_SIZE / 8];  // One bit per entry
+    vuint8_t        _queueHead;
+    vuint8_t        _queueTail;
+    vuint8_t        _queueWait;
+    vuint8_t        _queuePhase;                // Step of the entry being sent
+    uint8_t         _queueEntry;                // Entry being sent
+    bool_t          _queueEntryIsData;
+    uint8_t         _queueShortWait;
+    uint8_t         _queueLongWait;
+    bool_t          _queueEnabled               : 1;
+
 protected:
 
     // NONE
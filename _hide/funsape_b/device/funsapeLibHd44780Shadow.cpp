@@ -0,0 +1,270 @@
+//!
+//! \file           funsapeLibHd44780Shadow.cpp
+//! \brief          Hd44780 shadow buffer for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Dirty-tracking copy of the Hd44780 DDRAM, shared by the
+//!                     parallel (Hd44780) and the PCF8574 (TwiHd44780)
+//!                     drivers.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibHd44780Shadow.hpp"
+#if !defined(__FUNSAPE_LIB_HD44780_SHADOW_HPP)
+#   error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_HD44780_SHADOW_HPP != 2407
+#   error "Version mismatch between source and header files!"
+#endif
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define LCD_DDRAM_ADDRESS_SET           0x80
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static function declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+Hd44780ShadowBuffer::Hd44780ShadowBuffer(void)
+{
+    this->_lastLine                     = 0;
+    this->_lastColumn                   = 0;
+    this->reset();
+
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+void Hd44780ShadowBuffer::setSize(cuint8_t lines_p, cuint8_t columns_p)
+{
+    this->_lastLine                     = lines_p - 1;
+    this->_lastColumn                   = columns_p - 1;
+    this->reset();
+
+    return;
+}
+
+void Hd44780ShadowBuffer::reset(void)
+{
+    for(uint8_t i = 0; i < constHd44780ShadowBufferSize; i++) {
+        this->_buffer[i]                = ' ';
+    }
+    for(uint8_t i = 0; i < (constHd44780ShadowBufferSize / 8); i++) {
+        this->_dirty[i]                 = 0;
+    }
+    this->_line                         = 0;
+    this->_column                       = 0;
+
+    return;
+}
+
+void Hd44780ShadowBuffer::clear(void)
+{
+    // Local variables
+    uint8_t size                        = (this->_lastLine + 1) * (this->_lastColumn + 1);
+
+    // Fills buffer with spaces
+    for(uint8_t i = 0; i < size; i++) {
+        this->_write(i, ' ');
+    }
+    this->_line                         = 0;
+    this->_column                       = 0;
+
+    return;
+}
+
+bool_t Hd44780ShadowBuffer::goTo(cuint8_t line_p, cuint8_t column_p)
+{
+    if((line_p > this->_lastLine) || (column_p > this->_lastColumn)) {
+        return false;
+    }
+
+    this->_line                         = line_p;
+    this->_column                       = column_p;
+
+    return true;
+}
+
+void Hd44780ShadowBuffer::print(cchar_t character_p)
+{
+    // Local variables
+    uint8_t columns                     = this->_lastColumn + 1;
+    uint8_t index                       = this->_line * columns;
+
+    if(character_p == '\n') {
+        for(uint8_t i = this->_column; i < columns; i++) {
+            this->_write(index + i, ' ');
+        }
+        this->_line                     = (this->_line + 1) % (this->_lastLine + 1);
+        this->_column                   = 0;
+    } else if(this->_column < columns) {
+        this->_write(index + this->_column, character_p);
+        this->_column++;
+    }
+
+    return;
+}
+
+void Hd44780ShadowBuffer::invalidate(void)
+{
+    for(uint8_t i = 0; i < (constHd44780ShadowBufferSize / 8); i++) {
+        this->_dirty[i]                 = 0xFF;
+    }
+
+    return;
+}
+
+void Hd44780ShadowBuffer::refresh(hd44780ShadowWrite_t write_p, void *context_p, cuint8_t cursorAddress_p)
+{
+    // Local variables
+    uint8_t index                       = 0;
+    uint8_t address                     = 0;
+    uint8_t addressCounter              = 0xFF;     // Unknown
+    bool_t written                      = false;
+
+    // Sends dirty runs
+    for(uint8_t line = 0; line <= this->_lastLine; line++) {
+        for(uint8_t column = 0; column <= this->_lastColumn; column++, index++) {
+            if(!isBitSet(this->_dirty[index >> 3], (index & 0x07))) {
+                continue;
+            }
+            address = this->getDdramAddress(line, column);
+            if(address != addressCounter) {
+                if((column > 0) && (address == (uint8_t)(addressCounter + 1))) {
+                    // One clean character apart, rewriting is cheaper than moving
+                    write_p(context_p, this->_buffer[index - 1], true);
+                } else {
+                    write_p(context_p, (LCD_DDRAM_ADDRESS_SET | address), false);
+                }
+            }
+            write_p(context_p, this->_buffer[index], true);
+            clrBit(this->_dirty[index >> 3], (index & 0x07));
+            addressCounter = address + 1;
+            written = true;
+        }
+    }
+
+    // Restores cursor position
+    if(written && (cursorAddress_p != 0xFF)) {
+        write_p(context_p, (LCD_DDRAM_ADDRESS_SET | cursorAddress_p), false);
+    }
+
+    return;
+}
+
+uint8_t Hd44780ShadowBuffer::getDdramAddress(cuint8_t line_p, cuint8_t column_p)
+{
+    // Local variables
+    uint8_t address                     = 0xFF;
+
+    switch(line_p) {
+    case 0:     // Go to line 0
+        address = column_p;
+        break;
+    case 1:     // Go to line 1
+        address = (this->_lastLine >= 1) ? (0x40 + column_p) : 0xFF;
+        break;
+    case 2:     // Go to line 2
+        if((this->_lastLine == 3) && (this->_lastColumn == 11)) {           // Display 12x4
+            address = 0x0C + column_p;
+        } else if((this->_lastLine == 3) && (this->_lastColumn == 15)) {    // Display 16x4
+            address = 0x10 + column_p;
+        } else if((this->_lastLine == 3) && (this->_lastColumn == 19)) {    // Display 20x4
+            address = 0x14 + column_p;
+        }
+        break;
+    case 3:     // Go to line 3
+        if((this->_lastLine == 3) && (this->_lastColumn == 11)) {           // Display 12x4
+            address = 0x4C + column_p;
+        } else if((this->_lastLine == 3) && (this->_lastColumn == 15)) {    // Display 16x4
+            address = 0x50 + column_p;
+        } else if((this->_lastLine == 3) && (this->_lastColumn == 19)) {    // Display 20x4
+            address = 0x54 + column_p;
+        }
+        break;
+    }
+
+    return address;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+void Hd44780ShadowBuffer::_write(cuint8_t index_p, cuint8_t character_p)
+{
+    if(this->_buffer[index_p] != character_p) {
+        this->_buffer[index_p]          = character_p;
+        setBit(this->_dirty[index_p >> 3], (index_p & 0x07));
+    }
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interruption handlers
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,246 @@
+//!
+//! \file           funsapeLibHd44780Shadow.hpp
+//! \brief          Hd44780 shadow buffer for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Dirty-tracking copy of the Hd44780 DDRAM, shared by the
+//!                     parallel (Hd44780) and the PCF8574 (TwiHd44780)
+//!                     drivers. The driver only supplies the function that
+//!                     sends a byte to the controller.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_HD44780_SHADOW_HPP
+#define __FUNSAPE_LIB_HD44780_SHADOW_HPP                2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////    GLOBAL DEFINITIONS FILE     /////////////////     //
+
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_HD44780_SHADOW_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+
+// NONE
+
+//     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
+
+// NONE
+
+//     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
+
+// NONE
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+cuint8_t constHd44780ShadowBufferSize   = 80;       //!< Characters of the largest display (20x4 or 40x2)
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+//!
+//! \brief          Shadow buffer write function
+//! \details        Sends a byte to the controller on behalf of \ref
+//!                     Hd44780ShadowBuffer::refresh().
+//! \param          context_p           Driver object
+//! \param          data_p              Byte to be sent
+//! \param          isData_p            True for DDRAM data, false for commands
+//!
+typedef void (*hd44780ShadowWrite_t)(void *context_p, cuint8_t data_p, cbool_t isData_p);
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Classes
+// =============================================================================
+
+//!
+//! \brief          Hd44780ShadowBuffer class
+//! \details        Holds one byte per display position and one dirty bit per
+//!                     position. \ref refresh() sends only the dirty runs,
+//!                     through the write function given by the driver.
+//!
+class Hd44780ShadowBuffer
+{
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      Hd44780ShadowBuffer class constructor
+    //! \details    Creates an empty 1x1 shadow buffer.
+    //!
+    Hd44780ShadowBuffer(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods - Class own methods ---------------------------------------------
+public:
+
+    //!
+    //! \brief      Sets the display size.
+    //! \details    Sets the display size and resets the buffer.
+    //! \param      lines_p             Number of lines (1 to 4)
+    //! \param      columns_p           Number of columns (1 to 40)
+    //!
+    void setSize(
+            cuint8_t lines_p,
+            cuint8_t columns_p
+    );
+
+    //!
+    //! \brief      Resets the shadow buffer.
+    //! \details    Fills the buffer with spaces and clears the dirty flags,
+    //!                 matching a cleared display.
+    //!
+    void reset(
+            void
+    );
+
+    //!
+    //! \brief      Clears the shadow buffer.
+    //! \details    Fills the buffer with spaces, marking the changed
+    //!                 positions as dirty, and moves the buffer cursor to the
+    //!                 first position.
+    //!
+    void clear(
+            void
+    );
+
+    //!
+    //! \brief      Moves the buffer cursor.
+    //! \param      line_p              Line (0 to lines - 1)
+    //! \param      column_p            Column (0 to columns - 1)
+    //! \return     bool_t              False if the position is invalid
+    //!
+    bool_t goTo(
+            cuint8_t line_p,
+            cuint8_t column_p
+    );
+
+    //!
+    //! \brief      Prints a character to the shadow buffer.
+    //! \details    Writes a character at the buffer cursor and marks it as
+    //!                 dirty if it differs from the buffered one. A line feed
+    //!                 fills the rest of the line with spaces and moves to the
+    //!                 next line. Characters past the end of the line are
+    //!                 discarded.
+    //! \param      character_p         Character to be printed
+    //!
+    void print(
+            cchar_t character_p
+    );
+
+    //!
+    //! \brief      Marks the whole buffer as dirty.
+    //!
+    void invalidate(
+            void
+    );
+
+    //!
+    //! \brief      Sends the changed characters to the display.
+    //! \details    Sends only the dirty runs. A DDRAM address command is only
+    //!                 sent when the next dirty character is not at the
+    //!                 controller address counter; a single clean character
+    //!                 between two runs is rewritten instead, since it costs
+    //!                 the same as the command. The display must be in
+    //!                 increment / overwrite entry mode.
+    //! \param      write_p             Driver write function
+    //! \param      context_p           Driver object
+    //! \param      cursorAddress_p     DDRAM address restored at the end if
+    //!                                     anything was sent (0xFF for none)
+    //!
+    void refresh(
+            hd44780ShadowWrite_t write_p,
+            void *context_p,
+            cuint8_t cursorAddress_p
+    );
+
+    //!
+    //! \brief      Returns the DDRAM address of a position.
+    //! \details    Returns the DDRAM address of a position, according to the
+    //!                 display size.
+    //! \param      line_p              Line
+    //! \param      column_p            Column
+    //! \return     uint8_t             DDRAM address or 0xFF if invalid
+    //!
+    uint8_t getDdramAddress(
+            cuint8_t line_p,
+            cuint8_t column_p
+    );
+
+private:
+
+    void _write(
+            cuint8_t index_p,
+            cuint8_t character_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+
+    uint8_t         _buffer[constHd44780ShadowBufferSize];
+    uint8_t         _dirty[constHd44780ShadowBufferSize / 8];
+    uint8_t         _line;                      // Buffer cursor
+    uint8_t         _column;
+    uint8_t         _lastLine;                  // Lines - 1
+    uint8_t         _lastColumn;                // Columns - 1
+
+}; // class Hd44780ShadowBuffer
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __FUNSAPE_LIB_HD44780_SHADOW_HPP
+
+// =============================================================================
+// END OF FILE - funsapeLibHd44780Shadow.hpp
+// =============================================================================
@@ -21,6 +21,10 @@
 #   error "Version mismatch between source and header files!"
 #endif
 
+#if defined(_FUNSAPE_PLATFORM_AVR)
+#   include <util/atomic.h>
+#endif
+
 // =============================================================================
 // File exclusive - Constants
 // =============================================================================
@@ -68,7 +72,15 @@ Keypad::Keypad(void)
     this->_isKeyValuesSet               = false;
     this->_isInitialized                = false;
     this->_debounceTime                 = constKeypadDefaultDebounceTime;
-    this->_keyValue                     = nullptr;
+    this->_keyMap                       = nullptr;
+    this->_isKeyMapInFlash              = false;
+    this->_isScanning                   = false;
+    this->_scanColumn                   = 0;
+    this->_debounceCount                = constKeypadDefaultDebounceCount;
+    this->_longPressCount               = constKeypadDefaultLongPressCount;
+    this->_keyState                     = 0;
+    this->_eventHead                    = 0;
+    this->_eventTail                    = 0;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -81,11 +93,6 @@ Keypad::~Keypad(void)
     // Marks passage for debugging purpose
     debugMark("Keypad::~Keypad(void)", Debug::CodeIndex::KEYPAD_MODULE);
 
-    // Deallocate memory
-    if(isPointerValid(this->_keyValue)) {
-        free(this->_keyValue);
-    }
-
     // Returns successfully
     this->_lastError = Error::NONE;
     debugMessage(Error::NONE, Debug::CodeIndex::KEYPAD_MODULE);
@@ -203,10 +210,8 @@ bool_t Keypad::setKeyValues(Type type_p, ...)
 
     // Resets data members
     this->_isKeyValuesSet               = false;
-    if(isPointerValid(this->_keyValue)) {
-        free(this->_keyValue);
-    }
-    this->_keyValue                     = nullptr;
+    this->_isScanning                   = false;
+    this->_keyMap                       = nullptr;
 
     // Updates data members
     switch(type_p) {
@@ -221,25 +226,18 @@ bool_t Keypad::setKeyValues(Type type_p, ...)
     }
     this->_type                         = type_p;
 
-    // Allocates memory
-    this->_keyValue = (uint8_t *)realloc(this->_keyValue, (this->_linesMax + 1) * (this->_columnsMax + 1));
-    if(!isPointerValid(this->_keyValue)) {
-        // Returns error
-        this->_lastError = Error::MEMORY_ALLOCATION;
-        debugMessage(Error::MEMORY_ALLOCATION, Debug::CodeIndex::KEYPAD_MODULE);
-        return false;
-    }
-
     // Updates key values
     do {
         va_list auxArgs;
         va_start(auxArgs, type_p);
         for(uint8_t i = 0; i < (this->_linesMax + 1); i++) {
             for(uint8_t j  = 0; j < (this->_columnsMax + 1); j++) {
-                this->_keyValue[((this->_linesMax + 1) *  i) + j] = (uint8_t)va_arg(auxArgs, int16_t);
+                this->_keyValue[((this->_columnsMax + 1) *  i) + j] = (uint8_t)va_arg(auxArgs, int16_t);
             }
         }
         va_end(auxArgs);
+        this->_keyMap = this->_keyValue;
+        this->_isKeyMapInFlash = false;
         this->_isKeyValuesSet = true;
     } while(0);
 
@@ -249,6 +247,46 @@ bool_t Keypad::setKeyValues(Type type_p, ...)
     return true;
 }
 
+bool_t Keypad::setKeyMap(Type type_p, const uint8_t *keyMap_p)
+{
+    // Marks passage for debugging purpose
+    debugMark("Keypad::setKeyMap(Keypad::Type, const uint8_t *)", Debug::CodeIndex::KEYPAD_MODULE);
+
+    // Resets data members
+    this->_isKeyValuesSet               = false;
+    this->_isScanning                   = false;
+    this->_keyMap                       = nullptr;
+
+    // Check for errors
+    if(!isPointerValid(keyMap_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::KEYPAD_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    switch(type_p) {
+    case Type::KEYPAD_4X4:  this->_linesMax = 3;    this->_columnsMax = 3;  break;
+    case Type::KEYPAD_4X3:  this->_linesMax = 3;    this->_columnsMax = 2;  break;
+    case Type::KEYPAD_5X3:  this->_linesMax = 4;    this->_columnsMax = 2;  break;
+    default:
+        // Returns error
+        this->_lastError = Error::KEYPAD_TYPE_UNSUPPORTED;
+        debugMessage(Error::KEYPAD_TYPE_UNSUPPORTED, Debug::CodeIndex::KEYPAD_MODULE);
+        return false;
+    }
+    this->_type                         = type_p;
+    this->_keyMap                       = keyMap_p;
+    this->_isKeyMapInFlash              = true;
+    this->_isKeyValuesSet               = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::KEYPAD_MODULE);
+    return true;
+}
+
 bool_t Keypad::readKeyPressed(uint8_t *keyPressedValue_p)
 {
     // Local variables
@@ -266,6 +304,26 @@ bool_t Keypad::readKeyPressed(uint8_t *keyPressedValue_p)
         return false;
     }
 
+    // Background scan running: returns the first debounced key
+    if(this->_isScanning) {
+        uint16_t auxState;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            auxState = this->_keyState;
+        }
+        for(uint8_t i = 0; auxState; i++, auxState >>= 1) {
+            if(auxState & 0x0001) {
+                auxKey = this->_getKeyValue(i);
+                break;
+            }
+        }
+        *keyPressedValue_p = auxKey;
+
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::KEYPAD_MODULE);
+        return true;
+    }
+
     // Keypad sweep
     for(uint8_t i = 0; i <= this->_columnsMax; i++) {                   // For each column
         this->_gpioColumns->clr(i);                                     // Clear one column
@@ -273,7 +331,7 @@ bool_t Keypad::readKeyPressed(uint8_t *keyPressedValue_p)
         uint8_t aux8 = this->_gpioLines->read();                        // Reads lines
         for(uint8_t j = 0; j <= this->_linesMax; j++) {                 // For each line
             if(isBitClr(aux8, j)) {                                     // Tests if the key is pressed
-                auxKey = this->_keyValue[((this->_linesMax + 1) * j) + i];      // Decodes the key using the table
+                auxKey = this->_getKeyValue(((this->_columnsMax + 1) * j) + i); // Decodes the key using the table
                 for(uint8_t k = 0; k < this->_debounceTime; k++) {
                     _delay_ms(1);                                       // Debounce time
                 }
@@ -295,6 +353,152 @@ bool_t Keypad::readKeyPressed(uint8_t *keyPressedValue_p)
     return true;
 }
 
+bool_t Keypad::startScan(cuint8_t debounceCount_p, cuint8_t longPressCount_p)
+{
+    // Marks passage for debugging purpose
+    debugMark("Keypad::startScan(cuint8_t, cuint8_t)", Debug::CodeIndex::KEYPAD_MODULE);
+
+    // Checks for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::KEYPAD_MODULE);
+        return false;
+    }
+    if(debounceCount_p == 0) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::KEYPAD_MODULE);
+        return false;
+    }
+
+    // Resets scan state
+    this->_isScanning = false;
+    for(uint8_t i = 0; i < constKeypadMaxKeys; i++) {
+        this->_keyIntegrator[i] = 0;
+        this->_keyHoldCount[i] = 0;
+    }
+    this->_keyState = 0;
+    this->_eventHead = 0;
+    this->_eventTail = 0;
+    this->_debounceCount = debounceCount_p;
+    this->_longPressCount = longPressCount_p;
+
+    // Drives the first column, read at the next interrupt
+    this->_gpioColumns->set();
+    this->_scanColumn = 0;
+    this->_gpioColumns->clr(0);
+    this->_isScanning = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::KEYPAD_MODULE);
+    return true;
+}
+
+bool_t Keypad::stopScan(void)
+{
+    // Marks passage for debugging purpose
+    debugMark("Keypad::stopScan(void)", Debug::CodeIndex::KEYPAD_MODULE);
+
+    // Stops scan and releases columns
+    this->_isScanning = false;
+    if(this->_isInitialized) {
+        this->_gpioColumns->set();
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::KEYPAD_MODULE);
+    return true;
+}
+
+bool_t Keypad::getEvent(uint8_t *keyValue_p, Event *event_p)
+{
+    // Local variables
+    uint8_t auxIndex;
+
+    // Checks for errors
+    if((!isPointerValid(keyValue_p)) || (!isPointerValid(event_p))) {
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::KEYPAD_MODULE);
+        return false;
+    }
+    if(this->_eventHead == this->_eventTail) {
+        this->_lastError = Error::BUFFER_EMPTY;
+        return false;
+    }
+
+    // Pops event
+    auxIndex = this->_eventTail & (KEYPAD_EVENT_QUEUE_SIZE - 1);
+    *keyValue_p = this->_eventKey[auxIndex];
+    *event_p = this->_eventType[auxIndex];
+    this->_eventTail++;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+void Keypad::interruptHandler(void)
+{
+    // Local variables
+    uint8_t auxLines;
+    uint8_t auxColumn;
+    uint8_t auxIndex;
+    uint16_t auxState;
+    uint16_t auxMask;
+
+    // CHECK - not scanning
+    if(!this->_isScanning) {
+        return;
+    }
+
+    // Reads lines of the column driven at the previous call
+    auxLines = this->_gpioLines->read();
+    auxColumn = this->_scanColumn;
+    auxState = this->_keyState;
+
+    // Integrates each key of the column
+    auxIndex = auxColumn;
+    for(uint8_t line = 0; line <= this->_linesMax; line++, auxIndex += (this->_columnsMax + 1)) {
+        auxMask = ((uint16_t)1 << auxIndex);
+        if(isBitClr(auxLines, line)) {
+            // Pressed sample
+            if(this->_keyIntegrator[auxIndex] < this->_debounceCount) {
+                if(++this->_keyIntegrator[auxIndex] == this->_debounceCount) {
+                    if(!(auxState & auxMask)) {
+                        auxState |= auxMask;
+                        this->_keyHoldCount[auxIndex] = 0;
+                        this->_pushEvent(auxIndex, Event::PRESS);
+                    }
+                }
+            } else if((auxState & auxMask) && (this->_keyHoldCount[auxIndex] < this->_longPressCount)) {
+                if(++this->_keyHoldCount[auxIndex] == this->_longPressCount) {
+                    this->_pushEvent(auxIndex, Event::LONG_PRESS);
+                }
+            }
+        } else {
+            // Released sample
+            if(this->_keyIntegrator[auxIndex] > 0) {
+                if((--this->_keyIntegrator[auxIndex] == 0) && (auxState & auxMask)) {
+                    auxState &= ~auxMask;
+                    this->_pushEvent(auxIndex, Event::RELEASE);
+                }
+            }
+        }
+    }
+    this->_keyState = auxState;
+
+    // Drives next column
+    this->_gpioColumns->set();
+    auxColumn = (auxColumn == this->_columnsMax) ? 0 : (auxColumn + 1);
+    this->_gpioColumns->clr(auxColumn);
+    this->_scanColumn = auxColumn;
+
+    return;
+}
+
 Error Keypad::getLastError(void)
 {
     // Returns last error
@@ -305,7 +509,33 @@ Error Keypad::getLastError(void)
 // Class private methods
 // =============================================================================
 
-// NONE
+uint8_t Keypad::_getKeyValue(cuint8_t keyIndex_p)
+{
+    // Returns key value from the key map
+    if(this->_isKeyMapInFlash) {
+        return pgm_read_byte(&this->_keyMap[keyIndex_p]);
+    }
+    return this->_keyMap[keyIndex_p];
+}
+
+void Keypad::_pushEvent(cuint8_t keyIndex_p, const Event event_p)
+{
+    // Local variables
+    uint8_t auxIndex = this->_eventHead;
+
+    // Queue full, event is dropped
+    if((uint8_t)(auxIndex - this->_eventTail) >= KEYPAD_EVENT_QUEUE_SIZE) {
+        return;
+    }
+
+    // Pushes event
+    auxIndex &= (KEYPAD_EVENT_QUEUE_SIZE - 1);
+    this->_eventKey[auxIndex] = this->_getKeyValue(keyIndex_p);
+    this->_eventType[auxIndex] = event_p;
+    this->_eventHead++;
+
+    return;
+}
 
 // =============================================================================
 // Class protected methods
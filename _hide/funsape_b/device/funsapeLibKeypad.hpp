@@ -49,11 +49,11 @@
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 #include <stdarg.h>
-#include <stdlib.h>
 
 //     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
 
 #include <avr/builtins.h>
+#include <avr/pgmspace.h>
 
 // =============================================================================
 // Undefining previous definitions
@@ -66,6 +66,23 @@
 // =============================================================================
 
 cuint8_t constKeypadDefaultDebounceTime         = 1;    //!< Default debounce time
+cuint8_t constKeypadMaxKeys                     = 16;   //!< Keys of the largest supported keypad
+cuint8_t constKeypadDefaultDebounceCount        = 4;    //!< Default debounce, in scans
+cuint8_t constKeypadDefaultLongPressCount       = 200;  //!< Default long press time, in scans
+
+#ifndef KEYPAD_EVENT_QUEUE_SIZE
+//!
+//! \brief          Keypad event queue size
+//! \details        Number of key events buffered between the scan interrupt and
+//!                     the application.
+//!
+#   define KEYPAD_EVENT_QUEUE_SIZE      8
+#endif
+#if (KEYPAD_EVENT_QUEUE_SIZE & (KEYPAD_EVENT_QUEUE_SIZE - 1)) != 0
+#   error "KEYPAD_EVENT_QUEUE_SIZE must be a power of two!"
+#elif KEYPAD_EVENT_QUEUE_SIZE > 128
+#   error "KEYPAD_EVENT_QUEUE_SIZE must be at most 128!"
+#endif
 
 // =============================================================================
 // New data types
@@ -93,6 +110,16 @@ cuint8_t constKeypadDefaultDebounceTime         = 1;    //!< Default debounce ti
 //! \brief          Keypad class
 //! \details        Keypad class with support to 4x3, 4x4 and 5x3 keypads and
 //!                     configurable debounce time.
+//!                 The keypad can be read by the blocking \ref readKeyPressed()
+//!                     or scanned in background by calling
+//!                     \ref interruptHandler() from a timer compare match
+//!                     callback (e.g. every 1 ms). Each call reads the column
+//!                     driven in the previous call, so the lines settle without
+//!                     busy waits, and drives the next one. Every key has its
+//!                     own integrating debounce counter, so any number of keys
+//!                     can be pressed at once (ghosting is avoided only if the
+//!                     keypad has diodes). Press, release and long press events
+//!                     are queued and read by \ref getEvent().
 //!
 class Keypad
 {
@@ -112,6 +139,18 @@ public:
         KEYPAD_5X3                      = 2
     };
 
+    //     ////////////////////    KEY EVENTS     /////////////////////     //
+
+    //!
+    //! \brief      Key event
+    //! \details    Key event type enumeration.
+    //!
+    enum class Event : uint8_t {
+        PRESS                           = 0,
+        RELEASE                         = 1,
+        LONG_PRESS                      = 2
+    };
+
 private:
 
     // NONE
@@ -203,6 +242,19 @@ public:
             ...
     );
 
+    //!
+    //! \brief      Sets the keypad type and key map
+    //! \details    This function sets the keypad type and a key map stored in
+    //!                 program memory, with one value per key, line by line.
+    //! \param      type_p              Keypad type
+    //! \param      keyMap_p            Pointer to key map (PROGMEM)
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t setKeyMap(
+            Type type_p,
+            const uint8_t *keyMap_p
+    );
+
     //!
     //! \brief      Reads the pressed key on the keypad.
     //! \details    This function gets the keypad status and decodes the pressed
@@ -214,6 +266,52 @@ public:
             uint8_t *keyPressedValue_p
     );
 
+    //     //////////////////    BACKGROUND SCAN     ///////////////////     //
+
+    //!
+    //! \brief      Starts the background scan
+    //! \details    Enables the scan performed by \ref interruptHandler(). While
+    //!                 scanning, \ref readKeyPressed() returns immediately the
+    //!                 first debounced pressed key.
+    //! \param      debounceCount_p     Consecutive scans to accept a change
+    //! \param      longPressCount_p    Scans a key must be held to generate a
+    //!                                     long press event (0 disables)
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t startScan(
+            cuint8_t debounceCount_p    = constKeypadDefaultDebounceCount,
+            cuint8_t longPressCount_p   = constKeypadDefaultLongPressCount
+    );
+
+    //!
+    //! \brief      Stops the background scan
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t stopScan(
+            void
+    );
+
+    //!
+    //! \brief      Gets the oldest key event
+    //! \param      keyValue_p          Pointer to store the key value
+    //! \param      event_p             Pointer to store the event type
+    //! \return     bool_t              True if an event was read / False if
+    //!                                     the queue is empty
+    //!
+    bool_t getEvent(
+            uint8_t *keyValue_p,
+            Event *event_p
+    );
+
+    //!
+    //! \brief      Scans one column
+    //! \details    Must be called from a timer compare match callback. A whole
+    //!                 keypad scan takes one call per column.
+    //!
+    void interruptHandler(
+            void
+    );
+
     Error getLastError(
             void
     );
@@ -221,7 +319,13 @@ public:
 
 private:
 
-    // NONE
+    uint8_t _getKeyValue(
+            cuint8_t keyIndex_p
+    );
+    void _pushEvent(
+            cuint8_t keyIndex_p,
+            const Event event_p
+    );
 
 protected:
 
@@ -250,9 +354,24 @@ private:
     Type                                _type;
     uint8_t                             _columnsMax     : 3;
     uint8_t                             _linesMax       : 3;
-    uint8_t                             *_keyValue;
+    bool_t                              _isKeyMapInFlash : 1;
+    const uint8_t                       *_keyMap;
+    uint8_t                             _keyValue[constKeypadMaxKeys];
     bool_t                              _debounceTime   : 7;
 
+    //     //////////////////    BACKGROUND SCAN     ///////////////////     //
+    vbool_t                             _isScanning;
+    vuint8_t                            _scanColumn;
+    uint8_t                             _debounceCount;
+    uint8_t                             _longPressCount;
+    uint8_t                             _keyIntegrator[constKeypadMaxKeys];
+    uint8_t                             _keyHoldCount[constKeypadMaxKeys];
+    vuint16_t                           _keyState;
+    uint8_t                             _eventKey[KEYPAD_EVENT_QUEUE_SIZE];
+    Event                               _eventType[KEYPAD_EVENT_QUEUE_SIZE];
+    vuint8_t                            _eventHead;
+    vuint8_t                            _eventTail;
+
 protected:
 
     // NONE
@@ -47,13 +47,14 @@
 // Global variables
 // =============================================================================
 
-// NONE
+static uint8_t fifoBurstBuffer[MAX30102_BURST_SIZE];    // Shared by all instances
 
 // =============================================================================
 // Static functions declarations
 // =============================================================================
 
 static void defaultCallbackFunction(void);
+static inline uint32_t unpackSample(const uint8_t *buffer_p, uint8_t resolutionFix_p);
 
 // =============================================================================
 // Class constructors
@@ -963,6 +964,273 @@ bool Max30102::getFifoOccupation(uint8_t *samplesWaiting_p, uint8_t *samplesLost
     return true;
 }
 
+/**
+ * @brief       Starts streaming the FIFO into a sample ring.
+ * @details     Flushes the FIFO and enables the FIFO almost full interrupt.
+ *              From then on, each call to generalIrqHandler() that finds the
+ *              almost full flag set drains the whole FIFO into the ring
+ *              before calling the FIFO almost full callback. The FIFO almost
+ *              full value set at configFifo() defines how many samples are
+ *              moved at each interrupt.
+ *              The application consumes the samples at ring.tail and
+ *              increments it; the driver writes at ring.head. Samples that
+ *              do not fit in the ring, or that were lost by the device, are
+ *              counted in ring.lost.
+ * @note        Only the heart rate and SpO2 modes are supported.
+ *
+ * \code{.cpp}
+ * uint32_t redSamples[64];
+ * uint32_t irSamples[64];
+ * Max30102::SampleRing ring = {redSamples, irSamples, 64};
+ *
+ * sensor.startStreaming(&ring);
+ * while(1) {
+ *     if(sensorIntFlag) {             // Set at the INT pin falling edge
+ *         sensorIntFlag = false;
+ *         sensor.generalIrqHandler();
+ *     }
+ *     while(ring.tail != ring.head) {
+ *         process(redSamples[ring.tail & 63], irSamples[ring.tail & 63]);
+ *         ring.tail++;
+ *     }
+ * }
+ * \endcode
+ *
+ * @param[in]   sampleRing_p    pointer to the sample ring. The ring size must
+ *                              be a power of two up to 128.
+ * @return      true        Operation successfull.
+ * @return      false       Operation failed. Retrieve error calling
+ *                          getLastError() function.
+ */
+bool Max30102::startStreaming(SampleRing *sampleRing_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Max30102::startStreaming(SampleRing *)", DEBUG_CODE_MAX3010X);
+
+    // Check function arguments for errors
+    if(!isPointerValid(sampleRing_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+    if(sampleRing_p->size == 0) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_CANNOT_BE_ZERO;
+        debugMessage(Error::ARGUMENT_CANNOT_BE_ZERO, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+    if((sampleRing_p->size > 128) || (sampleRing_p->size & (sampleRing_p->size - 1))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Check device's initialization
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Check operation mode
+    if((this->_modeControl != ModeControl::HEART_RATE_MODE) && (this->_modeControl != ModeControl::SPO2_MODE)) {
+        // Returns error
+        this->_lastError = Error::MODE_NOT_SUPPORTED;
+        debugMessage(Error::MODE_NOT_SUPPORTED, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Check the bus buffer holds at least one sample
+    if(this->_getBurstSamples(MAX30102_BYTES_PER_CHANNEL * 2) == 0) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_SMALL;
+        debugMessage(Error::BUFFER_SIZE_TOO_SMALL, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Reset the ring and the FIFO
+    this->_sampleRing = nullptr;
+    sampleRing_p->head = 0;
+    sampleRing_p->tail = 0;
+    sampleRing_p->lost = 0;
+    if(!this->flushFifo()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Enable the FIFO almost full interrupt
+    if(!this->enableInterrupts(InterruptFlags::FIFO_ALMOST_FULL_FLAG)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+    this->_sampleRing = sampleRing_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MAX30102_MODULE);
+    return true;
+}
+
+/**
+ * @brief       Stops streaming the FIFO.
+ * @details     Disables the FIFO almost full interrupt and releases the sample
+ *              ring. Samples already in the ring are left untouched.
+ * @return      true        Operation successfull.
+ * @return      false       Operation failed. Retrieve error calling
+ *                          getLastError() function.
+ */
+bool Max30102::stopStreaming(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Max30102::stopStreaming(void)", DEBUG_CODE_MAX3010X);
+
+    // Release the sample ring
+    this->_sampleRing = nullptr;
+
+    // Disable the FIFO almost full interrupt
+    if(!this->disableInterrupts(InterruptFlags::FIFO_ALMOST_FULL_FLAG)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MAX30102_MODULE);
+    return true;
+}
+
+/**
+ * @brief       Drains the FIFO into the sample ring.
+ * @details     Reads the FIFO pointers once and moves every sample waiting in
+ *              the FIFO to the ring set at startStreaming(). The samples are
+ *              read in bursts of up to MAX30102_BURST_SIZE bytes into a
+ *              static buffer, one bus transaction per burst, and unpacked by
+ *              a loop specialized for the operation mode. With the default
+ *              burst size and a bus buffer at least as large, the full FIFO
+ *              is moved in a single burst in heart rate mode and in two
+ *              bursts in SpO2 mode.
+ * @note        A burst never exceeds the bus buffer (see Twi::init()), so a
+ *              smaller buffer only means more bursts.
+ * @note        This function is called by generalIrqHandler() when the FIFO
+ *              almost full flag is set, but may also be polled.
+ * @return      true        Operation successfull.
+ * @return      false       Operation failed. Retrieve error calling
+ *                          getLastError() function.
+ */
+bool Max30102::streamFifo(void)
+{
+    // Local variables
+    SampleRing *ring = this->_sampleRing;
+    uint8_t *auxBuff;
+    uint8_t samples;
+    uint8_t burstSamples;
+    uint8_t bytesPerSample;
+    uint8_t resolutionFix;
+    uint8_t mask;
+    uint8_t head;
+
+    // Mark passage for debugging purpose
+    debugMark("Max30102::streamFifo(void)", DEBUG_CODE_MAX3010X);
+
+    // Check device's initialization
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Check streaming
+    if(!isPointerValid(ring)) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+    if((this->_modeControl != ModeControl::HEART_RATE_MODE) && (this->_modeControl != ModeControl::SPO2_MODE)) {
+        // Returns error
+        this->_lastError = Error::MODE_NOT_SUPPORTED;
+        debugMessage(Error::MODE_NOT_SUPPORTED, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Gets FIFO information
+    if(!this->_getFifoInfo()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
+    }
+
+    // Calculate number of available samples
+    samples = (this->_fifoWritePointer - this->_fifoReadPointer) & (MAX30102_FIFO_SIZE_IN_SAMPLES - 1);
+    if((samples == 0) && (this->_fifoOverflowCounter != 0)) {
+        samples = MAX30102_FIFO_SIZE_IN_SAMPLES;
+    }
+    ring->lost += this->_fifoOverflowCounter;
+
+    // Drain the FIFO
+    bytesPerSample = MAX30102_BYTES_PER_CHANNEL;
+    if(this->_modeControl == ModeControl::SPO2_MODE) {
+        bytesPerSample *= 2;
+    }
+    resolutionFix = this->_getResolutionFix();
+    mask = ring->size - 1;
+    head = ring->head;
+    while(samples > 0) {
+        burstSamples = this->_getBurstSamples(bytesPerSample);
+        if(burstSamples > samples) {
+            burstSamples = samples;
+        }
+        if(!this->_read(Register::FIFO_DATA, fifoBurstBuffer, burstSamples * bytesPerSample)) {
+            // Returns error
+            ring->head = head;
+            debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+            return false;
+        }
+        samples -= burstSamples;
+
+        auxBuff = fifoBurstBuffer;
+        if(this->_modeControl == ModeControl::SPO2_MODE) {
+            // Red and infrared LED values
+            for(; burstSamples > 0; burstSamples--, auxBuff += 6) {
+                if((uint8_t)(head - ring->tail) > mask) {
+                    ring->lost++;
+                    continue;
+                }
+                if(isPointerValid(ring->red)) {
+                    ring->red[head & mask] = unpackSample(auxBuff, resolutionFix);
+                }
+                if(isPointerValid(ring->infrared)) {
+                    ring->infrared[head & mask] = unpackSample(auxBuff + 3, resolutionFix);
+                }
+                head++;
+            }
+        } else {
+            // Red LED value only
+            for(; burstSamples > 0; burstSamples--, auxBuff += 3) {
+                if((uint8_t)(head - ring->tail) > mask) {
+                    ring->lost++;
+                    continue;
+                }
+                if(isPointerValid(ring->red)) {
+                    ring->red[head & mask] = unpackSample(auxBuff, resolutionFix);
+                }
+                head++;
+            }
+        }
+        ring->head = head;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::MAX30102_MODULE);
+    return true;
+}
+
 //     /////////////////////    DATA MANAGEMENT     /////////////////////     //
 
 /**
@@ -1838,6 +2106,13 @@ bool Max30102::generalIrqHandler(void)
         this->_dieTempReadyInterruptCallback();
     }
     if(this->_fifoAlmostFullInterruptFlag) {
+        if(isPointerValid(this->_sampleRing)) {
+            if(!this->streamFifo()) {
+                // Returns error
+                debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+                return false;
+            }
+        }
         this->_fifoAlmostFullInterruptCallback();
     }
     if(this->_newFifoDataReadyInterruptFlag) {
@@ -2120,6 +2395,7 @@ void Max30102::_clearData(void)
     // this->_fifoWritePointerNew                           = 0;
     // this->_fifoWritePointerOld                           = 0;
     this->_sampleAveraging                              = SampleAveraging::SAMPLE_AVERAGING_OFF;
+    this->_sampleRing                                   = nullptr;
     //     //////////////////     TEMPERATURE DATA     //////////////////     //
     this->_dieTempEnable                                = false;
     this->_dieTempFraction                              = 0;
@@ -2371,7 +2647,8 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
     debugMark("Max30102::_readFifoData(uint8_t, void *, void*, uint8_t)", DEBUG_CODE_MAX3010X);
 
     // Local variables
-    uint8_t *auxBuff = nullptr;
+    uint8_t bytesPerSample = 0;
+    uint8_t burstSamples = 0;
     uint8_t resolutionFix = 0;
     uint16_t aux16 = 0;
     int32_t aux32 = 0;
@@ -2380,17 +2657,20 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
     uint32_t *buff32ptr1 = (uint32_t *)redLedBuffer_p;
     uint32_t *buff32ptr2 = (uint32_t *)infraredLedBuffer_p;
 
-    // Evaluate buffer size
+    // Evaluate sample size
     switch(this->_modeControl) {
     case ModeControl::HEART_RATE_MODE:
-        aux16 = MAX30102_BYTES_PER_CHANNEL * samples_p * 1;
+        bytesPerSample = MAX30102_BYTES_PER_CHANNEL * 1;
         break;
     case ModeControl::SPO2_MODE:
-        aux16 = MAX30102_BYTES_PER_CHANNEL * samples_p * 2;
+        bytesPerSample = MAX30102_BYTES_PER_CHANNEL * 2;
         break;
     case ModeControl::MULTI_LED_MODE:
-        aux16 = MAX30102_BYTES_PER_CHANNEL * samples_p * this->_activeLedsCounter;
-        break;
+        // TODO: Implement this mode
+        // Returns error
+        this->_lastError = Error::UNDER_DEVELOPMENT;
+        debugMessage(Error::UNDER_DEVELOPMENT, Debug::CodeIndex::MAX30102_MODULE);
+        return false;
     default:
         // Returns error
         this->_lastError = Error::UNKNOWN;
@@ -2398,73 +2678,28 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
         return false;
     }
 
-    // Memory allocation
-    auxBuff = (uint8_t *)calloc(aux16, sizeof(uint8_t));
-    if(!isPointerValid(auxBuff)) {
-        // Returns error
-        this->_lastError = Error::MEMORY_ALLOCATION;
-        debugMessage(Error::MEMORY_ALLOCATION, Debug::CodeIndex::MAX30102_MODULE);
-        return false;
-    }
-
-    // Reads from device
-    if(!this->_read(Register::FIFO_DATA, auxBuff, aux16)) {
-        // Returns error
-        free(auxBuff);
-        debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
-        return false;
-    }
-
     // Evaluates the number of shifts to fix the value due to resolution
-    switch(this->_resolution) {
-    case Resolution::RESOLUTION_15_BITS:
-        resolutionFix = 3;
-        break;
-    case Resolution::RESOLUTION_16_BITS:
-        resolutionFix = 2;
-        break;
-    case Resolution::RESOLUTION_17_BITS:
-        resolutionFix = 1;
-        break;
-    case Resolution::RESOLUTION_18_BITS:
-        resolutionFix = 0;
-        break;
-    }
+    resolutionFix = this->_getResolutionFix();
 
-    // Decode data
-    aux16 = 0;
-    for(uint8_t i = 0; i < samples_p; i++) {
-        switch(this->_modeControl) {
-        case ModeControl::HEART_RATE_MODE:
-            // Process red LED value
-            aux32 = (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 >>= resolutionFix;
-            // Truncates the sample size to 16 bits
-            if((resolutionFix < 2) && (varSize_p == 2)) {
-                aux32 >>= (2 - resolutionFix);
-            }
-            // Update function arguments
-            if(isPointerValid(redLedBuffer_p)) {
-                if(varSize_p == 2) {
-                    *buff16ptr1++ = (uint16_t)(aux32);
-                } else {
-                    *buff32ptr1++ = (uint32_t)(aux32);
-                }
-            }
-            break;
+    while(samples_p > 0) {
+        // Reads from device, as many samples as fit in the burst buffer
+        burstSamples = this->_getBurstSamples(bytesPerSample);
+        if(burstSamples > samples_p) {
+            burstSamples = samples_p;
+        }
+        if(!this->_read(Register::FIFO_DATA, fifoBurstBuffer, burstSamples * bytesPerSample)) {
+            // Returns error
+            debugMessage(this->_lastError, Debug::CodeIndex::MAX30102_MODULE);
+            return false;
+        }
+        samples_p -= burstSamples;
 
-        case ModeControl::SPO2_MODE:
+        // Decode data
+        aux16 = 0;
+        for(uint8_t i = 0; i < burstSamples; i++) {
             // Process red LED value
-            aux32 = (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 >>= resolutionFix;
+            aux32 = unpackSample(&fifoBurstBuffer[aux16], resolutionFix);
+            aux16 += MAX30102_BYTES_PER_CHANNEL;
             // Truncates the sample size to 16 bits
             if((resolutionFix < 2) && (varSize_p == 2)) {
                 aux32 >>= (2 - resolutionFix);
@@ -2477,13 +2712,13 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
                     *buff32ptr1++ = (uint32_t)(aux32);
                 }
             }
+            if(this->_modeControl != ModeControl::SPO2_MODE) {
+                continue;
+            }
+
             // Process infrared LED value
-            aux32 = (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 <<= 8;
-            aux32 |= (uint32_t)(auxBuff[aux16++]);
-            aux32 >>= resolutionFix;
+            aux32 = unpackSample(&fifoBurstBuffer[aux16], resolutionFix);
+            aux16 += MAX30102_BYTES_PER_CHANNEL;
             // Truncates the sample size to 16 bits
             if((resolutionFix < 2) && (varSize_p == 2)) {
                 aux32 >>= (2 - resolutionFix);
@@ -2496,17 +2731,8 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
                     *buff32ptr2++ = (uint32_t)(aux32);
                 }
             }
-            break;
-
-        case ModeControl::MULTI_LED_MODE:
-            // TODO: Implement this mode
-            // Returns error
-            this->_lastError = Error::UNDER_DEVELOPMENT;
-            debugMessage(Error::UNDER_DEVELOPMENT, Debug::CodeIndex::MAX30102_MODULE);
-            return false;
         }
     }
-    free(auxBuff);
 
     // Update data members
     if(!this->_getFifoInfo()) {
@@ -2521,6 +2747,57 @@ bool Max30102::_readFifoData(uint8_t samples_p, void *redLedBuffer_p, void *infr
     return true;
 }
 
+/**
+ * @brief       Evaluates the number of samples read per burst.
+ * @details     A burst is limited by the static burst buffer and by the bus
+ *              buffer, whichever is smaller.
+ * @note        This function is private, so before calling it, the
+ *              programmer must ensure that all parameters are checked.
+ * @param[in]   bytesPerSample_p    size of a sample in bytes.
+ * @return      uint8_t     number of samples per burst.
+ */
+uint8_t Max30102::_getBurstSamples(cuint8_t bytesPerSample_p)
+{
+    // Local variables - init() only accepts TWI bus handlers
+    uint8_t burstSize = ((Twi *)this->_busHandler)->getBufferSize();
+
+    // Mark passage for debugging purpose
+    debugMark("Max30102::_getBurstSamples(cuint8_t)", DEBUG_CODE_MAX3010X);
+
+    if(burstSize > MAX30102_BURST_SIZE) {
+        burstSize = MAX30102_BURST_SIZE;
+    }
+
+    return burstSize / bytesPerSample_p;
+}
+
+/**
+ * @brief       Evaluates the number of shifts to fix the sample resolution.
+ * @details     The FIFO values are left-justified at 18 bits, so values of
+ *              lower resolution must be shifted right.
+ * @note        This function is private, so before calling it, the
+ *              programmer must ensure that all parameters are checked.
+ * @return      uint8_t     number of right shifts.
+ */
+uint8_t Max30102::_getResolutionFix(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Max30102::_getResolutionFix(void)", DEBUG_CODE_MAX3010X);
+
+    switch(this->_resolution) {
+    case Resolution::RESOLUTION_15_BITS:
+        return 3;
+    case Resolution::RESOLUTION_16_BITS:
+        return 2;
+    case Resolution::RESOLUTION_17_BITS:
+        return 1;
+    case Resolution::RESOLUTION_18_BITS:
+        break;
+    }
+
+    return 0;
+}
+
 /**
  * @brief       Sets the FIFO's read pointer at the device.
  * @details     Sets the FIFO's read pointer at the device.
@@ -2648,6 +2925,25 @@ static void defaultCallbackFunction(void)
     return;
 }
 
+/**
+ * @brief       Unpacks one FIFO channel value.
+ * @details     The channel value is 3 bytes long, MSB first and left-justified
+ *              at 18 bits. The 6 unused upper bits are masked out and the
+ *              value is shifted right to the configured resolution.
+ * @param[in]   buffer_p        pointer to the first byte of the value.
+ * @param[in]   resolutionFix_p number of right shifts due to resolution.
+ * @return      uint32_t    channel value.
+ */
+static inline uint32_t unpackSample(const uint8_t *buffer_p, uint8_t resolutionFix_p)
+{
+    uint32_t aux32;
+
+    aux32 = (uint32_t)(buffer_p[0] & 0x03) << 16;
+    aux32 |= ((uint16_t)buffer_p[1] << 8) | buffer_p[2];
+
+    return (aux32 >> resolutionFix_p);
+}
+
 // =============================================================================
 // END OF FILE
 // =============================================================================
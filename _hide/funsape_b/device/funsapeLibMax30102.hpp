@@ -46,6 +46,13 @@
 #   error   [funsapeLibMax30102.hpp] Error 12 - Required module (funsapeLibBus.hpp) must be build 2407.
 #endif
 
+#include "funsape/peripheral/funsapeLibTwi.hpp"
+#ifndef __FUNSAPE_LIB_TWI_HPP
+#   error   [funsapeLibMax30102.hpp] Error 11 - Required module (funsapeLibTwi.hpp) is missing or corrupted!
+#elif __FUNSAPE_LIB_TWI_HPP != 2407
+#   error   [funsapeLibMax30102.hpp] Error 12 - Required module (funsapeLibTwi.hpp) must be build 2407.
+#endif
+
 // =============================================================================
 // Undefining previous definitions
 // =============================================================================
@@ -56,7 +63,22 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef MAX30102_BURST_SIZE
+//!
+//! \brief          Max30102 FIFO burst size
+//! \details        Size in bytes of the static buffer used to drain the FIFO.
+//!                     Each burst is a single bus transaction; if the TWI
+//!                     buffer set at Twi::init() is smaller, the bursts are
+//!                     shortened to fit it. Must hold a whole number of SpO2
+//!                     samples (6 bytes each).
+//!
+#   define MAX30102_BURST_SIZE          96
+#endif
+#if (MAX30102_BURST_SIZE % 6) != 0
+#   error "MAX30102_BURST_SIZE must be a multiple of 6!"
+#elif MAX30102_BURST_SIZE > 100
+#   error "MAX30102_BURST_SIZE must not exceed the largest TWI buffer size (100)!"
+#endif
 
 // =============================================================================
 // Macro-function definitions
@@ -211,6 +233,16 @@ public:
         SLOT_INFRARED                   = 2
     };
 
+    //     /////////////////////    SAMPLE RING     /////////////////////     //
+    struct SampleRing {
+        uint32_t        *red;                   // Red LED samples (may be nullptr)
+        uint32_t        *infrared;              // Infrared LED samples (may be nullptr)
+        uint8_t         size;                   // Power of two, up to 128 samples
+        vuint8_t        head;                   // Free-running, written by the driver
+        vuint8_t        tail;                   // Free-running, written by the application
+        uint16_t        lost;                   // Samples dropped by the device or the ring
+    };
+
 private:
     //     //////////////////     REGISTER ADDRESS     //////////////////     //
     enum class Register {
@@ -401,6 +433,15 @@ public:
             uint8_t *samplesWaiting_p,
             uint8_t *samplesLost_p = nullptr
     );
+    bool startStreaming(
+            SampleRing *sampleRing_p
+    );
+    bool stopStreaming(
+            void
+    );
+    bool streamFifo(
+            void
+    );
 
     //     ///////////////////    DATA MANAGEMENT     ///////////////////     //
     bool getFifoData(
@@ -510,6 +551,12 @@ private:
             void *infraredLedBuffer_p,
             uint8_t varSize_p
     );
+    uint8_t _getBurstSamples(
+            cuint8_t bytesPerSample_p
+    );
+    uint8_t _getResolutionFix(
+            void
+    );
     bool _setFifoReadPointer(
             uint8_t pointer_p
     );
@@ -579,6 +626,7 @@ private:
     uint8_t         _fifoWritePointerOld                        ; //: 5;
     uint8_t         _fifoWritePointerNew                        ; //: 5;
     SampleAveraging _sampleAveraging;
+    SampleRing      *_sampleRing;
 
     //     //////////////////     TEMPERATURE DATA     //////////////////     //
     bool            _dieTempEnable                              : 1;
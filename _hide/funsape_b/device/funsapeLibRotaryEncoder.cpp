@@ -0,0 +1,304 @@
+//!
+//! \file           funsapeLibRotaryEncoder.cpp
+//! \brief          Quadrature rotary encoder interface for the FunSAPE AVR8
+//!                     Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Quadrature rotary encoder decoder driven by pin change
+//!                     (PCINTx) or external (INT0/INT1) interrupts, with 32-bit
+//!                     position and velocity estimate
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibRotaryEncoder.hpp"
+#if !defined(__FUNSAPE_LIB_ROTARY_ENCODER_HPP)
+#   error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_ROTARY_ENCODER_HPP != 2407
+#   error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+#   include <util/atomic.h>
+#endif
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+cint8_t constTransitionInvalid          = 2;        //!< Both channels changed
+
+//!
+//! \brief          Quadrature transition table
+//! \details        Indexed by (previous state << 2) | current state, where the
+//!                     state is (A << 1) | B. Forward sequence is 00, 01, 11,
+//!                     10.
+//!
+static cint8_t constTransitionTable[16] = {
+    0,      1,      -1,     constTransitionInvalid,
+    -1,     0,      constTransitionInvalid,     1,
+    1,      constTransitionInvalid,     0,      -1,
+    constTransitionInvalid,     -1,     1,      0
+};
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+RotaryEncoder::RotaryEncoder(void)
+{
+    // Marks passage for debugging purpose
+    debugMark("RotaryEncoder::RotaryEncoder(void)", Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+
+    // Reset data members
+    this->_regIn                        = nullptr;
+    this->_pinAMask                     = 0;
+    this->_pinBMask                     = 0;
+    this->_state                        = 0;
+    this->_rawPosition                  = 0;
+    this->_lastRawPosition              = 0;
+    this->_velocity                     = 0;
+    this->_errorCount                   = 0;
+    this->_sampleFrequency              = constRotaryEncoderDefaultSampleFrequency;
+    this->_resolution                   = Resolution::X4;
+    this->_isInitialized                = false;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+    return;
+}
+
+RotaryEncoder::~RotaryEncoder(void)
+{
+    // Marks passage for debugging purpose
+    debugMark("RotaryEncoder::~RotaryEncoder(void)", Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     //////////////////////    CONFIGURATION     //////////////////////     //
+bool_t RotaryEncoder::init(ioRegAddress_t gpioPort_p, const GpioPin::PinIndex pinA_p,
+        const GpioPin::PinIndex pinB_p, const Resolution resolution_p, cuint16_t sampleFrequency_p)
+{
+    // Marks passage for debugging purpose
+    debugMark("RotaryEncoder::init(ioRegAddress_t, GpioPin::PinIndex, GpioPin::PinIndex, Resolution, cuint16_t)",
+            Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+
+    // Local variables
+    ioRegAddress_t auxDir = getGpioDdrAddress(gpioPort_p);
+    ioRegAddress_t auxOut = getGpioPortAddress(gpioPort_p);
+    uint8_t maskA = (uint8_t)(1 << (uint8_t)pinA_p);
+    uint8_t maskB = (uint8_t)(1 << (uint8_t)pinB_p);
+    uint8_t pins;
+
+    // CHECK FOR ERROR - port address invalid
+    if(!isPointerValid(gpioPort_p)) {
+        // Returns error
+        this->_lastError = Error::GPIO_PORT_INVALID;
+        debugMessage(Error::GPIO_PORT_INVALID, Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - same pin for both channels or no sample frequency
+    if((pinA_p == pinB_p) || (sampleFrequency_p == 0)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+        return false;
+    }
+
+    // Configure channels as inputs pulled up
+    *auxDir &= ~(maskA | maskB);
+    *auxOut |= (maskA | maskB);
+
+    // Update data members
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_regIn                    = getGpioPinAddress(gpioPort_p);
+        this->_pinAMask                 = maskA;
+        this->_pinBMask                 = maskB;
+        pins = *(this->_regIn);
+        this->_state                    = (((pins & maskA) != 0) << 1) | ((pins & maskB) != 0);
+        this->_rawPosition              = 0;
+        this->_lastRawPosition          = 0;
+        this->_velocity                 = 0;
+        this->_errorCount               = 0;
+        this->_sampleFrequency          = sampleFrequency_p;
+        this->_resolution               = resolution_p;
+        this->_isInitialized            = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::ROTARY_ENCODER_MODULE);
+    return true;
+}
+
+//     ///////////////////////    POSITION     ////////////////////////     //
+int32_t RotaryEncoder::getPosition(void)
+{
+    // Local variables
+    int32_t position;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        position = this->_rawPosition;
+    }
+
+    // Scale from edges to configured resolution
+    return position >> (uint8_t)this->_resolution;
+}
+
+void RotaryEncoder::setPosition(const int32_t position_p)
+{
+    // Local variables
+    int32_t raw = position_p << (uint8_t)this->_resolution;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // Keep the sub-count edges, so the next detent is not shifted
+        raw |= this->_rawPosition & ((1 << (uint8_t)this->_resolution) - 1);
+        this->_lastRawPosition += raw - this->_rawPosition;
+        this->_rawPosition = raw;
+    }
+
+    return;
+}
+
+int32_t RotaryEncoder::getVelocity(void)
+{
+    return this->_velocity >> (uint8_t)this->_resolution;
+}
+
+uint16_t RotaryEncoder::getErrorCount(void)
+{
+    // Local variables
+    uint16_t errors;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        errors = this->_errorCount;
+        this->_errorCount = 0;
+    }
+
+    return errors;
+}
+
+//     ///////////////////////    INTERRUPT     ///////////////////////     //
+void RotaryEncoder::interruptHandler(void)
+{
+    // Local variables
+    uint8_t pins;
+    uint8_t state;
+    int8_t delta;
+
+    // CHECK - not initialized
+    if(!this->_isInitialized) {
+        return;
+    }
+
+    // Sample channels
+    pins = *(this->_regIn);
+    state = ((pins & this->_pinAMask) ? 2 : 0) | ((pins & this->_pinBMask) ? 1 : 0);
+    if(state == this->_state) {
+        return;                         // Other pin of the group changed
+    }
+
+    // Decode transition
+    delta = constTransitionTable[(this->_state << 2) | state];
+    this->_state = state;
+    if(delta == constTransitionInvalid) {
+        if(this->_errorCount < 0xFFFF) {
+            this->_errorCount++;
+        }
+        return;
+    }
+    this->_rawPosition += delta;
+
+    return;
+}
+
+void RotaryEncoder::updateVelocity(void)
+{
+    // Local variables
+    int32_t position;
+    int32_t instantVelocity;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        position = this->_rawPosition;
+    }
+
+    // Edges per second, smoothed by a first order IIR filter (alpha = 1/4)
+    instantVelocity = (position - this->_lastRawPosition) * (int32_t)this->_sampleFrequency;
+    this->_lastRawPosition = position;
+    this->_velocity += (instantVelocity - this->_velocity) >> 2;
+
+    return;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error RotaryEncoder::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// END OF FILE - funsapeLibRotaryEncoder.cpp
+// =============================================================================
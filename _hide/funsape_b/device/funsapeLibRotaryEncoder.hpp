@@ -0,0 +1,339 @@
+//!
+//! \file           funsapeLibRotaryEncoder.hpp
+//! \brief          Quadrature rotary encoder interface for the FunSAPE AVR8
+//!                     Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Quadrature rotary encoder decoder driven by pin change
+//!                     (PCINTx) or external (INT0/INT1) interrupts, with 32-bit
+//!                     position and velocity estimate
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_ROTARY_ENCODER_HPP
+#define __FUNSAPE_LIB_ROTARY_ENCODER_HPP                2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////    GLOBAL DEFINITIONS FILE     /////////////////     //
+
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_ROTARY_ENCODER_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_ROTARY_ENCODER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibGpioPin.hpp"
+#if !defined(__FUNSAPE_LIB_GPIO_PIN_HPP)
+#   error "Header file (funsapeLibGpioPin.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_GPIO_PIN_HPP != __FUNSAPE_LIB_ROTARY_ENCODER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibGpioPin.hpp)!"
+#endif
+
+//     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
+
+// NONE
+
+//     ////////////////////    AVR LIBRARY FILES     ////////////////////     //
+
+// NONE
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+cuint16_t constRotaryEncoderDefaultSampleFrequency  = 100;  //!< Default velocity sample frequency, in Hz
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Classes
+// =============================================================================
+
+//!
+//! \brief          RotaryEncoder class
+//! \details        Quadrature decoder for incremental rotary encoders. Both
+//!                     channels must be in the same GPIO port and generate
+//!                     interrupts at both edges, either as pin change pins or
+//!                     as INT0/INT1 (SenseMode::BOTH_EDGES). Each transition
+//!                     is decoded by a 16-entry lookup table indexed by the
+//!                     previous and current channel states, so bounces add
+//!                     and subtract the same count and are cancelled.
+//!                 The interrupt callbacks must call \ref interruptHandler().
+//!                     Several encoders can share one pin change group:
+//! \code
+//!                 void pcint2InterruptCallback(void)
+//!                 {
+//!                     encoder1.interruptHandler();
+//!                     encoder2.interruptHandler();
+//!                 }
+//! \endcode
+//!                 The handler takes about 45 CPU cycles per encoder, plus the
+//!                     interrupt entry and exit. At 16 MHz, a single encoder on
+//!                     a pin change group can follow about 100000 transitions
+//!                     per second (25000 cycles per second in X4 resolution).
+//!                     Each additional encoder in the same group lowers this
+//!                     limit by about 3 us per interrupt.
+//!
+class RotaryEncoder
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+
+    //     /////////////////////    RESOLUTION     //////////////////////     //
+
+    //!
+    //! \brief      Resolution
+    //! \details    Number of counts per quadrature cycle.
+    //!
+    enum class Resolution : uint8_t {
+        X1                              = 2,    //!< One count per quadrature cycle.
+        X2                              = 1,    //!< Two counts per quadrature cycle.
+        X4                              = 0     //!< Four counts per quadrature cycle (every edge).
+    };
+
+private:
+
+    // NONE
+
+protected:
+
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      RotaryEncoder class constructor
+    //! \details    Creates a RotaryEncoder object.
+    //!
+    RotaryEncoder(
+            void
+    );
+
+    //!
+    //! \brief      RotaryEncoder class destructor
+    //! \details    Destroys a RotaryEncoder object.
+    //!
+    ~RotaryEncoder(
+            void
+    );
+
+private:
+
+    // NONE
+
+protected:
+
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+public:
+
+    // NONE
+
+private:
+
+    // NONE
+
+protected:
+
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Methods - Class own methods ---------------------------------------------
+public:
+
+    //     ////////////////////    CONFIGURATION     ////////////////////     //
+
+    //!
+    //! \brief      RotaryEncoder initialization
+    //! \details    Configures both channels as inputs with pull-up, samples
+    //!                 the initial state and resets the position.
+    //! \param      gpioPort_p          GPIO port of both channels
+    //! \param      pinA_p              Channel A pin
+    //! \param      pinB_p              Channel B pin
+    //! \param      resolution_p        Counts per quadrature cycle
+    //! \param      sampleFrequency_p   Rate at which \ref updateVelocity() is
+    //!                                     called, in Hz
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t init(
+            ioRegAddress_t gpioPort_p,
+            const GpioPin::PinIndex pinA_p,
+            const GpioPin::PinIndex pinB_p,
+            const Resolution resolution_p   = Resolution::X4,
+            cuint16_t sampleFrequency_p     = constRotaryEncoderDefaultSampleFrequency
+    );
+
+    //     //////////////////////    POSITION     ///////////////////////     //
+
+    //!
+    //! \brief      Returns the position
+    //! \details    Returns the accumulated position, in counts of the
+    //!                 configured resolution.
+    //! \return     int32_t             Position
+    //!
+    int32_t getPosition(
+            void
+    );
+
+    //!
+    //! \brief      Sets the position
+    //! \details    Sets the accumulated position, in counts of the configured
+    //!                 resolution.
+    //! \param      position_p          New position
+    //!
+    void setPosition(
+            const int32_t position_p
+    );
+
+    //!
+    //! \brief      Returns the velocity
+    //! \details    Returns the filtered velocity estimate, in counts of the
+    //!                 configured resolution per second.
+    //! \return     int32_t             Velocity
+    //!
+    int32_t getVelocity(
+            void
+    );
+
+    //!
+    //! \brief      Returns the invalid transitions count
+    //! \details    Returns the number of transitions where both channels
+    //!                 changed at once (missed edges) and resets the counter.
+    //! \return     uint16_t            Invalid transitions
+    //!
+    uint16_t getErrorCount(
+            void
+    );
+
+    //     //////////////////////    INTERRUPT     //////////////////////     //
+
+    //!
+    //! \brief      Decodes a transition
+    //! \details    Must be called from the interrupt callback of the channels
+    //!                 pins. Returns quickly if the encoder pins did not
+    //!                 change.
+    //!
+    void interruptHandler(
+            void
+    );
+
+    //!
+    //! \brief      Updates the velocity estimate
+    //! \details    Must be called periodically, at the sample frequency given
+    //!                 to \ref init(), e.g. from a periodic soft timer.
+    //!
+    void updateVelocity(
+            void
+    );
+
+    Error getLastError(
+            void
+    );
+
+private:
+
+    // NONE
+
+protected:
+
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+public:
+
+    // NONE
+
+private:
+
+    //     //////////////////     DEVICE BUS PORTS     //////////////////     //
+    ioRegAddress_t                      _regIn;
+    uint8_t                             _pinAMask;
+    uint8_t                             _pinBMask;
+
+    //     //////////////////////     STATUS     ///////////////////////     //
+    vuint8_t                            _state;
+    vint32_t                            _rawPosition;
+    int32_t                             _lastRawPosition;
+    int32_t                             _velocity;
+    vuint16_t                           _errorCount;
+
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    uint16_t                            _sampleFrequency;
+    Resolution                          _resolution;
+    bool_t                              _isInitialized  : 1;
+    Error                               _lastError;
+
+protected:
+
+    // NONE
+
+}; // class RotaryEncoder
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __FUNSAPE_LIB_ROTARY_ENCODER_HPP
+
+// =============================================================================
+// END OF FILE - funsapeLibRotaryEncoder.hpp
+// =============================================================================
@@ -67,7 +67,20 @@ SevenSegmentsMuxDisplay::SevenSegmentsMuxDisplay(void)
     for(uint8_t i = 0; i < 8; i++) {
         this->_digitValue[i]            = (uint8_t)SevenSegmentsCode::OFF;
         this->_digitPoint[i]            = false;
+        this->_pattern[0][i]            = 0;
+        this->_pattern[1][i]            = 0;
+        this->_brightness[i]            = SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS;
     }
+    this->_dataRegOut                   = nullptr;
+    this->_controlRegOut                = nullptr;
+    this->_controlKeep                  = 0;
+    this->_controlOff                   = 0;
+    for(uint8_t i = 0; i < 8; i++) {
+        this->_controlOn[i]             = 0;
+    }
+    this->_patternFront                 = 0;
+    this->_patternSwap                  = false;
+    this->_tick                         = 0;
     this->_displayType                  =  SevenSegmentsDisplayType::COMMON_ANODE;
     this->_isInitialized                = false;
     this->_isPortsSet                   = false;
@@ -100,6 +113,9 @@ bool_t SevenSegmentsMuxDisplay::init(Digits numberOfDigits_p, SevenSegmentsDispl
     debugMark("SevenSegmentsMuxDisplay::init(SevenSegmentsMuxDisplay::Digits, SevenSegmentsDisplayType)",
             Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
 
+    // Local variables
+    uint8_t aux8 = 0;
+
     // Resets data members
     this->_digitMax             = 0;
     this->_digitIndex           = 0;
@@ -142,6 +158,25 @@ bool_t SevenSegmentsMuxDisplay::init(Digits numberOfDigits_p, SevenSegmentsDispl
     // Updates data members
     this->_displayType                  = displayType_p;
     this->_digitMax                     = (uint8_t)numberOfDigits_p - 1;
+    this->_tick                         = 0;
+    this->_patternSwap                  = false;
+    for(uint8_t i = 0; i < 8; i++) {
+        this->_pattern[0][i]            = convertToSevenSegments(this->_digitValue[i], this->_digitPoint[i],
+                        this->_displayType);
+        this->_pattern[1][i]            = this->_pattern[0][i];
+    }
+
+    // Port values written by the refresh
+    this->_dataRegOut                   = this->_dataGpioBus->getOutputRegister();
+    this->_controlRegOut                = this->_controlGpioBus->getOutputRegister();
+    this->_controlKeep                  = ~(this->_controlGpioBus->getPinMask());
+    this->_controlOff                   = (this->_controlActiveLevel == LogicLevel::HIGH) ? 0 :
+            this->_controlGpioBus->getPinMask();
+    aux8                                = this->_controlGpioBus->getPinMask();
+    for(uint8_t i = 0; i < 8; i++) {
+        this->_controlOn[i]             = this->_controlOff ^ (aux8 & (uint8_t)(-aux8));
+        aux8                            &= (uint8_t)(aux8 - 1);
+    }
     this->_isInitialized                = true;
 
     // Returns successfully
@@ -207,31 +242,10 @@ bool_t SevenSegmentsMuxDisplay::showNextDigit(void)
         return false;
     }
 
-    // Turns current digit OFF
-    if(this->_displayType == SevenSegmentsDisplayType::COMMON_ANODE) {
-        this->_dataGpioBus->set();
-    } else {
-        this->_dataGpioBus->clr();
-    }
-    // Turns all displays off
-    if(this->_controlActiveLevel == LogicLevel::HIGH) {
-        this->_controlGpioBus->clr();
-    } else {
-        this->_controlGpioBus->set();
-    }
-
-    // Evaluates next digit
-    this->_digitIndex = (this->_digitIndex == this->_digitMax) ? 0 : (this->_digitIndex + 1);
-
-    // Send data to port
-    uint8_t aux8 = convertToSevenSegments(this->_digitValue[this->_digitIndex], this->_digitPoint[this->_digitIndex],
-                    this->_displayType);
-    this->_dataGpioBus->write(aux8);
-    // Turns digit on
-    if(this->_controlActiveLevel == LogicLevel::HIGH) {
-        this->_controlGpioBus->set(this->_digitIndex);
-    } else {
-        this->_controlGpioBus->clr(this->_digitIndex);
+    // Shows next digit; atomic, since other pins of the ports may be
+    //      written by interrupt handlers
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_showNextDigit();
     }
 
     // Returns successfully
@@ -254,12 +268,67 @@ bool_t SevenSegmentsMuxDisplay::updateDigitValues(cuint8_t *digitValues_p, cbool
         return false;
     }
 
+    // Keeps the back buffer away from the refresh while it is written
+    this->_patternSwap = false;
+
     // Updates data members
     for(uint8_t i = 0; i < (this->_digitMax + 1); i++) {
         this->_digitValue[i] = digitValues_p[i];
         if(isPointerValid(digitPoints_p)) {
             this->_digitPoint[i] = digitPoints_p[i];
         }
+        this->_pattern[this->_patternFront ^ 1][i] = convertToSevenSegments(this->_digitValue[i],
+                        this->_digitPoint[i], this->_displayType);
+    }
+
+    // Swapped in at the start of the next scan
+    this->_patternSwap = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+    return true;
+}
+
+bool_t SevenSegmentsMuxDisplay::setBrightness(cuint8_t digitIndex_p, cuint8_t brightness_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SevenSegmentsMuxDisplay::setBrightness(cuint8_t, cuint8_t)",
+            Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+
+    // Check for errors
+    if((digitIndex_p > 7) || (brightness_p > SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS)) {
+        // Returns error
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        return false;
+    }
+
+    // Updates data members
+    this->_brightness[digitIndex_p] = brightness_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+    return true;
+}
+
+bool_t SevenSegmentsMuxDisplay::setBrightness(cuint8_t brightness_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SevenSegmentsMuxDisplay::setBrightness(cuint8_t)", Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+
+    // Check for errors
+    if(brightness_p > SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS) {
+        // Returns error
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::SEVEN_SEGMENTS_MUX_DISPLAY_MODULE);
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        return false;
+    }
+
+    // Updates data members
+    for(uint8_t i = 0; i < 8; i++) {
+        this->_brightness[i] = brightness_p;
     }
 
     // Returns successfully
@@ -268,11 +337,58 @@ bool_t SevenSegmentsMuxDisplay::updateDigitValues(cuint8_t *digitValues_p, cbool
     return true;
 }
 
+//     /////////////////////    INTERRUPT     /////////////////////     //
+void SevenSegmentsMuxDisplay::interruptHandler(void)
+{
+    // CHECK - not initialized
+    if(!this->_isInitialized) {
+        return;
+    }
+
+    // Start of slot: shows next digit
+    if(this->_tick == 0) {
+        this->_showNextDigit();
+    }
+
+    // End of on-time: turns all digits off
+    if(this->_tick == this->_brightness[this->_digitIndex]) {
+        *(this->_controlRegOut) = (*(this->_controlRegOut) & this->_controlKeep) | this->_controlOff;
+    }
+
+    // Evaluates next tick
+    this->_tick = (this->_tick == (SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS - 1)) ? 0 : (this->_tick + 1);
+
+    return;
+}
+
 // =============================================================================
 // Class private methods
 // =============================================================================
 
-// NONE
+void SevenSegmentsMuxDisplay::_showNextDigit(void)
+{
+    // Turns all displays off, before the segments change
+    *(this->_controlRegOut) = (*(this->_controlRegOut) & this->_controlKeep) | this->_controlOff;
+
+    // Evaluates next digit, swapping the pattern buffers at the start of a scan
+    if(this->_digitIndex == this->_digitMax) {
+        this->_digitIndex = 0;
+        if(this->_patternSwap) {
+            this->_patternFront ^= 1;
+            this->_patternSwap = false;
+        }
+    } else {
+        this->_digitIndex++;
+    }
+
+    // Send data to port (the data bus is the whole port)
+    *(this->_dataRegOut) = this->_pattern[this->_patternFront][this->_digitIndex];
+    // Turns digit on
+    *(this->_controlRegOut) = (*(this->_controlRegOut) & this->_controlKeep) |
+            this->_controlOn[this->_digitIndex];
+
+    return;
+}
 
 // =============================================================================
 // Class protected methods
@@ -75,7 +75,17 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS
+//!
+//! \brief          Brightness steps
+//! \details        Number of interrupt ticks in each digit time slot. A digit
+//!                     with brightness N stays on during N ticks of its slot.
+//!
+#   define SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS  8
+#endif
+#if (SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS < 1) || (SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS > 64)
+#   error "SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS must be between 1 and 64!"
+#endif
 
 // =============================================================================
 // New data types
@@ -103,6 +113,31 @@
 //! \brief          SevenSegmentsMuxDisplay class
 //! \details        This class can handle multiplexed seven segments displays,
 //!                     from 2 to 8 digits.
+//!                 Segment patterns are computed by \ref updateDigitValues()
+//!                     into a back buffer, which is swapped in at the start of
+//!                     the next scan, so a frame never mixes old and new
+//!                     digits.
+//!                 The display can be refreshed by calling \ref showNextDigit()
+//!                     from the main loop, or automatically by calling
+//!                     \ref interruptHandler() from a timer compare match
+//!                     callback:
+//! \code
+//!                 void timer0CompareACallback(void)
+//!                 {
+//!                     display.interruptHandler();
+//!                 }
+//! \endcode
+//!                 In this mode, each digit slot lasts
+//!                     SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS ticks, so the
+//!                     timer frequency must be refresh rate x digits x steps
+//!                     (e.g. 100 Hz x 4 x 8 = 3.2 kHz). The port values are
+//!                     computed by \ref init(), so the handler writes the
+//!                     PORTx registers directly, with no loops, calls or
+//!                     variable shifts. It has not been timed on hardware.
+//!                 The data bus must be a whole port. The control port is
+//!                     updated with a read-modify-write, so its other pins
+//!                     must only be written atomically by the main code
+//!                     (GpioPin and GpioBus writes are).
 //!
 class SevenSegmentsMuxDisplay
 {
@@ -218,9 +253,48 @@ public:
             cbool_t *digitPoints_p = nullptr
     );
 
+    //!
+    //! \brief      Sets the brightness of a digit
+    //! \details    Sets the number of ticks the digit stays on during its time
+    //!                 slot. Only applies when refreshed by
+    //!                 \ref interruptHandler().
+    //! \param      digitIndex_p                Digit index (0 to digits - 1)
+    //! \param      brightness_p                On ticks (0 to
+    //!                                             SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS)
+    //! \return     bool_t                      True on success, False on failure
+    //!
+    bool_t setBrightness(
+            cuint8_t digitIndex_p,
+            cuint8_t brightness_p
+    );
+
+    //!
+    //! \brief      Sets the brightness of all digits
+    //! \param      brightness_p                On ticks (0 to
+    //!                                             SEVEN_SEGMENTS_MUX_DISPLAY_BRIGHTNESS_STEPS)
+    //! \return     bool_t                      True on success, False on failure
+    //!
+    bool_t setBrightness(
+            cuint8_t brightness_p
+    );
+
+    //     /////////////////////    INTERRUPT     /////////////////////     //
+
+    //!
+    //! \brief      Timer tick handler
+    //! \details    Must be called from a timer compare match callback. Switches
+    //!                 to the next digit at the start of each slot and turns it
+    //!                 off when its on-time has elapsed.
+    //!
+    void interruptHandler(
+            void
+    );
+
 private:
 
-    // NONE
+    void _showNextDigit(
+            void
+    );
 
 protected:
 
@@ -247,10 +321,22 @@ private:
     SevenSegmentsDisplayType            _displayType            : 1;
     LogicLevel                          _controlActiveLevel     : 1;
     uint8_t                             _digitMax               : 3;
-    uint8_t                             _digitIndex             : 3;
     uint8_t                             _digitValue[8];
     bool_t                              _digitPoint[8];
 
+    //     ////////////////////     REFRESH STATE     ////////////////////     //
+    uint8_t                             _pattern[2][8];
+    uint8_t                             _brightness[8];
+    ioRegAddress_t                      _dataRegOut;
+    ioRegAddress_t                      _controlRegOut;
+    uint8_t                             _controlKeep;           // Other pins of the control port
+    uint8_t                             _controlOff;            // All digits off
+    uint8_t                             _controlOn[8];          // Only one digit on
+    vuint8_t                            _patternFront;
+    vbool_t                             _patternSwap;
+    vuint8_t                            _digitIndex;
+    vuint8_t                            _tick;
+
 protected:
 
     // NONE
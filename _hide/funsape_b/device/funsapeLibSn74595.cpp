@@ -70,6 +70,13 @@ Sn74595::Sn74595(void)
     this->_outputEnable                 = nullptr;
     this->_shift                        = nullptr;
     this->_store                        = nullptr;
+    this->_busHandler                   = nullptr;
+    this->_chainLength                  = 1;
+    this->_isShadowDirty                = false;
+    this->_isStorePending               = false;
+    for(uint8_t i = 0; i < SN74595_MAX_CHAIN_LENGTH; i++) {
+        this->_shadow[i]                = 0;
+    }
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -99,10 +106,10 @@ Error Sn74595::getLastError(void)
     return this->_lastError;
 }
 
-bool_t Sn74595::init(const DataOrder dataOrder_p)
+bool_t Sn74595::init(const DataOrder dataOrder_p, cuint8_t chainLength_p)
 {
     // Mark passage for debugging purpose
-    debugMark("Sn74595::init(const DataOrder)", Debug::CodeIndex::SN74595_MODULE);
+    debugMark("Sn74595::init(const DataOrder, cuint8_t)", Debug::CodeIndex::SN74595_MODULE);
 
     // CHECK FOR ERROR - ports not set
     if(!this->_isPortsSet) {
@@ -111,6 +118,13 @@ bool_t Sn74595::init(const DataOrder dataOrder_p)
         debugMessage(Error::GPIO_PORT_NOT_SET, Debug::CodeIndex::SN74595_MODULE);
         return false;
     }
+    // CHECK FOR ERROR - chain length
+    if((chainLength_p == 0) || (chainLength_p > SN74595_MAX_CHAIN_LENGTH)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
 
     // Configure clear pin
     if(isPointerValid(this->_clear)) {
@@ -124,13 +138,13 @@ bool_t Sn74595::init(const DataOrder dataOrder_p)
         this->_outputEnable->high();
     }
 
-    // Configure data in pin
-    this->_dataIn->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->_dataIn->low();
-
-    // Configure shift clock pin
-    this->_shift->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    this->_shift->low();
+    // Configure data in and shift clock pins (not used with a bus handler)
+    if(!isPointerValid(this->_busHandler)) {
+        this->_dataIn->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        this->_dataIn->low();
+        this->_shift->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
+        this->_shift->low();
+    }
 
     // Configure store clock pin
     this->_store->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
@@ -138,6 +152,12 @@ bool_t Sn74595::init(const DataOrder dataOrder_p)
 
     // Updates data members
     this->_dataOrderMsbFirst            = (bool_t)dataOrder_p;
+    this->_chainLength                  = chainLength_p;
+    this->_isShadowDirty                = true;     // Registers content is unknown
+    this->_isStorePending               = false;
+    for(uint8_t i = 0; i < SN74595_MAX_CHAIN_LENGTH; i++) {
+        this->_shadow[i]                = 0;
+    }
     this->_isInitialized                = true;
 
     // Returns successfully
@@ -161,6 +181,7 @@ bool_t Sn74595::setPort(const GpioPin *dataInPin_p, const GpioPin *shiftClockPin
     this->_outputEnable                 = nullptr;
     this->_shift                        = nullptr;
     this->_store                        = nullptr;
+    this->_busHandler                   = nullptr;
 
     // CHECK FOR ERROR - ports not set
     if((!isPointerValid(dataInPin_p)) || (!isPointerValid(shiftClockPin_p)) || (!isPointerValid(storeClockPin_p))) {
@@ -185,6 +206,44 @@ bool_t Sn74595::setPort(const GpioPin *dataInPin_p, const GpioPin *shiftClockPin
     return true;
 }
 
+bool_t Sn74595::setPort(Bus *busHandler_p, const GpioPin *storeClockPin_p, const GpioPin *outputEnablePin_p,
+        const GpioPin *masterResetPin_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Sn74595::setPort(Bus *, const GpioPin *, const GpioPin *, const GpioPin *)",
+            Debug::CodeIndex::SN74595_MODULE);
+
+    // Resets data members
+    this->_clear                        = nullptr;
+    this->_dataIn                       = nullptr;
+    this->_isInitialized                = false;
+    this->_isPortsSet                   = false;
+    this->_outputEnable                 = nullptr;
+    this->_shift                        = nullptr;
+    this->_store                        = nullptr;
+    this->_busHandler                   = nullptr;
+
+    // CHECK FOR ERROR - ports not set
+    if((!isPointerValid(busHandler_p)) || (!isPointerValid(storeClockPin_p))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Update data members
+    this->_busHandler                   = busHandler_p;
+    this->_clear                        = (GpioPin *)masterResetPin_p;
+    this->_isPortsSet                   = true;
+    this->_outputEnable                 = (GpioPin *)outputEnablePin_p;
+    this->_store                        = (GpioPin *)storeClockPin_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
 bool_t Sn74595::disableOutputs(void)
 {
     // CHECKS FOR ERRORS - not initialized
@@ -275,26 +334,16 @@ bool_t Sn74595::sendByte(cuint8_t data_p)
     }
 
     // Transfers data
-    if(this->_dataOrderMsbFirst) {
-        for(uint8_t i = 0; i < 8; i++) {
-            if(isBitSet(data_p, (7 - i))) {
-                this->_dataIn->high();
-            } else {
-                this->_dataIn->low();
-            }
-            this->_shift->high();
-            this->_shift->low();
+    if(isPointerValid(this->_busHandler)) {
+        this->_transferBuffer[0] = data_p;
+        if(!this->_busHandler->sendData(this->_transferBuffer, 1)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::SN74595_MODULE);
+            return false;
         }
     } else {
-        for(uint8_t i = 0; i < 8; i++) {
-            if(isBitSet(data_p, i)) {
-                this->_dataIn->high();
-            } else {
-                this->_dataIn->low();
-            }
-            this->_shift->high();
-            this->_shift->low();
-        }
+        this->_shiftByte(data_p);
     }
 
     // Returns successfully
@@ -323,12 +372,165 @@ bool_t Sn74595::store(void)
     return true;
 }
 
+//     //////////////////     CHAINED OUTPUTS     //////////////////     //
+
+bool_t Sn74595::setOutput(cuint8_t outputIndex_p, cbool_t state_p)
+{
+    // Local variables
+    uint8_t *auxShadow = &this->_shadow[outputIndex_p >> 3];
+    uint8_t auxMask = (1 << (outputIndex_p & 0x07));
+
+    // CHECKS FOR ERRORS - output index
+    if(outputIndex_p >= (this->_chainLength * 8)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Changes the shadow only if needed
+    if(((*auxShadow & auxMask) != 0) != state_p) {
+        *auxShadow ^= auxMask;
+        this->_isShadowDirty = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+bool_t Sn74595::setOutputs(cuint8_t deviceIndex_p, cuint8_t value_p)
+{
+    // CHECKS FOR ERRORS - device index
+    if(deviceIndex_p >= this->_chainLength) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Changes the shadow only if needed
+    if(this->_shadow[deviceIndex_p] != value_p) {
+        this->_shadow[deviceIndex_p] = value_p;
+        this->_isShadowDirty = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+bool_t Sn74595::getOutput(cuint8_t outputIndex_p)
+{
+    // CHECKS FOR ERRORS - output index
+    if(outputIndex_p >= (this->_chainLength * 8)) {
+        return false;
+    }
+
+    // Returns shadow value
+    return isBitSet(this->_shadow[outputIndex_p >> 3], (outputIndex_p & 0x07));
+}
+
+bool_t Sn74595::update(cbool_t storeNow_p)
+{
+    // CHECKS FOR ERRORS - not initialized
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::SN74595_MODULE);
+        return false;
+    }
+
+    // Nothing changed
+    if(!this->_isShadowDirty) {
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+        return true;
+    }
+
+    // No store pulse while the shift registers are being changed
+    this->_isStorePending = false;
+
+    // Transfers data, last device first
+    if(isPointerValid(this->_busHandler)) {
+        for(uint8_t i = 0; i < this->_chainLength; i++) {
+            this->_transferBuffer[i] = this->_shadow[this->_chainLength - 1 - i];
+        }
+        if(!this->_busHandler->sendData(this->_transferBuffer, this->_chainLength)) {
+            // Returns error
+            this->_lastError = this->_busHandler->getLastError();
+            debugMessage(this->_lastError, Debug::CodeIndex::SN74595_MODULE);
+            return false;
+        }
+    } else {
+        for(uint8_t i = this->_chainLength; i > 0; i--) {
+            this->_shiftByte(this->_shadow[i - 1]);
+        }
+    }
+    this->_isShadowDirty = false;
+
+    // Stores data now or at the next interrupt
+    if(storeNow_p) {
+        this->_store->high();
+        this->_store->low();
+    } else {
+        this->_isStorePending = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::SN74595_MODULE);
+    return true;
+}
+
+//     /////////////////////    INTERRUPT     /////////////////////     //
+
+void Sn74595::interruptHandler(void)
+{
+    // Stores data shifted by update(false)
+    if(this->_isStorePending) {
+        this->_store->high();
+        this->_store->low();
+        this->_isStorePending = false;
+    }
+
+    return;
+}
 
 // =============================================================================
 // Class own methods - Private
 // =============================================================================
 
-// NONE
+void Sn74595::_shiftByte(cuint8_t data_p)
+{
+    // Transfers data
+    if(this->_dataOrderMsbFirst) {
+        for(uint8_t i = 0; i < 8; i++) {
+            if(isBitSet(data_p, (7 - i))) {
+                this->_dataIn->high();
+            } else {
+                this->_dataIn->low();
+            }
+            this->_shift->high();
+            this->_shift->low();
+        }
+    } else {
+        for(uint8_t i = 0; i < 8; i++) {
+            if(isBitSet(data_p, i)) {
+                this->_dataIn->high();
+            } else {
+                this->_dataIn->low();
+            }
+            this->_shift->high();
+            this->_shift->low();
+        }
+    }
+
+    return;
+}
 
 // =============================================================================
 // Class own methods - Protected
@@ -45,6 +45,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibGpioPin.hpp)!"
 #endif
 
+#include "../util/funsapeLibBus.hpp"
+#if !defined(__FUNSAPE_LIB_BUS_HPP)
+#   error "Header file (funsapeLibBus.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_BUS_HPP != __FUNSAPE_LIB_SN74595_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibBus.hpp)!"
+#endif
+
 // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // Doxygen: Start main group "Devices"
 // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -73,7 +80,16 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef SN74595_MAX_CHAIN_LENGTH
+//!
+//! \brief          Maximum number of cascaded devices
+//! \details        Size of the shadow register array of each Sn74595 object.
+//!
+#   define SN74595_MAX_CHAIN_LENGTH     16
+#endif
+#if (SN74595_MAX_CHAIN_LENGTH < 1) || (SN74595_MAX_CHAIN_LENGTH > 32)
+#   error "SN74595_MAX_CHAIN_LENGTH must be between 1 and 32!"
+#endif
 
 // =============================================================================
 // New data types
@@ -94,6 +110,21 @@
 //!
 //! \brief          Sn74595 class.
 //! \details        This class manages cascaded SN74595 shift registers.
+//!                     The outputs of the whole chain are kept in a shadow
+//!                     array; \ref setOutput() and \ref setOutputs() only
+//!                     change the shadow, and \ref update() shifts the chain
+//!                     out only if something changed. Output 0 is bit 0 of the
+//!                     device connected to the microcontroller.
+//!                 The data can be shifted by bit-banging the data and shift
+//!                     clock pins, or through an SPI capable \ref Bus at the
+//!                     bus clock rate. \ref Usart0 initialized in one of the
+//!                     master SPI modes is the only such bus in the library;
+//!                     it always shifts MSB first, so the data order passed to
+//!                     \ref init() only applies to bit-banging.
+//!                 To update all outputs at a precise time, call
+//!                     update(false) and forward a timer compare match
+//!                     callback to \ref interruptHandler(), which pulses the
+//!                     store clock.
 //! \warning        This class is not instantiated by default. The user may
 //!                     create as many instances as necessary.
 //!
@@ -131,7 +162,8 @@ public:
             void
     );
     bool_t init(
-            const DataOrder dataOrder_p         = DataOrder::LSB_FIRST
+            const DataOrder dataOrder_p         = DataOrder::LSB_FIRST,
+            cuint8_t chainLength_p              = 1
     );
     bool_t setPort(
             const GpioPin *dataInPin_p,
@@ -140,6 +172,12 @@ public:
             const GpioPin *outputEnablePin_p    = nullptr,
             const GpioPin *masterResetPin_p     = nullptr
     );
+    bool_t setPort(
+            Bus *busHandler_p,
+            const GpioPin *storeClockPin_p,
+            const GpioPin *outputEnablePin_p    = nullptr,
+            const GpioPin *masterResetPin_p     = nullptr
+    );
     bool_t enableOutputs(
             void
     );
@@ -156,8 +194,31 @@ public:
             void
     );
 
+    //     //////////////////     CHAINED OUTPUTS     //////////////////     //
+    bool_t setOutput(
+            cuint8_t outputIndex_p,
+            cbool_t state_p
+    );
+    bool_t setOutputs(
+            cuint8_t deviceIndex_p,
+            cuint8_t value_p
+    );
+    bool_t getOutput(
+            cuint8_t outputIndex_p
+    );
+    bool_t update(
+            cbool_t storeNow_p                  = true
+    );
+
+    //     /////////////////////    INTERRUPT     /////////////////////     //
+    void interruptHandler(
+            void
+    );
+
 private:
-    // NONE
+    void _shiftByte(
+            cuint8_t data_p
+    );
 
 protected:
     // NONE
@@ -170,14 +231,22 @@ private:
     bool_t          _isPortsSet                 : 1;
     bool_t          _isInitialized              : 1;
     bool_t          _dataOrderMsbFirst          : 1;
+    bool_t          _isShadowDirty              : 1;
+    vbool_t         _isStorePending;
     Error           _lastError;
 
+    //     //////////////////     CHAINED OUTPUTS     //////////////////     //
+    uint8_t         _chainLength;
+    uint8_t         _shadow[SN74595_MAX_CHAIN_LENGTH];
+    uint8_t         _transferBuffer[SN74595_MAX_CHAIN_LENGTH];
+
     //     ////////////////    PERIPHERAL BUS HANDLER     ////////////////     //
     GpioPin         *_dataIn;
     GpioPin         *_shift;
     GpioPin         *_store;
     GpioPin         *_outputEnable;
     GpioPin         *_clear;
+    Bus             *_busHandler;
 }; // class Sn74595
 
 // =============================================================================
@@ -20,6 +20,11 @@
 #    error "Version mismatch between source and header files!"
 #endif
 
+#include <math.h>
+#if defined(_FUNSAPE_PLATFORM_AVR)
+#   include <util/atomic.h>
+#endif
+
 // =============================================================================
 // File exclusive - Constants
 // =============================================================================
@@ -67,6 +72,16 @@ Stepper::Stepper(void)
     this->_mode                         = Mode::FULL_STEP_ONE_PHASE;
     this->_step                         = 0;
     this->_initialized                  = false;
+    this->_isProfileSet                 = false;
+    this->_isRunning                    = false;
+    this->_direction                    = Rotation::CLOCKWISE;
+    this->_position                     = 0;
+    this->_target                       = 0;
+    this->_rampStep                     = 0;
+    this->_interval                     = 0;
+    this->_intervalFirst                = 0;
+    this->_intervalMin                  = 0;
+    this->_tickRemaining                = 0;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -112,6 +127,7 @@ bool_t Stepper::init(const GpioPin *coilA_p, const GpioPin *coilB_p, const GpioP
     this->_mode                         = Mode::FULL_STEP_ONE_PHASE;
     this->_step                         = 0;
     this->_initialized                  = false;
+    this->_isRunning                    = false;
 
     // Checks for errors
     if((!isPointerValid(coilA_p)) || (!isPointerValid(coilB_p)) || (!isPointerValid(coilC_p)) ||
@@ -182,7 +198,230 @@ bool_t Stepper::move(const Rotation direction_p)
         debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::STEPPER_MODULE);
         return false;
     }
+    if(this->_isRunning) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Moves one step
+    this->_nextStep(direction_p);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+bool_t Stepper::setMode(const Mode mode_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::setMode(const Mode)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Updates data members
+    this->_mode     = (Mode)mode_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+//     ////////////////////////    MOTION     ///////////////////////     //
+
+bool_t Stepper::setMotionProfile(cuint16_t maxSpeed_p, cuint16_t acceleration_p, cuint16_t tickFrequency_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::setMotionProfile(cuint16_t, cuint16_t, cuint16_t)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Local variables
+    int32_t auxIntervalFirst;
+    int32_t auxIntervalMin;
+
+    // Checks for errors
+    if(this->_isRunning) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+    if((maxSpeed_p == 0) || (acceleration_p == 0) || (maxSpeed_p > tickFrequency_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Evaluates intervals, in 1/256 ticks
+    //      c0 = 0.676 * f * sqrt(2 / a) (first step, with error correction)
+    //      cmin = f / vmax
+    auxIntervalFirst = (int32_t)(0.676 * 256.0 * (double)tickFrequency_p * sqrt(2.0 / (double)acceleration_p));
+    auxIntervalMin = ((int32_t)tickFrequency_p * 256) / maxSpeed_p;
+    if(auxIntervalFirst < auxIntervalMin) {
+        auxIntervalFirst = auxIntervalMin;
+    }
+
+    // Updates data members
+    this->_intervalFirst                = auxIntervalFirst;
+    this->_intervalMin                  = auxIntervalMin;
+    this->_isProfileSet                 = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+bool_t Stepper::moveTo(const int32_t position_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::moveTo(const int32_t)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Checks for errors
+    if(!this->_initialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+    if(!this->_isProfileSet) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Updates target; a running motion decelerates or reverses by itself
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_target = position_p;
+        if(!this->_isRunning) {
+            this->_rampStep = 0;
+            this->_updateInterval();
+            if(this->_rampStep != 0) {
+                this->_tickRemaining = this->_interval;
+                this->_isRunning = true;
+            }
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+bool_t Stepper::moveBy(const int32_t steps_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::moveBy(const int32_t)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Local variables
+    int32_t auxTarget;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        auxTarget = this->_target;
+    }
+
+    // Returns
+    return this->moveTo(auxTarget + steps_p);
+}
+
+bool_t Stepper::stop(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::stop(void)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Moves the target to the closest position reachable while decelerating
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(this->_isRunning) {
+            int32_t stepsToStop = (this->_rampStep >= 0) ? this->_rampStep : -this->_rampStep;
+            if(this->_direction == Rotation::CLOCKWISE) {
+                this->_target = this->_position + stepsToStop;
+            } else {
+                this->_target = this->_position - stepsToStop;
+            }
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+bool_t Stepper::setPosition(const int32_t position_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Stepper::setPosition(const int32_t)", Debug::CodeIndex::STEPPER_MODULE);
+
+    // Checks for errors
+    if(this->_isRunning) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, Debug::CodeIndex::STEPPER_MODULE);
+        return false;
+    }
+
+    // Updates data members
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_position = position_p;
+        this->_target = position_p;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
+    return true;
+}
+
+int32_t Stepper::getPosition(void)
+{
+    // Local variables
+    int32_t auxPosition;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        auxPosition = this->_position;
+    }
+
+    // Returns value
+    return auxPosition;
+}
+
+//     ///////////////////////    INTERRUPT     ///////////////////////     //
+
+void Stepper::interruptHandler(void)
+{
+    // CHECK - not running
+    if(!this->_isRunning) {
+        return;
+    }
+
+    // Waits for the step time, keeping the fractional part
+    this->_tickRemaining -= 256;
+    if(this->_tickRemaining > 0) {
+        return;
+    }
 
+    // Moves one step
+    this->_nextStep(this->_direction);
+    this->_position += (this->_direction == Rotation::CLOCKWISE) ? 1 : -1;
+
+    // Evaluates next step interval
+    this->_updateInterval();
+    this->_tickRemaining += this->_interval;
+
+    return;
+}
+
+// =============================================================================
+// Class own methods - Private
+// =============================================================================
+
+//     ///////////////////     CONTROL AND STATUS     ///////////////////     //
+
+void Stepper::_nextStep(const Rotation direction_p)
+{
     step_t auxStep = this->_step;
 
     if(this->_mode == Mode::HALF_STEP) {
@@ -214,31 +453,65 @@ bool_t Stepper::move(const Rotation direction_p)
     this->_step = auxStep;
     this->_doStep(auxStep);
 
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
-    return true;
+    return;
 }
 
-bool_t Stepper::setMode(const Mode mode_p)
+void Stepper::_updateInterval(void)
 {
-    // Mark passage for debugging purpose
-    debugMark("Stepper::setMode(const Mode)", Debug::CodeIndex::STEPPER_MODULE);
-
-    // Updates data members
-    this->_mode     = (Mode)mode_p;
+    // Local variables
+    int32_t distance = this->_target - this->_position;
+    int32_t stepsToStop = (this->_rampStep >= 0) ? this->_rampStep : -this->_rampStep;
+    int32_t auxInterval;
+
+    // Target reached and stopped
+    if((distance == 0) && (stepsToStop <= 1)) {
+        this->_rampStep = 0;
+        this->_isRunning = false;
+        return;
+    }
 
-    // Returns successfully
-    this->_lastError = Error::NONE;
-    debugMessage(Error::NONE, Debug::CodeIndex::STEPPER_MODULE);
-    return true;
-}
+    // Decides between accelerating and decelerating
+    if(distance >= 0) {
+        if(this->_rampStep > 0) {
+            if((stepsToStop >= distance) || (this->_direction == Rotation::COUNTERCLOCKWISE)) {
+                this->_rampStep = -stepsToStop;
+            }
+        } else if(this->_rampStep < 0) {
+            if((stepsToStop < distance) && (this->_direction == Rotation::CLOCKWISE)) {
+                this->_rampStep = stepsToStop;
+            }
+        }
+    } else {
+        if(this->_rampStep > 0) {
+            if((stepsToStop >= -distance) || (this->_direction == Rotation::CLOCKWISE)) {
+                this->_rampStep = -stepsToStop;
+            }
+        } else if(this->_rampStep < 0) {
+            if((stepsToStop < -distance) && (this->_direction == Rotation::COUNTERCLOCKWISE)) {
+                this->_rampStep = stepsToStop;
+            }
+        }
+    }
 
-// =============================================================================
-// Class own methods - Private
-// =============================================================================
+    // Evaluates next interval
+    if(this->_rampStep == 0) {
+        // Starts from rest
+        this->_direction = (distance > 0) ? Rotation::CLOCKWISE : Rotation::COUNTERCLOCKWISE;
+        this->_interval = this->_intervalFirst;
+        this->_rampStep = 1;
+    } else {
+        auxInterval = this->_interval - ((2 * this->_interval) / ((4 * this->_rampStep) + 1));
+        if((this->_rampStep > 0) && (auxInterval <= this->_intervalMin)) {
+            // Cruise: ramp index is kept, so it still counts the steps to stop
+            this->_interval = this->_intervalMin;
+        } else {
+            this->_interval = auxInterval;
+            this->_rampStep++;
+        }
+    }
 
-//     ///////////////////     CONTROL AND STATUS     ///////////////////     //
+    return;
+}
 
 void Stepper::_doStep(const step_t step_p)
 {
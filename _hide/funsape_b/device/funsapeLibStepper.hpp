@@ -63,8 +63,7 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
-
+cuint16_t constStepperDefaultTickFrequency      = 20000;    //!< Default interrupt tick frequency, in Hz
 
 
 // =============================================================================
@@ -92,6 +91,31 @@
 // Stepper - Class declaration
 // =============================================================================
 
+//!
+//! \brief          Stepper class
+//! \details        Stepper motor driver. Steps can be given one at a time by
+//!                     \ref move(), or generated in background by the motion
+//!                     engine: \ref moveTo() runs a trapezoidal profile
+//!                     (acceleration, cruise at maximum speed, deceleration)
+//!                     set by \ref setMotionProfile().
+//!                 The engine is driven by \ref interruptHandler(), called
+//!                     at a fixed tick frequency from a timer compare match
+//!                     callback (e.g. Timer1 in CTC mode). Several steppers can
+//!                     share the same tick:
+//! \code
+//!                 void timer1CompareACallback(void)
+//!                 {
+//!                     stepperX.interruptHandler();
+//!                     stepperY.interruptHandler();
+//!                 }
+//! \endcode
+//!                 Step intervals are kept in 1/256 tick units, so the
+//!                     fractional part is carried between steps and the mean
+//!                     speed is exact even at a few ticks per step. The
+//!                     interval is updated by the integer recurrence
+//!                     c(n) = c(n-1) - 2 c(n-1) / (4 n + 1), which takes a
+//!                     32-bit division only during the ramps.
+//!
 class Stepper
 {
     // -------------------------------------------------------------------------
@@ -141,10 +165,46 @@ public:
             const Rotation direction_p
     );
 
+    //     //////////////////////    MOTION     //////////////////////     //
+    bool_t setMotionProfile(
+            cuint16_t maxSpeed_p,
+            cuint16_t acceleration_p,
+            cuint16_t tickFrequency_p           = constStepperDefaultTickFrequency
+    );
+    bool_t moveTo(
+            const int32_t position_p
+    );
+    bool_t moveBy(
+            const int32_t steps_p
+    );
+    bool_t stop(
+            void
+    );
+    bool_t setPosition(
+            const int32_t position_p
+    );
+    int32_t getPosition(
+            void
+    );
+    inlined bool_t isRunning(void) {
+        return this->_isRunning;
+    }
+
+    //     /////////////////////    INTERRUPT     /////////////////////     //
+    void interruptHandler(
+            void
+    );
+
 private:
     void _doStep(
             const step_t step_p
     );
+    void _nextStep(
+            const Rotation direction_p
+    );
+    void _updateInterval(
+            void
+    );
 
     // NONE
 
@@ -164,9 +224,21 @@ private:
 
     //     /////////////////     CONTROL AND STATUS     /////////////////     //
     bool_t          _initialized                : 1;
-    step_t          _step                       : 3;
+    bool_t          _isProfileSet               : 1;
+    step_t          _step;
     Error           _lastError;
     Mode            _mode;
+
+    //     //////////////////////    MOTION     //////////////////////     //
+    vbool_t         _isRunning;
+    Rotation        _direction;
+    vint32_t        _position;
+    vint32_t        _target;
+    int32_t         _rampStep;                  // Ramp index, negative while decelerating
+    int32_t         _interval;                  // Current step interval, in 1/256 ticks
+    int32_t         _intervalFirst;             // First step interval, in 1/256 ticks
+    int32_t         _intervalMin;               // Interval at maximum speed, in 1/256 ticks
+    int32_t         _tickRemaining;             // Time to next step, in 1/256 ticks
 }; // class Stepper
 
 // =============================================================================
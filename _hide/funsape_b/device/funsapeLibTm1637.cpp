@@ -24,7 +24,7 @@
 // File exclusive - Constants
 // =============================================================================
 
-cuint8_t clockPeriod = 10;
+cuint16_t constHalfPeriodCycles = (F_CPU / (2 * TM1637_CLOCK_FREQUENCY));
 cuint8_t segments[16] = {
     0b00111111,
     0b00000110,
@@ -54,7 +54,7 @@ cuint8_t segments[16] = {
 // File exclusive - Macro-functions
 // =============================================================================
 
-// NONE
+#define halfPeriodDelay()               __builtin_avr_delay_cycles(constHalfPeriodCycles)
 
 // =============================================================================
 // Global variables
@@ -84,6 +84,7 @@ Tm1637::Tm1637(void)
     this->_initialized                  = false;
     this->_showDisplay                  = false;
     this->_useAutoIncrementMode         = true;
+    this->_dataSetting                  = 0xFF;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -103,6 +104,7 @@ Tm1637::Tm1637(const GpioPin *dioPin_p, const GpioPin *clkPin_p)
     this->_initialized                  = false;
     this->_showDisplay                  = false;
     this->_useAutoIncrementMode         = true;
+    this->_dataSetting                  = 0xFF;
 
     // Check function arguments for errors
     if((!isPointerValid(dioPin_p)) || (!isPointerValid(clkPin_p))) {
@@ -162,6 +164,7 @@ bool_t Tm1637::init(const GpioPin *dioPin_p, const GpioPin *clkPin_p)
     this->_initialized                  = false;
     this->_showDisplay                  = false;
     this->_useAutoIncrementMode         = true;
+    this->_dataSetting                  = 0xFF;
 
     // Check function arguments for errors
     if((!isPointerValid(dioPin_p)) || (!isPointerValid(clkPin_p))) {
@@ -300,7 +303,6 @@ bool_t Tm1637::writeDisplayData(cuint16_t displayValue_p, cuint8_t base_p)
     uint8_t auxSegments[4] = {0, 0, 0, 0};
     uint8_t aux8 = 0;
     uint16_t aux16 = displayValue_p;
-    cuint8_t displayIndex = 0;
 
     // CHECK FOR ERROR - peripheral not initialized
     if(!this->_isInitialized()) {
@@ -316,28 +318,83 @@ bool_t Tm1637::writeDisplayData(cuint16_t displayValue_p, cuint8_t base_p)
         return false;
     }
 
-    // Extract digits
+    // Extract digits (most significant first)
     for(uint8_t i = 0; i < 4; i++) {
         aux8 = (aux16 % base_p);
         aux16 /= (uint16_t)base_p;
-        auxSegments[i] = segments[aux8];
+        auxSegments[3 - i] = segments[aux8];
+    }
+
+    // Writing data to display
+    if(!this->writeDisplayBuffer(auxSegments, 4, 1)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
+bool_t Tm1637::writeDisplayBuffer(cuint8_t *segments_p, cuint8_t size_p, cuint8_t startIndex_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Tm1637::writeDisplayBuffer(cuint8_t *, cuint8_t, cuint8_t)", Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t aux8 = 0;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - null pointer
+    if(!isPointerValid(segments_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - six grid addresses
+    if((startIndex_p == 0) || (size_p == 0) || ((startIndex_p - 1 + size_p) > 6)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Auto-increment write mode (a frame is sent only if the mode changed)
+    if(!this->_setDataMode((uint8_t)Command::DATA_SETTING)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
     }
 
     // Prepare command
     aux8 = (uint8_t)Command::DISPLAY_ADDRESS;
     setMaskOffset(aux8,
-            ((uint8_t)(displayIndex) & (uint8_t)(BitMask::DISPLAY_ADDRESS)),
+            ((uint8_t)(startIndex_p - 1) & (uint8_t)(BitMask::DISPLAY_ADDRESS)),
             (uint8_t)(BitPos::DISPLAY_ADDRESS));
 
-    // Writing data to display
+    // Writing address and all digits in a single frame
     this->_sendStart();
     this->_writeByte(aux8);
-    this->_readAck();
-    for(uint8_t i = 0; i < 4; i++) {
-        this->_writeByte(auxSegments[3 - i]);
-        this->_readAck();
+    aux8 = this->_readAck();
+    for(uint8_t i = 0; (i < size_p) && aux8; i++) {
+        this->_writeByte(segments_p[i]);
+        aux8 = this->_readAck();
     }
     this->_sendStop();
+    if(!aux8) {
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -379,6 +436,13 @@ bool_t Tm1637::writeDisplayData(cuint8_t segments_p, cuint8_t index_p, cbool_t s
         auxSegments |= 0x80;
     }
 
+    // Auto-increment write mode (a frame is sent only if the mode changed)
+    if(!this->_setDataMode((uint8_t)Command::DATA_SETTING)) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
     // Writing data to display
     this->_sendStart();
     this->_writeByte(aux8);
@@ -397,7 +461,52 @@ bool_t Tm1637::writeDisplayData(cuint8_t segments_p, cuint8_t index_p, cbool_t s
 
 bool_t Tm1637::readKeypadData(uint8_t *keyPressed_p)
 {
-    // FIXME: Implement this function
+    // Mark passage for debugging purpose
+    debugMark("Tm1637::readKeypadData(uint8_t *)", Debug::CodeIndex::TM1637_MODULE);
+
+    // Local variables
+    uint8_t aux8 = (uint8_t)Command::DATA_SETTING;
+
+    // CHECK FOR ERROR - peripheral not initialized
+    if(!this->_isInitialized()) {
+        // Returns error
+        debugMessage(this->_lastError, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    // CHECK FOR ERROR - null pointer
+    if(!isPointerValid(keyPressed_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+
+    // Prepare command
+    setMaskOffset(aux8,
+            ((uint8_t)(BitMask::DATA_SETTING_MODE_READ)),
+            (uint8_t)(BitPos::DATA_SETTING_MODE_READ));
+
+    // Reads the key scan result in a single frame, without waiting for a key
+    this->_sendStart();
+    this->_writeByte(aux8);
+    if(!this->_readAck()) {
+        this->_sendStop();
+        this->_dataSetting = 0xFF;
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    this->_readByte(keyPressed_p);
+    this->_readAck();
+    this->_sendStop();
+
+    // Update data members
+    this->_dataSetting                  = aux8;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
     return true;
 }
 
@@ -426,6 +535,41 @@ bool_t Tm1637::_isInitialized(void)
     return true;
 }
 
+bool_t Tm1637::_setDataMode(cuint8_t dataSetting_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Tm1637::_setDataMode(cuint8_t)", Debug::CodeIndex::TM1637_MODULE);
+
+    // Already in this mode
+    if(this->_dataSetting == dataSetting_p) {
+        // Returns successfully
+        this->_lastError = Error::NONE;
+        debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+        return true;
+    }
+
+    // Send command
+    this->_sendStart();
+    this->_writeByte(dataSetting_p);
+    if(!this->_readAck()) {
+        this->_sendStop();
+        this->_dataSetting = 0xFF;
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TM1637_MODULE);
+        return false;
+    }
+    this->_sendStop();
+
+    // Update data members
+    this->_dataSetting                  = dataSetting_p;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TM1637_MODULE);
+    return true;
+}
+
 //     /////////////////     COMMUNICATION PROTOCOL     /////////////////     //
 
 void Tm1637::_sendStart(void)
@@ -433,11 +577,11 @@ void Tm1637::_sendStart(void)
     // Pull lines up
     this->_clkPin->set();
     this->_dioPin->setMode(GpioPin::Mode::INPUT_FLOATING);
-    delayUs(clockPeriod);
+    halfPeriodDelay();
 
     // Send start condition
     this->_dioPin->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
-    delayUs(clockPeriod / 2);
+    halfPeriodDelay();
     this->_clkPin->clr();
 
     return;
@@ -448,11 +592,11 @@ void Tm1637::_sendStop(void)
     // Assuring the DIO line is driven LOW
     this->_dioPin->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
     // Send stop condition
-    delayUs(clockPeriod / 2);
+    halfPeriodDelay();
     this->_clkPin->set();
-    delayUs(clockPeriod / 2);
+    halfPeriodDelay();
     this->_dioPin->setMode(GpioPin::Mode::INPUT_FLOATING);
-    delayUs(clockPeriod);
+    halfPeriodDelay();
 
     return;
 }
@@ -465,9 +609,9 @@ void Tm1637::_writeByte(cuint8_t byteToWrite_p)
         } else {
             this->_dioPin->setMode(GpioPin::Mode::OUTPUT_PUSH_PULL);
         }
-        delayUs(clockPeriod / 2);
+        halfPeriodDelay();
         this->_clkPin->set();
-        delayUs(clockPeriod / 2);
+        halfPeriodDelay();
         this->_clkPin->clr();
     }
 
@@ -476,7 +620,24 @@ void Tm1637::_writeByte(cuint8_t byteToWrite_p)
 
 void Tm1637::_readByte(uint8_t *byteRead_p)
 {
-    // FIXME: Implement this function
+    // Local variables
+    uint8_t aux8 = 0;
+
+    // Releases DIO line
+    this->_dioPin->setMode(GpioPin::Mode::INPUT_FLOATING);
+
+    // Reads data bits, LSB first, while CLK is high
+    for(uint8_t i = 0; i < 8; i++) {
+        halfPeriodDelay();
+        this->_clkPin->set();
+        halfPeriodDelay();
+        if(this->_dioPin->read()) {
+            setBit(aux8, i);
+        }
+        this->_clkPin->clr();
+    }
+    *byteRead_p = aux8;
+
     return;
 }
 
@@ -484,14 +645,14 @@ bool_t Tm1637::_readAck(void)
 {
     // Releases DIO line
     this->_dioPin->setMode(GpioPin::Mode::INPUT_FLOATING);
-    // Reads ACK bit
-    delayUs(clockPeriod / 2);
+    // Reads ACK bit (DIO pulled low by the device)
+    halfPeriodDelay();
     this->_clkPin->set();
-    this->_dioPin->read();
-    delayUs(clockPeriod / 2);
+    halfPeriodDelay();
+    bool_t ack = !this->_dioPin->read();
     this->_clkPin->clr();
 
-    return true;
+    return ack;
 }
 
 // =============================================================================
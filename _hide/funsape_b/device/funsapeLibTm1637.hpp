@@ -63,7 +63,17 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef TM1637_CLOCK_FREQUENCY
+//!
+//! \brief          TM1637 serial clock frequency, in Hz
+//! \details        The half clock period is derived from F_CPU at compile time.
+//!                     The device accepts up to 500 kHz, but the open-drain
+//!                     rise time through the pull-ups limits it in practice.
+//!
+#   define TM1637_CLOCK_FREQUENCY       250000UL
+#endif
+
+cuint8_t constTm1637KeyNone             = 0xFF;     //!< Returned by readKeypadData() if no key is pressed
 
 // =============================================================================
 // Macro-function definitions
@@ -208,6 +218,11 @@ public:
             cuint8_t index_p,
             cbool_t showDot_p
     );
+    bool_t writeDisplayBuffer(
+            cuint8_t *segments_p,
+            cuint8_t size_p = 4,
+            cuint8_t startIndex_p = 1
+    );
 
     //     ///////////////////     KEYPAD CONTROL     ///////////////////     //
     bool_t readKeypadData(
@@ -219,6 +234,9 @@ private:
     bool_t _isInitialized(
             void
     );
+    bool_t _setDataMode(
+            cuint8_t dataSetting_p
+    );
 
     //     ///////////////     COMMUNICATION PROTOCOL     ///////////////     //
     void _sendStart(
@@ -255,6 +273,7 @@ private:
     bool_t          _initialized                : 1;
     Error           _lastError;
     bool_t          _useAutoIncrementMode       : 1;
+    uint8_t         _dataSetting;               // Last data setting command sent, 0xFF if unknown
 
     //     ///////////////////    DISPLAY CONTROL     ///////////////////     //
     Contrast        _contrastLevel;
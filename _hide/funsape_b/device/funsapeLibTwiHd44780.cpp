@@ -72,6 +72,10 @@ void doWrite(uint16_t value_p);
 #define PCF8574_PIN_DB6 0x40
 #define PCF8574_PIN_DB7 0x80
 
+// Clear and home execution time (1.52 ms) plus the transfer, rounded up to
+// whole SoftTimer ticks with one extra tick for the current partial one
+#define TWI_HD44780_CLEAR_TICKS         (((3UL * SOFT_TIMER_TICK_FREQUENCY) + 999UL) / 1000UL + 1UL)
+
 // commands
 #define LCD_CLEARDISPLAY 0x01
 #define LCD_RETURNHOME 0x02
@@ -162,6 +166,13 @@ TwiHd44780::TwiHd44780(uint8_t addr)
     this->_displayOn                    = false;
     this->_isBusyInitialized            = false;
     this->_isInterfaceInitialized       = false;
+    this->_shadow.reset();
+    this->_batchLength                  = 0;
+    this->_batchMaxLength               = TWI_HD44780_BATCH_SIZE;
+    this->_batchControl                 = 0xFF;
+    this->_batchHold                    = false;
+    this->_busyPending                  = false;
+    this->_busyDeadline                 = 0;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -192,6 +203,26 @@ bool TwiHd44780::init(const Size size_p, const Font font_p)
     // Local variables
     uint8_t auxCmd                      = 0;
 
+    // Check for errors
+    if(twi.getBufferSize() == 0) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Limits the transfer batch to the TWI buffer (register byte plus message)
+    this->_batchMaxLength               = TWI_HD44780_BATCH_SIZE;
+    if(twi.getBufferSize() < TWI_HD44780_BATCH_SIZE) {
+        this->_batchMaxLength           = twi.getBufferSize() + 1;
+    }
+    if(this->_batchMaxLength < 6) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_SMALL;
+        debugMessage(Error::BUFFER_SIZE_TOO_SMALL, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
     // Updates some member variables
     this->_font                         = font_p;
     this->_isBusyInitialized            = false;
@@ -240,6 +271,7 @@ bool TwiHd44780::init(const Size size_p, const Font font_p)
     this->_lines                        = ((((uint8_t)size_p) * 2) / 100) - 1;
     this->_columns                      = ((((uint8_t)size_p) * 2) % 100) - 1;
     this->_isInterfaceInitialized       = true;
+    this->_shadow.setSize(this->_lines + 1, this->_columns + 1);
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -270,6 +302,7 @@ bool_t TwiHd44780::clearScreen()
     }
     this->_cursorLine                   = 0;
     this->_cursorColumn                 = 0;
+    this->_shadow.reset();
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -277,6 +310,18 @@ bool_t TwiHd44780::clearScreen()
     return true;
 }
 
+bool_t TwiHd44780::isReady(void)
+{
+    if(this->_busyPending) {
+        if((int32_t)(softTimer.getTicks() - this->_busyDeadline) < 0) {
+            return false;
+        }
+        this->_busyPending = false;
+    }
+
+    return true;
+}
+
 bool TwiHd44780::cursorGoTo(uint8_t line_p, uint8_t column_p)
 {
     // Mark passage for debugging purpose
@@ -293,33 +338,7 @@ bool TwiHd44780::cursorGoTo(uint8_t line_p, uint8_t column_p)
         return false;
     }
 
-    switch(line_p) {
-    case 0:     // Go to line 0
-        address = column_p;
-        break;
-    case 1:     // Go to line 1
-        address = (this->_lines >= 1) ? (0x40 + column_p) : 0xFF;
-        break;
-    case 2:     // Go to line 2
-        if((this->_lines == 3) && (this->_columns == 11)) {             // Display 12x4
-            address = 0x0C + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 15)) {      // Display 16x4
-            address = 0x10 + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 19)) {      // Display 20x4
-            address = 0x14 + column_p;
-        }
-        break;
-    case 3:     // Go to line 3
-        if((this->_lines == 3) && (this->_columns == 11)) {             // Display 12x4
-            address = 0x4C + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 15)) {      // Display 16x4
-            address = 0x50 + column_p;
-        } else if((this->_lines == 3) && (this->_columns == 19)) {      // Display 20x4
-            address = 0x54 + column_p;
-        }
-        break;
-    }
-
+    address = this->_shadow.getDdramAddress(line_p, column_p);
     if(address != 0xFF) {
         this->_cursorLine               = line_p;
         this->_cursorColumn             = column_p;
@@ -718,10 +737,169 @@ bool_t TwiHd44780::print(cchar_t *string_p)
         return false;
     }
 
+    // Whole string goes in as few TWI writes as possible
+    this->_batchHold = true;
     while(string_p[i]) {
         this->print(string_p[i]);
         i++;
     }
+    this->_batchHold = false;
+    if(!this->_batchFlush()) {
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+//     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+bool_t TwiHd44780::bufferClear(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::bufferClear(void)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Fills buffer with spaces
+    this->_shadow.clear();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+bool_t TwiHd44780::bufferGoTo(cuint8_t line_p, cuint8_t column_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::bufferGoTo(cuint8_t, cuint8_t)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Updates buffer cursor
+    if(!this->_shadow.goTo(line_p, column_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+bool_t TwiHd44780::bufferPrint(cchar_t character_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::bufferPrint(cchar_t)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    this->_shadow.print(character_p);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+bool_t TwiHd44780::bufferPrint(cchar_t *string_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::bufferPrint(cchar_t *)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Local variables
+    uint8_t i = 0;
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+    if(!isPointerValid(string_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    while(string_p[i]) {
+        this->bufferPrint(string_p[i]);
+        i++;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+bool_t TwiHd44780::bufferInvalidate(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::bufferInvalidate(void)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Marks all positions as dirty
+    this->_shadow.invalidate();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, Debug::CodeIndex::TwiHd44780_MODULE);
+    return true;
+}
+
+bool_t TwiHd44780::refresh(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("TwiHd44780::refresh(void)", Debug::CodeIndex::TwiHd44780_MODULE);
+
+    // Check for errors
+    if(!this->_isInterfaceInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
+
+    // Sends dirty runs, then restores cursor position
+    this->_batchHold = true;
+    this->_shadow.refresh(&TwiHd44780::_shadowWrite, this,
+            this->_shadow.getDdramAddress(this->_cursorLine, this->_cursorColumn));
+    this->_batchHold = false;
+    if(!this->_batchFlush()) {
+        // Returns error
+        this->_lastError = Error::COMMUNICATION_FAILED;
+        debugMessage(Error::COMMUNICATION_FAILED, Debug::CodeIndex::TwiHd44780_MODULE);
+        return false;
+    }
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -737,6 +915,8 @@ static int twiLcdWriteStd(char character, FILE *stream)
 
 void TwiHd44780::_enablePulse(uint8_t data)
 {
+    this->_batchControl = 0xFF;                             // Port state no longer tracked
+
     uint8_t control = (data | PCF8574_PIN_E);
     // Send E HIGH
     twi.sendData(_deviceAddress, Twi::Operation::WRITE, 0, &control, 1);
@@ -771,11 +951,14 @@ bool TwiHd44780::_writeCommand(uint8_t command_p)
 
     bool res = Send_8bits(command_p, PCF8574_PIN_P3); // PCF8574_PIN_P3 sets backlight
 
+    // Other commands execute within the two bytes sent before the next
+    // enable pulse, so only clear and home need a deadline; the next byte
+    // sent waits for it in _batchFlush()
     if(!this->_useBusyFlag) {
         if((command_p == LCD_CLEAR_DISPLAY) || (command_p == LCD_RETURN_HOME)) {
-            delayMs(2);
-        } else {
-            delayUs(40);
+            res = this->_batchFlush() && res;
+            this->_busyDeadline = softTimer.getTicks() + TWI_HD44780_CLEAR_TICKS;
+            this->_busyPending = true;
         }
     }
     return res;
@@ -836,17 +1019,71 @@ bool TwiHd44780::_isBusy()
 
 bool TwiHd44780::Send_8bits(uint8_t data, uint8_t annex)
 {
-    // 1. Upper Nibble
     uint8_t up_nibble = (data & 0xF0) | annex;
-    twi.sendData(_deviceAddress, Twi::Operation::WRITE, 0, &up_nibble, 1);
-    _enablePulse(up_nibble);
-
-    // 2. Lower Nibble
     uint8_t low_nibble = (data << 4) | annex;
-    twi.sendData(_deviceAddress, Twi::Operation::WRITE, 0, &low_nibble, 1);
-    _enablePulse(low_nibble);
 
-    return twi.getLastError() == Error::NONE;
+    // Worst case is 5 bytes: RS setup plus two EN-high/EN-low pairs
+    if((this->_batchLength + 5) > this->_batchMaxLength) {
+        if(!this->_batchFlush()) {
+            return false;
+        }
+    }
+
+    // RS must settle before EN rises; data is only sampled when EN falls
+    if(this->_batchControl != annex) {
+        this->_batchBuffer[this->_batchLength++] = up_nibble;
+        this->_batchControl = annex;
+    }
+    this->_batchBuffer[this->_batchLength++] = up_nibble | PCF8574_PIN_E;
+    this->_batchBuffer[this->_batchLength++] = up_nibble;
+    this->_batchBuffer[this->_batchLength++] = low_nibble | PCF8574_PIN_E;
+    this->_batchBuffer[this->_batchLength++] = low_nibble;
+
+    if(this->_batchHold) {
+        return true;
+    }
+    return this->_batchFlush();
+}
+
+bool_t TwiHd44780::_batchFlush(void)
+{
+    bool_t result = true;
+
+    // The register byte of sendData() is just the first byte written to the
+    // PCF8574, so it carries the first byte of the batch
+    if(this->_batchLength > 0) {
+        this->_waitDeadline();
+        result = twi.sendData(this->_deviceAddress, Twi::Operation::WRITE, this->_batchBuffer[0],
+                        &this->_batchBuffer[1], this->_batchLength - 1);
+        this->_batchLength = 0;
+    }
+
+    return result;
+}
+
+void TwiHd44780::_waitDeadline(void)
+{
+    // Bounded by the 3 ms the command takes, in case the SoftTimer is not running
+    for(uint8_t i = 0; (i < 30) && !this->isReady(); i++) {
+        delayUs(100);
+    }
+    this->_busyPending = false;
+
+    return;
+}
+
+void TwiHd44780::_shadowWrite(void *context_p, cuint8_t data_p, cbool_t isData_p)
+{
+    // Local variables
+    TwiHd44780 *display                 = (TwiHd44780 *)context_p;
+
+    if(isData_p) {
+        display->_writeData(data_p);
+    } else {
+        display->_writeCommand(data_p);
+    }
+
+    return;
 }
 
 // =============================================================================
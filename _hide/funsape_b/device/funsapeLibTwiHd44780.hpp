@@ -39,6 +39,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibTwi.hpp)!"
 #endif
 
+#include "funsapeLibHd44780Shadow.hpp"
+#if !defined(__FUNSAPE_LIB_HD44780_SHADOW_HPP)
+#   error "Header file (funsapeLibHd44780Shadow.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_HD44780_SHADOW_HPP != __FUNSAPE_LIB_TWIHD44780_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibHd44780Shadow.hpp)!"
+#endif
+
 #include "../util/funsapeLibDebug.hpp"
 #if !defined(__FUNSAPE_LIB_DEBUG_HPP)
 #   error "Header file (funsapeLibDebug.hpp) is corrupted!"
@@ -46,6 +53,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
 #endif
 
+#include "../util/funsapeLibSoftTimer.hpp"
+#if !defined(__FUNSAPE_LIB_SOFT_TIMER_HPP)
+#   error "Header file (funsapeLibSoftTimer.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_SOFT_TIMER_HPP != __FUNSAPE_LIB_TWIHD44780_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibSoftTimer.hpp)!"
+#endif
+
 //     ///////////////////     STANDARD C LIBRARY     ///////////////////     //
 
 // NONE
@@ -64,7 +78,23 @@
 // Constant definitions
 // =============================================================================
 
-// NONE
+#ifndef TWI_HD44780_BATCH_SIZE
+//!
+//! \brief          Size of the TwiHd44780 transfer batch.
+//! \details        Maximum number of PCF8574 bytes sent in a single TWI
+//!                     write. Each character takes 4 bytes, so the default
+//!                     holds a full 20-column line with its DDRAM address and
+//!                     cursor restore commands (91 bytes). At init() the batch
+//!                     is further limited to the buffer size given to
+//!                     twi.init() plus one; a 20-byte TWI buffer still works,
+//!                     it just splits each line into more transfers.
+//!
+#   define TWI_HD44780_BATCH_SIZE               92
+#endif
+
+#if (TWI_HD44780_BATCH_SIZE < 6) || (TWI_HD44780_BATCH_SIZE > 255)
+#   error "TWI_HD44780_BATCH_SIZE must be between 6 and 255!"
+#endif
 
 // =============================================================================
 // New data types
@@ -239,6 +269,20 @@ public:
     //! \return     bool_t              Return info
     //!
     bool_t clearScreen();
+
+    //!
+    //! \brief      Checks if the display accepts new bytes.
+    //! \details    Clear and home take up to 1.52 ms to execute. Without the
+    //!                 busy flag the driver does not wait for them; it marks
+    //!                 the display as busy until a SoftTimer deadline instead,
+    //!                 and the next byte sent waits for what is left of it.
+    //!                 Polling this function lets the application do other
+    //!                 work in the meantime.
+    //! \return     bool_t              True if ready, false if still busy
+    //!
+    bool_t isReady(
+            void
+    );
     //!
     //! \brief Sets the cursor to the home position (0, 0) without clearing.
     //! \return True on success.
@@ -358,6 +402,82 @@ public:
             cchar_t *string_p
     );
 
+    //     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+    //!
+    //! \brief      Clears the shadow buffer.
+    //! \details    Fills the shadow buffer with spaces and moves the buffer
+    //!                 cursor to the first position. The display is only
+    //!                 updated by \ref refresh().
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferClear(
+            void
+    );
+
+    //!
+    //! \brief      Moves the shadow buffer cursor.
+    //! \details    Moves the cursor used by \ref bufferPrint().
+    //! \param      line_p              Line (0 to lines - 1)
+    //! \param      column_p            Column (0 to columns - 1)
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferGoTo(
+            cuint8_t line_p,
+            cuint8_t column_p
+    );
+
+    //!
+    //! \brief      Prints a character to the shadow buffer.
+    //! \details    Writes a character at the buffer cursor and marks it as
+    //!                 dirty if it differs from the buffered one. A line feed
+    //!                 fills the rest of the line with spaces and moves to the
+    //!                 next line. Characters past the end of the line are
+    //!                 discarded.
+    //! \param      character_p         Character to be printed
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferPrint(
+            cchar_t character_p
+    );
+
+    //!
+    //! \brief      Prints a string to the shadow buffer.
+    //! \details    Prints each character of the string with \ref
+    //!                 bufferPrint(cchar_t).
+    //! \param      string_p            String to be printed
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferPrint(
+            cchar_t *string_p
+    );
+
+    //!
+    //! \brief      Marks the whole shadow buffer as dirty.
+    //! \details    Forces the next \ref refresh() to redraw every character.
+    //!                 Must be called after the display is written directly
+    //!                 with \ref print().
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t bufferInvalidate(
+            void
+    );
+
+    //!
+    //! \brief      Sends the changed characters to the display.
+    //! \details    Sends only the dirty runs of the shadow buffer. A DDRAM
+    //!                 address command is only sent when the next dirty
+    //!                 character is not at the controller address counter; a
+    //!                 single clean character between two runs is rewritten
+    //!                 instead, since it costs the same as the command. The
+    //!                 display must be in Step::INCREMENT / DisplayMode::OVERWRITE
+    //!                 entry mode. The cursor position is restored at the end.
+    //! \return     bool_t              True on success / False on failure
+    //!
+    bool_t refresh(
+            void
+    );
+
 private:
     //!
     //! \brief Sends an instruction command (RS=LOW) to the LCD.
@@ -389,6 +509,19 @@ private:
     //!
     bool_t _isBusy();
 
+    //!
+    //! \brief      Shadow buffer write function.
+    //! \details    Sends a byte on behalf of \ref Hd44780ShadowBuffer::refresh().
+    //! \param      context_p           Display object
+    //! \param      data_p              Byte to be sent
+    //! \param      isData_p            True for DDRAM data, false for commands
+    //!
+    static void _shadowWrite(
+            void *context_p,
+            cuint8_t data_p,
+            cbool_t isData_p
+    );
+
     //!
     //! \brief      Brief description
     //! \details    Long description
@@ -445,6 +578,10 @@ private:
     bool_t          _cursorOn                   : 1;    // 0 off, 1 on
     bool_t          _displayOn                  : 1;    // 0 off, 1 on
 
+    //     ////////////////////    SHADOW BUFFER     ////////////////////     //
+
+    Hd44780ShadowBuffer _shadow;
+
 protected:
 
     // NONE
@@ -462,9 +599,24 @@ private:
     //! \brief Sends a single 4-bit nibble, used only during the 4-bit initialization sequence.
     void _functionSet4Bits(uint8_t data_nibble);
 
-    //! \brief Sends a full 8-bit command/data in two 4-bit transfers.
+    //! \brief Appends a full 8-bit command/data to the transfer batch, as two
+    //!     EN-high/EN-low nibble pairs. Sends the batch unless it is held.
     bool Send_8bits(uint8_t data, uint8_t annex);
 
+    //! \brief Sends the transfer batch in a single TWI write.
+    bool_t _batchFlush(void);
+
+    //! \brief Waits for the clear / home deadline, bounded by the execution time.
+    void _waitDeadline(void);
+
+    uint8_t         _batchBuffer[TWI_HD44780_BATCH_SIZE];
+    uint8_t         _batchLength;
+    uint8_t         _batchMaxLength;                    // Limited by the TWI buffer
+    uint8_t         _batchControl;                      // Control lines of the last byte
+    bool_t          _batchHold                  : 1;    // Defer sending until _batchFlush()
+    bool_t          _busyPending                : 1;    // Clear / home still executing
+    uint32_t        _busyDeadline;                      // SoftTimer tick when ready
+
     bool _writeCharacter(uint8_t character_p);
     bool _cursorMoveNextLine();
     bool _cursorMove(uint8_t col_p, uint8_t row_p); // To update the internal state and LCD
@@ -169,18 +169,20 @@ bool_t GpioBus::setMode(Mode mode_p)
     }
 
     // Configure pin
-    switch(mode_p) {
-    case Mode::INPUT_FLOATING:
-        clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
-        break;
-    case Mode::INPUT_PULLED_UP:
-        clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        setMask(*(this->_regOut), (uint8_t)this->_pinMask);
-        break;
-    case Mode::OUTPUT_PUSH_PULL:
-        setMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        break;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        switch(mode_p) {
+        case Mode::INPUT_FLOATING:
+            clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+            break;
+        case Mode::INPUT_PULLED_UP:
+            clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+            break;
+        case Mode::OUTPUT_PUSH_PULL:
+            setMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            break;
+        }
     }
 
     // Update data members
@@ -205,10 +207,12 @@ bool_t GpioBus::write(uint8_t data_p)
         return false;
     }
 
-    aux8 = *(this->_regOut);
-    clrMask(aux8, (uint8_t)(this->_pinMask));
-    aux8 |= ((data_p << (uint8_t)this->_pinIndex) & (uint8_t)(this->_pinMask));
-    *(this->_regOut) = aux8;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        aux8 = *(this->_regOut);
+        clrMask(aux8, (uint8_t)(this->_pinMask));
+        aux8 |= ((data_p << (uint8_t)this->_pinIndex) & (uint8_t)(this->_pinMask));
+        *(this->_regOut) = aux8;
+    }
 
     // Returns successfully
     this->_lastError = Error::NONE;
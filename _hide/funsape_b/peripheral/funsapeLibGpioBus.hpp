@@ -86,6 +86,19 @@
 //! \brief          GpioBus class.
 //! \details        This class manages the General Purpose Input-Output (GPIO)
 //!                     peripheral in bus mode.
+//!                 set(), clr(), write() and setMode() do their read-modify-write of
+//!                     PORTx/DDRx inside an ATOMIC_BLOCK, and cpl()
+//!                     write the mask to PINx. A main loop write to one pin
+//!                     can therefore not undo an interrupt write to another
+//!                     pin of the same port. In this library the interrupt
+//!                     writers are Hd44780::queueHandler() (RS, E and data),
+//!                     Keypad::interruptHandler() (columns),
+//!                     SevenSegmentsMuxDisplay::interruptHandler() (digit
+//!                     and segment lines) and Stepper::interruptHandler()
+//!                     (coils). Code that writes PORTx directly must protect
+//!                     its own read-modify-write. Toggling through PINx
+//!                     needs an AVR with that feature (ATmega48/88/168/328
+//!                     family).
 //! \warning        This class is not instantiated by default. The user may
 //!                     create as many instances as necessary.
 //!
@@ -152,7 +165,9 @@ public:
     //     /////////////////    PIN RELATED METHODS     /////////////////     //
     inlined void clr(void) {
         // Clear pin
-        clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        }
 
         // Returns
         return;
@@ -160,23 +175,25 @@ public:
 
     inlined void clr(uint8_t bitIndex_p) {
         // Clear pin
-        clrBit(*(this->_regOut), (bitIndex_p + (uint8_t)this->_pinIndex));
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            clrBit(*(this->_regOut), (bitIndex_p + (uint8_t)this->_pinIndex));
+        }
 
         // Returns
         return;
     }
 
     inlined void cpl(void) {
-        // Toggle pin
-        cplMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        // Toggle pin (writing one to PINx, no read-modify-write)
+        *(this->_regIn) = (uint8_t)this->_pinMask;
 
         // Returns
         return;
     }
 
     inlined void cpl(uint8_t bitIndex_p) {
-        // Clear pin
-        cplBit(*(this->_regOut), (bitIndex_p + (uint8_t)this->_pinIndex));
+        // Toggle pin (writing one to PINx, no read-modify-write)
+        *(this->_regIn) = (uint8_t)(1 << (bitIndex_p + (uint8_t)this->_pinIndex));
 
         // Returns
         return;
@@ -184,7 +201,9 @@ public:
 
     inlined void set(void) {
         // Set pin
-        setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        }
 
         // Returns
         return;
@@ -192,7 +211,9 @@ public:
 
     inlined void set(uint8_t bitIndex_p) {
         // Clear pin
-        setBit(*(this->_regOut), (bitIndex_p + (uint8_t)this->_pinIndex));
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            setBit(*(this->_regOut), (bitIndex_p + (uint8_t)this->_pinIndex));
+        }
 
         // Returns
         return;
@@ -254,6 +275,17 @@ public:
         return this->_isInitialized;
     }
 
+    //     //////////////////    DIRECT PORT ACCESS     //////////////////     //
+    // Lets interrupt handlers precompute the port values and write the
+    //      PORTx register directly; writes must keep the other bits
+    inlined ioRegAddress_t getOutputRegister(void) {
+        return this->_regOut;
+    }
+
+    inlined uint8_t getPinMask(void) {
+        return (uint8_t)this->_pinMask;
+    }
+
     // -------------------------------------------------------------------------
     // Properties --------------------------------------------------------------
 private:
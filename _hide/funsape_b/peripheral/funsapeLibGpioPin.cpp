@@ -163,18 +163,20 @@ bool_t GpioPin::setMode(Mode mode_p)
     }
 
     // Configure pin
-    switch(mode_p) {
-    case Mode::INPUT_FLOATING:
-        clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
-        break;
-    case Mode::INPUT_PULLED_UP:
-        clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        setMask(*(this->_regOut), (uint8_t)this->_pinMask);
-        break;
-    case Mode::OUTPUT_PUSH_PULL:
-        setMask(*(this->_regDir), (uint8_t)this->_pinMask);
-        break;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        switch(mode_p) {
+        case Mode::INPUT_FLOATING:
+            clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+            break;
+        case Mode::INPUT_PULLED_UP:
+            clrMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+            break;
+        case Mode::OUTPUT_PUSH_PULL:
+            setMask(*(this->_regDir), (uint8_t)this->_pinMask);
+            break;
+        }
     }
 
     // Update data members
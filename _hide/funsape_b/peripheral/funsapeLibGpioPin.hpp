@@ -88,6 +88,19 @@
 //! \brief          GpioPin class.
 //! \details        This class manages the General Purpose Input-Output (GPIO)
 //!                     peripheral in single pin mode.
+//!                 set(), clr(), low(), high() and setMode() do their read-modify-write of
+//!                     PORTx/DDRx inside an ATOMIC_BLOCK, and cpl() and toggle()
+//!                     write the mask to PINx. A main loop write to one pin
+//!                     can therefore not undo an interrupt write to another
+//!                     pin of the same port. In this library the interrupt
+//!                     writers are Hd44780::queueHandler() (RS, E and data),
+//!                     Keypad::interruptHandler() (columns),
+//!                     SevenSegmentsMuxDisplay::interruptHandler() (digit
+//!                     and segment lines) and Stepper::interruptHandler()
+//!                     (coils). Code that writes PORTx directly must protect
+//!                     its own read-modify-write. Toggling through PINx
+//!                     needs an AVR with that feature (ATmega48/88/168/328
+//!                     family).
 //! \warning        This class is not instantiated by default. The user may
 //!                     create as many instances as necessary.
 //!
@@ -153,15 +166,17 @@ public:
     //     /////////////////    PIN RELATED METHODS     /////////////////     //
     inlined void clr(void) {
         // Clear pin
-        clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            clrMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        }
 
         // Returns
         return;
     }
 
     inlined void cpl(void) {
-        // Toggle pin
-        cplMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        // Toggle pin (writing one to PINx, no read-modify-write)
+        *(this->_regIn) = (uint8_t)this->_pinMask;
 
         // Returns
         return;
@@ -169,7 +184,9 @@ public:
 
     inlined void set(void) {
         // Set pin
-        setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            setMask(*(this->_regOut), (uint8_t)this->_pinMask);
+        }
 
         // Returns
         return;
@@ -20,6 +20,7 @@
 #endif
 
 #include <avr/interrupt.h>
+#include <util/atomic.h>
 
 // =============================================================================
 // File exclusive - Constants
@@ -30,6 +31,7 @@ cuint32_t   constTwiBitRateMin          = 1'000;
 cuint8_t    constTwiBufferSizeMax       = 100;
 cuint8_t    constTwiBufferSizeMin       = 10;
 cuint16_t   constTwiDefaultTimeout      = 20;
+cuint16_t   constTwiStopTimeoutUs       = 1'000;    // One bit time at the lowest bit rate
 
 // =============================================================================
 // File exclusive - New data types
@@ -68,6 +70,12 @@ Twi::Twi(void)
     this->_timeout                      = constTwiDefaultTimeout;
     this->_twiError                     = 0;
     this->_useLongAddress               = false;
+    this->_asyncCallback                = nullptr;
+    this->_asyncContext                 = nullptr;
+    this->_asyncData                    = nullptr;
+    this->_asyncSize                    = 0;
+    this->_asyncRead                    = false;
+    this->_isBusClaimed                 = false;
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -121,8 +129,14 @@ bool_t Twi::read(uint8_t *buffData_p, cuint16_t buffSize_p)
             this->_lastError = Error::ARGUMENT_CANNOT_BE_ZERO;
             return false;
         }
-        // Wait last transmission ends
-        if(!this->_waitWhileIsBusy()) {
+        // Check for errors - Buffer size (address byte + data)
+        if((buffSize_p + 1) > this->_bufferMaxSize) {
+            // Returns error
+            this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+            return false;
+        }
+        // Wait last transmission ends and claims the bus
+        if(!this->_claimBus()) {
             // Returns error
             return false;
         }
@@ -133,10 +147,13 @@ bool_t Twi::read(uint8_t *buffData_p, cuint16_t buffSize_p)
         this->_startTransmission();
         if(!this->_waitWhileIsBusy()) {
             // Returns error
+            this->_releaseBus();
             return false;
         }
         // Gets data from reception buffer
-        if(!this->_readFromBuffer(buffData_p, buffSize_p)) {
+        auxBool = this->_readFromBuffer(buffData_p, buffSize_p);
+        this->_releaseBus();
+        if(!auxBool) {
             // Returns error
             return false;
         }
@@ -159,6 +176,13 @@ bool_t Twi::readReg(cuint8_t reg_p, uint8_t *buffData_p, cuint16_t buffSize_p)
         return false;
     }
 
+    // Checks for errors - Buffer size (sendData() takes an 8-bit size)
+    if(buffSize_p > 0xFF) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        return false;
+    }
+
     // Sends data
     if(this->_useLongAddress) {
         // FIXME - implement support to 10-bit address
@@ -192,6 +216,13 @@ bool_t Twi::writeReg(cuint8_t reg_p, cuint8_t *buffData_p, cuint16_t buffSize_p)
         return false;
     }
 
+    // Checks for errors - Buffer size (sendData() takes an 8-bit size)
+    if(buffSize_p > 0xFF) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        return false;
+    }
+
     // Sends data
     if(this->_useLongAddress) {
         // FIXME - implement support to 10-bit address
@@ -239,9 +270,18 @@ bool_t Twi::sendData(uint8_t devAddress_p, Operation readWrite_p, uint8_t reg_p,
         this->_lastError = Error::ARGUMENT_POINTER_NULL;
         return false;
     }
+    // Check for errors - Buffer size (address and register bytes + data)
+    if((msgSize_p + 2) > this->_bufferMaxSize) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        return false;
+    }
 
-    // Wait last transmission ends
-    if(!this->_waitWhileIsBusy()) {
+    // Wait last transmission ends and claims the bus
+    //      The bus stays claimed between the pointer write and the read, so an
+    //      asynchronous transfer started from an interrupt cannot take over
+    //      the buffer in between
+    if(!this->_claimBus()) {
         // Returns error
         return false;
     }
@@ -264,6 +304,7 @@ bool_t Twi::sendData(uint8_t devAddress_p, Operation readWrite_p, uint8_t reg_p,
         // Wait last transmission ends
         if(!this->_waitWhileIsBusy()) {
             // Returns error
+            this->_releaseBus();
             return false;
         }
         // Read data
@@ -272,14 +313,17 @@ bool_t Twi::sendData(uint8_t devAddress_p, Operation readWrite_p, uint8_t reg_p,
         this->_startTransmission();
         if(!this->_waitWhileIsBusy()) {
             // Returns error
+            this->_releaseBus();
             return false;
         }
         // Gets data from reception buffer
         if(!this->_readFromBuffer(msg_p, msgSize_p)) {
             // Returns error
+            this->_releaseBus();
             return false;
         }
     }
+    this->_releaseBus();
 
     // Returns successfully
     this->_lastError = Error::NONE;
@@ -387,12 +431,87 @@ bool_t Twi::setTimeout(cuint16_t timeout_p)
     return true;
 }
 
+uint8_t Twi::getBufferSize(void)
+{
+    // Returns buffer size
+    return this->_initialized ? (this->_bufferMaxSize - 2) : 0;
+}
+
 Error Twi::getLastError(void)
 {
     // Returns last error
     return this->_lastError;
 }
 
+bool_t Twi::startTransfer(cuint8_t devAddress_p, const Operation readWrite_p, uint8_t *msg_p, cuint8_t msgSize_p,
+        twiCallback_t callback_p, void *context_p)
+{
+    // Check for errors - NOT Initialized
+    if(!this->_initialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
+    }
+    // Check for errors - Message pointer
+    if((!isPointerValid(msg_p)) || (!isPointerValid(callback_p))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        return false;
+    }
+    // Check for errors - Message size
+    if(msgSize_p == 0) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_CANNOT_BE_ZERO;
+        return false;
+    }
+    if(msgSize_p >= this->_bufferMaxSize) {
+        // Returns error
+        this->_lastError = Error::BUFFER_SIZE_TOO_LARGE;
+        return false;
+    }
+    // Check for errors - Transfer in progress or bus claimed by a blocking
+    //      transfer; the bus is claimed here until the callback is called
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(this->_isBusClaimed || isBitSet(TWCR, TWIE)) {
+            // Returns error
+            this->_lastError = Error::NOT_READY;
+            return false;
+        }
+        this->_isBusClaimed = true;
+    }
+
+    // Wait the STOP condition of the previous transfer; counted in delays
+    //      since this may run inside an interrupt, where the stopwatch stops
+    for(uint16_t i = 0; isBitSet(TWCR, TWSTO); i++) {
+        if(i >= constTwiStopTimeoutUs) {
+            // Returns error
+            this->_isBusClaimed = false;
+            this->_lastError = Error::COMMUNICATION_TIMEOUT;
+            return false;
+        }
+        delayUs(1);
+    }
+
+    // Prepare to send data
+    this->_asyncCallback = callback_p;
+    this->_asyncContext = context_p;
+    this->_asyncData = msg_p;
+    this->_asyncSize = msgSize_p;
+    this->_asyncRead = (readWrite_p == Operation::READ);
+    this->_bufferData[0] = (devAddress_p << 1) | (uint8_t)(readWrite_p);
+    if(readWrite_p == Operation::WRITE) {
+        for(uint8_t i = 0; i < msgSize_p; i++) {
+            this->_bufferData[i + 1] = msg_p[i];
+        }
+    }
+    this->_bufferLength = msgSize_p + 1;
+    this->_startTransmission();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
 // =============================================================================
 // Class private methods
 // =============================================================================
@@ -428,6 +547,55 @@ bool_t Twi::_waitWhileIsBusy(void)
     return true;
 }
 
+bool_t Twi::_claimBus(void)
+{
+    // Local variables
+    uint32_t stopwatchMark;
+    uint32_t stopwatchDeadline;
+    bool_t auxClaimed = false;
+
+    // Evaluates stopwatch deadline
+    if(this->_timeout == 0) {
+        stopwatchDeadline = 0xFFFFFFFF;
+    } else {
+        stopwatchDeadline = 0;
+        systemStatus.getStopwatchValue(&stopwatchDeadline);
+        stopwatchDeadline += this->_timeout;
+    }
+
+    // Wait until TWI is idle and not claimed by an asynchronous transfer
+    do {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            if((!this->_isBusClaimed) && (!isBitSet(TWCR, TWIE))) {
+                this->_isBusClaimed = true;
+                auxClaimed = true;
+            }
+        }
+        if(auxClaimed) {
+            break;
+        }
+        stopwatchMark = 0;
+        systemStatus.getStopwatchValue(&stopwatchMark);
+        if(stopwatchMark > stopwatchDeadline) {
+            // Returns error
+            this->_lastError = Error::COMMUNICATION_TIMEOUT;
+            return false;
+        }
+    } while(true);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+void Twi::_releaseBus(void)
+{
+    // Releases the bus
+    this->_isBusClaimed = false;
+
+    return;
+}
+
 bool_t Twi::_startTransmission(void)
 {
     this->_lastTransOk = false;
@@ -460,6 +628,29 @@ bool_t Twi::_readFromBuffer(uint8_t *msg_p, cuint8_t msgSize_p)
     return true;
 }
 
+void Twi::_endTransfer(cbool_t success_p)
+{
+    // Local variables
+    twiCallback_t auxCallback = this->_asyncCallback;
+
+    // Blocking transfer
+    if(!isPointerValid(auxCallback)) {
+        return;
+    }
+
+    // Release before calling, so the callback can chain a new transfer
+    this->_asyncCallback = nullptr;
+    this->_isBusClaimed = false;
+    if(success_p && this->_asyncRead) {
+        for(uint8_t i = 0; i < this->_asyncSize; i++) {
+            this->_asyncData[i] = this->_bufferData[i + 1];
+        }
+    }
+    auxCallback(this->_asyncContext, success_p);
+
+    return;
+}
+
 // =============================================================================
 // Class protected methods
 // =============================================================================
@@ -494,6 +685,7 @@ void Twi::interruptHandler(void)
         } else {                        // Send STOP after last byte
             this->_lastTransOk = true;  // Set status bits to completed successfully
             TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO);
+            this->_endTransfer(true);
         }
         break;
     case Twi::State::MRX_DATA_ACK:      // Data byte has been received and ACK transmitted
@@ -509,6 +701,7 @@ void Twi::interruptHandler(void)
         this->_bufferData[twiBufferPointer] = TWDR;
         this->_lastTransOk = true;      // Set status bits to completed successfully
         TWCR = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO);
+        this->_endTransfer(true);
         break;
     case Twi::State::ARB_LOST:          // Arbitration lost
         TWCR = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWSTA);
@@ -520,6 +713,7 @@ void Twi::interruptHandler(void)
     default:
         this->_twiError = TWSR;         // Store TWSR and automatically sets clears noErrors bit
         TWCR = (1 << TWEN);             // Reset TWI Interface
+        this->_endTransfer(false);
         break;
     }
 }
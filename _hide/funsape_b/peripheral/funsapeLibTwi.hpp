@@ -65,7 +65,13 @@
 // New data types
 // =============================================================================
 
-// NONE
+//!
+//! \brief          Asynchronous transfer callback
+//! \details        Called from the TWI interrupt when a transfer started by
+//!                     \ref Twi::startTransfer() ends. A new transfer may be
+//!                     started from inside the callback.
+//!
+typedef void (*twiCallback_t)(void *context_p, cbool_t success_p);
 
 // =============================================================================
 // Interrupt callback functions
@@ -205,6 +211,18 @@ public:
             cuint8_t bufferSize_p       = 20
     );
 
+    //!
+    //! \brief      Gets the buffer size
+    //! \details    Gets the number of data bytes a single blocking transfer
+    //!                 can carry (the bufferSize_p given to init()). Larger
+    //!                 transfers fail with Error::BUFFER_SIZE_TOO_LARGE.
+    //! \return     uint8_t             Buffer size in bytes (zero if not
+    //!                                     initialized)
+    //!
+    uint8_t getBufferSize(
+            void
+    );
+
     bool_t sendData(
             uint8_t devAddress_p,
             Operation readWrite_p,
@@ -217,6 +235,32 @@ public:
             cuint16_t timeout_p
     );
 
+    //!
+    //! \brief      Starts an asynchronous transfer
+    //! \details    Starts a single transfer (START, address, data, STOP) and
+    //!                 returns immediately. There is no register byte, so
+    //!                 writes must include it at msg_p[0]. Received data is
+    //!                 copied to msg_p before the callback is called. Can be
+    //!                 called from interrupt context.
+    //! \param      devAddress_p        7-bit slave address
+    //! \param      readWrite_p         Transfer direction
+    //! \param      msg_p               Data to send or receive
+    //! \param      msgSize_p           Number of bytes
+    //! \param      callback_p          Called when the transfer ends
+    //! \param      context_p           Passed to the callback
+    //! \return     bool_t              True on success / False on failure
+    //!                                     (Error::NOT_READY if busy or
+    //!                                     claimed by a blocking transfer)
+    //!
+    bool_t startTransfer(
+            cuint8_t devAddress_p,
+            const Operation readWrite_p,
+            uint8_t *msg_p,
+            cuint8_t msgSize_p,
+            twiCallback_t callback_p,
+            void *context_p
+    );
+
     Error getLastError(
             void
     );
@@ -231,6 +275,14 @@ private:
             void
     );
 
+    bool_t _claimBus(
+            void
+    );
+
+    void _releaseBus(
+            void
+    );
+
     bool_t _startTransmission(
             void
     );
@@ -240,6 +292,10 @@ private:
             cuint8_t msgSize_p
     );
 
+    void _endTransfer(
+            cbool_t success_p
+    );
+
 protected:
     // NONE
 
@@ -267,6 +323,14 @@ private:
     uint8_t         *_bufferData;
     uint8_t         _bufferIndex                : 7;
     uint8_t         _bufferMaxSize              : 7;
+
+    //     ////////////////    ASYNCHRONOUS TRANSFER     ////////////////     //
+    twiCallback_t   _asyncCallback;
+    void            *_asyncContext;
+    uint8_t         *_asyncData;
+    uint8_t         _asyncSize;
+    bool_t          _asyncRead                  : 1;
+    vbool_t         _isBusClaimed;
 }; // class Twi
 
 // =============================================================================
@@ -43,6 +43,32 @@ Error Usart0::getLastError(void)
     return this->_lastError;
 }
 
+Bus::BusType Usart0::getBusType(void)
+{
+    // Returns bus type
+    this->_lastError = Error::NONE;
+    return (this->_isMasterSpiMode()) ? Bus::BusType::SPI : Bus::BusType::UART;
+}
+
+bool_t Usart0::sendData(uint8_t *buffData_p, cuint16_t buffSize_p)
+{
+    // Exchanges data in place
+    return this->_exchangeSpi(buffData_p, buffData_p, buffSize_p);
+}
+
+bool_t Usart0::sendData(cuint8_t *txBuffData_p, uint8_t *rxBuffData_p, cuint16_t buffSize_p)
+{
+    // Checks for errors
+    if(!isPointerValid(rxBuffData_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        return false;
+    }
+
+    // Exchanges data
+    return this->_exchangeSpi(txBuffData_p, rxBuffData_p, buffSize_p);
+}
+
 bool_t Usart0::init(void)
 {
     // Local variables
@@ -148,10 +174,22 @@ bool_t Usart0::init(void)
         break;
     }
 
+    // Master SPI mode frames are always 8 bits, MSB first
+    //      UDORD0 shares its bit with UCSZ01, which the data size set above
+    if(this->_isMasterSpiMode()) {
+        clrBit(ucsr0b, UCSZ02);
+        clrBit(ucsr0c, UDORD0);
+    }
+
     // Configure baud rate
     systemStatus.getCpuClock(&aux32);
     ubrr0 = (aux32 / (auxPrescaler * (uint32_t)this->_baudRate) - 1);
 
+    // Configures XCK0 as clock output (required by master SPI mode)
+    if(this->_isMasterSpiMode()) {
+        setBit(DDRD, PD4);
+    }
+
     // Configures USART registers
     UCSR0A = ucsr0a;
     UCSR0B = ucsr0b;
@@ -535,6 +573,67 @@ int16_t Usart0::sendDataStd(char data_p, FILE *stream_p)
     return 0;
 }
 
+bool_t Usart0::_exchangeSpi(cuint8_t *txBuffData_p, uint8_t *rxBuffData_p, cuint16_t buffSize_p)
+{
+    // Checks initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
+    }
+
+    // Checks mode
+    if(!this->_isMasterSpiMode()) {
+        // Returns error
+        this->_lastError = Error::MODE_NOT_SUPPORTED;
+        return false;
+    }
+
+    // Checks for errors
+    if(!isPointerValid(txBuffData_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        return false;
+    }
+
+    // Checks transmitter and receiver
+    //      In MSPIM the received frame is the only completion flag, so the
+    //      receiver must be enabled even when the received bytes are discarded
+    if(!(isBitSet(UCSR0B, TXEN0) && isBitSet(UCSR0B, RXEN0))) {
+        // Returns error
+        this->_lastError = Error::DEVICE_DISABLED;
+        return false;
+    }
+
+    // Discards stale received data
+    this->flushReceptionBuffer();
+
+    // Exchanges data
+    for(uint16_t i = 0; i < buffSize_p; i++) {
+        waitUntilBitIsSet(UCSR0A, UDRE0);
+        UDR0 = txBuffData_p[i];
+        waitUntilBitIsSet(UCSR0A, RXC0);
+        rxBuffData_p[i] = UDR0;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+bool_t Usart0::_isMasterSpiMode(void)
+{
+    switch(this->_mode) {
+    case Usart0::Mode::MASTER_SPI_MODE_0:
+    case Usart0::Mode::MASTER_SPI_MODE_1:
+    case Usart0::Mode::MASTER_SPI_MODE_2:
+    case Usart0::Mode::MASTER_SPI_MODE_3:
+        return true;
+    default:
+        return false;
+    }
+}
+
 int usartTransmitStdWrapper(char c, FILE *f)
 {
     return usartDefaultHandler->sendDataStd(c, f);
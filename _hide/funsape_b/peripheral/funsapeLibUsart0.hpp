@@ -36,6 +36,13 @@
 #   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
 #endif
 
+#include "../util/funsapeLibBus.hpp"
+#if !defined(__FUNSAPE_LIB_BUS_HPP)
+#   error "Header file (funsapeLibBus.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_BUS_HPP != __FUNSAPE_LIB_USART0_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibBus.hpp)!"
+#endif
+
 #include "../util/funsapeLibSystemStatus.hpp"
 #if !defined(__FUNSAPE_LIB_SYSTEM_STATUS_HPP)
 #   error "Header file (funsapeLibSystemStatus.hpp) is corrupted!"
@@ -135,8 +142,12 @@ void usartTransmissionCompleteCallback(void);
 //! \warning        An instance of this class is already defined as a global
 //!                     object. Therefore, there is not necessary, neither
 //!                     recommended to create another object of this class.
+//! \note           When initialized in one of the master SPI modes, the object
+//!                     can be used as an SPI \ref Bus, exchanging 8-bit frames
+//!                     MSB first. The slave select pin must be driven by the
+//!                     device driver.
 //!
-class Usart0
+class Usart0 : public Bus
 {
     // -------------------------------------------------------------------------
     // New data types ----------------------------------------------------------
@@ -336,6 +347,36 @@ public:
             void
     );
 
+    // -------------------------------------------------------------------------
+    // Methods - Inherited methods ---------------------------------------------
+public:
+    //     /////////////////     CONTROL AND STATUS     /////////////////     //
+    Bus::BusType getBusType(
+            void
+    );
+
+    //     ////////////////////    DATA TRANSFER     ////////////////////     //
+    //!
+    //! \brief      Exchanges data in master SPI mode.
+    //! \details    Each byte of the data vector is transmitted and replaced by
+    //!                 the byte received in the same frame. Fails with
+    //!                 Error::MODE_NOT_SUPPORTED outside the master SPI modes.
+    //! \param[in,out] buffData_p      pointer to data vector to exchange
+    //! \param[in]  buffSize_p          number of data elements to exchange
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t sendData(
+            uint8_t *buffData_p,
+            cuint16_t buffSize_p
+    );
+    bool_t sendData(
+            cuint8_t *txBuffData_p,
+            uint8_t *rxBuffData_p,
+            cuint16_t buffSize_p
+    );
+
     // -------------------------------------------------------------------------
     // Methods -----------------------------------------------------------------
 public:
@@ -598,6 +639,8 @@ public:
     );
 
 private:
+    bool_t _exchangeSpi(cuint8_t *txBuffData_p, uint8_t *rxBuffData_p, cuint16_t buffSize_p);
+    bool_t _isMasterSpiMode(void);
     char _receiveDataStd(FILE *stream_p);
     void _clearDataOverrunError(void);
     void _clearFrameError(void);
@@ -0,0 +1,43 @@
+//!
+//! \file           funsapeLibGlobalDefines.hpp
+//! \brief          Host bridge to the library global definitions file
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        The 24.07 global definitions file is not part of this
+//!                     repository. This file defines no types or error codes
+//!                     of its own: it includes the repository global
+//!                     definitions file (funsape/globalDefines.hpp), so the
+//!                     harness is built with the real bool_t, Error and helper
+//!                     definitions, and only adds the include guard checked by
+//!                     the 24.07 modules. It is found through the
+//!                     "../funsapeLibGlobalDefines.hpp" include of the library
+//!                     files when host/include is in the include path.
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_GLOBAL_DEFINES_HPP
+#define __FUNSAPE_LIB_GLOBAL_DEFINES_HPP        2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+#include "../../../../../funsape/globalDefines.hpp"
+#if !defined(__GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#endif
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __FUNSAPE_LIB_GLOBAL_DEFINES_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,5 @@
+// Host replacement of <avr/interrupt.h>; the host has no interrupts
+#pragma once
+
+inline void cli(void) {}
+inline void sei(void) {}
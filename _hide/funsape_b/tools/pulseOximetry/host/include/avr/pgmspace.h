@@ -0,0 +1,2 @@
+// Host replacement of <avr/pgmspace.h>; nothing from it is used on the host
+#pragma once
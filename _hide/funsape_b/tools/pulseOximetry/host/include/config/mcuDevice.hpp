@@ -0,0 +1,10 @@
+//!
+//! \file           mcuDevice.hpp
+//! \brief          Host replacement of the MCU device configuration
+//! \details        The host harness has no target device; only the include
+//!                     guard checked by globalDefines.hpp is defined.
+//!
+
+#ifndef __MCU_DEVICE_HPP
+#define __MCU_DEVICE_HPP                        2512
+#endif  // __MCU_DEVICE_HPP
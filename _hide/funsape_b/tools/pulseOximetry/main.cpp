@@ -0,0 +1,217 @@
+//!
+//! \file           main.cpp
+//! \brief          Host validation harness for the PulseOximetry module
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Feeds red/infrared recordings through
+//!                     PulseOximetry::addSample() and checks the final heart
+//!                     rate and SpO2 against the reference values stored in
+//!                     each recording. Returns a non-zero exit code if any
+//!                     recording fails.
+//!
+//!                 Recording format (CSV):
+//! \code
+//!                 # rate=100
+//!                 # heart_rate=72
+//!                 # spo2=98
+//!                 red,infrared
+//!                 81234,101456
+//!                 ...
+//! \endcode
+//!                 Lines starting with '#' hold the "key=value" parameters;
+//!                     rate is the sample rate given to init() (50, 100, 200
+//!                     or 400). Lines that do not start with a number are
+//!                     ignored.
+//!                 The recordings shipped in the recordings directory are
+//!                     synthetic (pulse waveform with heart rate variability,
+//!                     respiration baseline wander and noise, with a known
+//!                     ratio of ratios); their first line lists the signal
+//!                     parameters. Passing them only shows that the estimator
+//!                     agrees with the signal model, not with a sensor: no
+//!                     MAX30102 capture with a reference oximeter reading is
+//!                     available yet. Such captures must be added next to
+//!                     them, in the same format, before the thresholds are
+//!                     trusted. Build and run with "make".
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "../../util/funsapeLibPulseOximetry.hpp"
+#if !defined(__FUNSAPE_LIB_PULSE_OXIMETRY_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_PULSE_OXIMETRY_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+cuint8_t    constHeartRateTolerance     = 3;        // Beats per minute
+cuint8_t    constSpo2Tolerance          = 2;        // Percent
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+struct Recording {
+    uint16_t    sampleRate;
+    int16_t     heartRate;
+    int16_t     spo2;
+    uint32_t    samplesCount;
+    uint32_t    beatsCount;
+};
+
+// =============================================================================
+// Static functions declarations
+// =============================================================================
+
+static bool_t runRecording(const char *fileName_p, Recording *recording_p, uint8_t *heartRate_p, uint8_t *spo2_p);
+static bool_t decodeSampleRate(cuint16_t rate_p, PulseOximetry::SampleRate *sampleRate_p);
+
+// =============================================================================
+// Main function
+// =============================================================================
+
+int main(int argc, char *argv[])
+{
+    // Local variables
+    Recording recording;
+    uint8_t heartRate;
+    uint8_t spo2;
+    uint16_t failCount = 0;
+
+    if(argc < 2) {
+        fprintf(stderr, "Usage: %s recording.csv [recording.csv ...]\n", argv[0]);
+        return 2;
+    }
+
+    for(int i = 1; i < argc; i++) {
+        heartRate = 0;
+        spo2 = 0;
+        if(!runRecording(argv[i], &recording, &heartRate, &spo2)) {
+            printf("FAIL  %s: could not be processed\n", argv[i]);
+            failCount++;
+            continue;
+        }
+
+        bool_t heartRateOk = (abs((int16_t)heartRate - recording.heartRate) <= constHeartRateTolerance);
+        bool_t spo2Ok = (abs((int16_t)spo2 - recording.spo2) <= constSpo2Tolerance);
+        printf("%s  %s: %u samples, %u beats, HR %u bpm (ref %d), SpO2 %u %% (ref %d)\n",
+                (heartRateOk && spo2Ok) ? "PASS" : "FAIL", argv[i],
+                (unsigned)recording.samplesCount, (unsigned)recording.beatsCount,
+                heartRate, recording.heartRate, spo2, recording.spo2);
+        if(!(heartRateOk && spo2Ok)) {
+            failCount++;
+        }
+    }
+
+    printf("%u of %d recordings failed\n", failCount, argc - 1);
+    return (failCount == 0) ? 0 : 1;
+}
+
+// =============================================================================
+// Static functions definitions
+// =============================================================================
+
+static bool_t runRecording(const char *fileName_p, Recording *recording_p, uint8_t *heartRate_p, uint8_t *spo2_p)
+{
+    // Local variables
+    FILE *file;
+    char line[128];
+    unsigned long red;
+    unsigned long infrared;
+    unsigned value;
+    bool_t beat;
+    PulseOximetry oximeter;
+    PulseOximetry::SampleRate sampleRate;
+
+    // Reset recording
+    recording_p->sampleRate = 0;
+    recording_p->heartRate = -1;
+    recording_p->spo2 = -1;
+    recording_p->samplesCount = 0;
+    recording_p->beatsCount = 0;
+
+    file = fopen(fileName_p, "r");
+    if(!isPointerValid(file)) {
+        return false;
+    }
+
+    while(fgets(line, sizeof(line), file)) {
+        // Parameters
+        if(line[0] == '#') {
+            if(sscanf(line, "# rate=%u", &value) == 1) {
+                recording_p->sampleRate = (uint16_t)value;
+                if(!decodeSampleRate(recording_p->sampleRate, &sampleRate) || !oximeter.init(sampleRate)) {
+                    fclose(file);
+                    return false;
+                }
+            } else if(sscanf(line, "# heart_rate=%u", &value) == 1) {
+                recording_p->heartRate = (int16_t)value;
+            } else if(sscanf(line, "# spo2=%u", &value) == 1) {
+                recording_p->spo2 = (int16_t)value;
+            }
+            continue;
+        }
+
+        // Samples
+        if(sscanf(line, "%lu,%lu", &red, &infrared) != 2) {
+            continue;
+        }
+        if(!oximeter.addSample((uint32_t)red, (uint32_t)infrared, &beat)) {
+            fclose(file);
+            return false;
+        }
+        recording_p->samplesCount++;
+        recording_p->beatsCount += beat ? 1 : 0;
+    }
+    fclose(file);
+
+    // Missing parameters
+    if((recording_p->sampleRate == 0) || (recording_p->heartRate < 0) || (recording_p->spo2 < 0)) {
+        return false;
+    }
+
+    // Results; a missing estimate is reported as zero
+    if(!oximeter.getHeartRate(heartRate_p)) {
+        *heartRate_p = 0;
+    }
+    if(!oximeter.getSpo2(spo2_p)) {
+        *spo2_p = 0;
+    }
+
+    return true;
+}
+
+static bool_t decodeSampleRate(cuint16_t rate_p, PulseOximetry::SampleRate *sampleRate_p)
+{
+    switch(rate_p) {
+    case 50:
+        *sampleRate_p = PulseOximetry::SampleRate::RATE_50_HZ;
+        return true;
+    case 100:
+        *sampleRate_p = PulseOximetry::SampleRate::RATE_100_HZ;
+        return true;
+    case 200:
+        *sampleRate_p = PulseOximetry::SampleRate::RATE_200_HZ;
+        return true;
+    case 400:
+        *sampleRate_p = PulseOximetry::SampleRate::RATE_400_HZ;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
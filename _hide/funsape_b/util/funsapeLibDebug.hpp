@@ -133,6 +133,8 @@ public:
         ADS1115_MODULE                  = 11,
         MAX30102_MODULE                 = 12,
         NUNCHUK_MODULE                  = 13,
+        ROTARY_ENCODER_MODULE           = 14,
+        AHT21_MODULE                    = 15,
     };
 };
 
@@ -0,0 +1,612 @@
+//!
+//! \file           funsapeLibInputCapture.cpp
+//! \brief          Frequency and period measurement for the FunSAPE AVR8
+//!                     Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Frequency and period measurement for the FunSAPE AVR8
+//!                     Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibInputCapture.hpp"
+#if !defined(__FUNSAPE_LIB_INPUT_CAPTURE_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_INPUT_CAPTURE_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <util/atomic.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_INPUT_CAPTURE             0x3DFF
+
+cuint8_t constEdgeIndexMask             = (INPUT_CAPTURE_BUFFER_SIZE - 1);  //!< Ring index mask
+cuint32_t constLowPrescaler             = 64;                           //!< Prescaler of the LOW_FREQUENCY range
+cuint32_t constMidToHighCounts          = (4UL * INPUT_CAPTURE_HANDLER_CYCLES);    //!< Two captures per period, using at most half of the CPU
+cuint32_t constHighToMidFrequency       = (F_CPU / (2UL * constMidToHighCounts));  //!< Half of the MID to HIGH frequency
+cuint8_t constMissedEdgesLimit          = 4;                            //!< Missed edges tolerated between two valid periods
+cuint32_t constMidToLowCounts           = (F_CPU / 60UL);               //!< Below 60 Hz, use prescaler 64
+cuint32_t constLowToMidCounts           = (F_CPU / (constLowPrescaler * 120UL));   //!< Above 120 Hz, use prescaler 1
+
+// Nanoseconds per timer count, as reduced fractions, so _countsToNs() needs
+// no 64-bit math (e.g. 125/2 and 4000/1 at 16 MHz)
+static constexpr uint64_t inputCaptureGcd(uint64_t a_p, uint64_t b_p)
+{
+    return (b_p == 0) ? a_p : inputCaptureGcd(b_p, a_p % b_p);
+}
+cuint32_t constMidNsNumerator           = (uint32_t)(1000000000ULL / inputCaptureGcd(1000000000ULL, F_CPU));
+cuint32_t constMidNsDenominator         = (uint32_t)(F_CPU / inputCaptureGcd(1000000000ULL, F_CPU));
+cuint32_t constLowNsNumerator           = (uint32_t)((constLowPrescaler * 1000000000ULL) / inputCaptureGcd(constLowPrescaler * 1000000000ULL, F_CPU));
+cuint32_t constLowNsDenominator         = (uint32_t)(F_CPU / inputCaptureGcd(constLowPrescaler * 1000000000ULL, F_CPU));
+static_assert(((uint64_t)constMidNsNumerator * constMidNsDenominator) <= 0xFFFFFFFFULL, "F_CPU not supported by InputCapture::_countsToNs()");
+static_assert(((uint64_t)constLowNsNumerator * constLowNsDenominator) <= 0xFFFFFFFFULL, "F_CPU not supported by InputCapture::_countsToNs()");
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+InputCapture inputCapture;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+InputCapture::InputCapture()
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::InputCapture(void)", DEBUG_INPUT_CAPTURE);
+
+    // Reset data members
+    for(uint8_t i = 0; i < INPUT_CAPTURE_BUFFER_SIZE; i++) {
+        this->_edgeTime[i]              = 0;
+    }
+    this->_edgeRisingMask               = 0;
+    this->_edgeHead                     = 0;
+    this->_edgeCount                    = 0;
+    this->_overflows                    = 0;
+    this->_gateStart                    = 0;
+    this->_gateCount                    = 0;
+    this->_gateTicks                    = 0;
+    this->_ticksSinceEdge               = 0;
+    this->_missedEdges                  = 0;
+    this->_handlerCycles                = 0;
+    this->_range                        = Range::MID_FREQUENCY;
+    this->_edgeCountingEnabled          = false;
+    this->_noiseCanceler                = false;
+    this->_isDataReady                  = false;
+    this->_isInitialized                = false;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return;
+}
+
+InputCapture::~InputCapture()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ///////////////////     INITIALIZATION    ////////////////////     //
+bool_t InputCapture::init(cbool_t edgeCounting_p, cbool_t noiseCanceler_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::init(cbool_t, cbool_t)", DEBUG_INPUT_CAPTURE);
+
+    // Configure TIMER1
+    if(!timer1.init(Timer1::Mode::NORMAL, Timer1::ClockSource::PRESCALER_1)) {
+        // Returns error
+        this->_isInitialized = false;
+        this->_lastError = timer1.getLastError();
+        debugMessage(this->_lastError, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+
+    // Update data members
+    this->_edgeCountingEnabled          = edgeCounting_p;
+    this->_noiseCanceler                = noiseCanceler_p;
+
+    // Start measuring
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_setRange(Range::MID_FREQUENCY);
+        timer1.activateOverflowInterrupt();
+        this->_isInitialized            = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return true;
+}
+
+//     /////////////////////     RESULTS     ///////////////////////     //
+bool_t InputCapture::getFrequency(uint32_t *frequency_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::getFrequency(uint32_t *)", DEBUG_INPUT_CAPTURE);
+
+    // Local variables
+    uint32_t period = 0;
+    uint32_t high = 0;
+    uint32_t gateCount = 0;
+    uint32_t timerClock = F_CPU;
+
+    // Checks for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if(!isPointerValid(frequency_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if(!this->_isDataReady) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+
+    // Evaluate frequency
+    if(this->_range == Range::HIGH_FREQUENCY) {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            gateCount = this->_gateCount;
+        }
+        *frequency_p = (gateCount * INPUT_CAPTURE_GATE_FREQUENCY) / INPUT_CAPTURE_GATE_TICKS;
+    } else {
+        if(!this->_getCaptureCounts(&period, &high)) {
+            // Returns error
+            this->_lastError = Error::NOT_READY;
+            debugMessage(Error::NOT_READY, DEBUG_INPUT_CAPTURE);
+            return false;
+        }
+        if(this->_range == Range::LOW_FREQUENCY) {
+            timerClock = F_CPU / constLowPrescaler;
+        }
+        *frequency_p = (timerClock + (period / 2)) / period;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return true;
+}
+
+bool_t InputCapture::getPeriod(uint32_t *period_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::getPeriod(uint32_t *)", DEBUG_INPUT_CAPTURE);
+
+    // Local variables
+    uint32_t period = 0;
+    uint32_t high = 0;
+
+    // Checks for errors
+    if(!isPointerValid(period_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+
+    // Evaluate period
+    if(this->_range == Range::HIGH_FREQUENCY) {
+        if(!this->getFrequency(&period)) {
+            // Returns error
+            debugMessage(this->_lastError, DEBUG_INPUT_CAPTURE);
+            return false;
+        }
+        if(period == 0) {
+            // Returns error
+            this->_lastError = Error::NOT_READY;
+            debugMessage(Error::NOT_READY, DEBUG_INPUT_CAPTURE);
+            return false;
+        }
+        *period_p = 1000000000UL / period;
+    } else {
+        if((!this->_isInitialized) || (!this->_isDataReady) || (!this->_getCaptureCounts(&period, &high))) {
+            // Returns error
+            this->_lastError = (this->_isInitialized) ? Error::NOT_READY : Error::NOT_INITIALIZED;
+            debugMessage(this->_lastError, DEBUG_INPUT_CAPTURE);
+            return false;
+        }
+        *period_p = this->_countsToNs(period);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return true;
+}
+
+bool_t InputCapture::getPulseWidth(uint32_t *pulseWidth_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::getPulseWidth(uint32_t *)", DEBUG_INPUT_CAPTURE);
+
+    // Local variables
+    uint32_t period = 0;
+    uint32_t high = 0;
+
+    // Checks for errors
+    if(!isPointerValid(pulseWidth_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if(this->_range == Range::HIGH_FREQUENCY) {
+        // Returns error
+        this->_lastError = Error::FEATURE_NOT_SUPPORTED;
+        debugMessage(Error::FEATURE_NOT_SUPPORTED, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if((!this->_isInitialized) || (!this->_isDataReady) || (!this->_getCaptureCounts(&period, &high))) {
+        // Returns error
+        this->_lastError = (this->_isInitialized) ? Error::NOT_READY : Error::NOT_INITIALIZED;
+        debugMessage(this->_lastError, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+
+    // Evaluate pulse width
+    *pulseWidth_p = this->_countsToNs(high);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return true;
+}
+
+bool_t InputCapture::getDutyCycle(uint16_t *dutyCycle_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("InputCapture::getDutyCycle(uint16_t *)", DEBUG_INPUT_CAPTURE);
+
+    // Local variables
+    uint32_t period = 0;
+    uint32_t high = 0;
+
+    // Checks for errors
+    if(!isPointerValid(dutyCycle_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if(this->_range == Range::HIGH_FREQUENCY) {
+        // Returns error
+        this->_lastError = Error::FEATURE_NOT_SUPPORTED;
+        debugMessage(Error::FEATURE_NOT_SUPPORTED, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+    if((!this->_isInitialized) || (!this->_isDataReady) || (!this->_getCaptureCounts(&period, &high))) {
+        // Returns error
+        this->_lastError = (this->_isInitialized) ? Error::NOT_READY : Error::NOT_INITIALIZED;
+        debugMessage(this->_lastError, DEBUG_INPUT_CAPTURE);
+        return false;
+    }
+
+    // Evaluate duty cycle; both counts are scaled down until high * 1000
+    // fits in 32 bits (high <= period), instead of using 64-bit division
+    while(period > (0xFFFFFFFFUL / 1000)) {
+        period >>= 1;
+        high >>= 1;
+    }
+    *dutyCycle_p = (uint16_t)(((high * 1000) + (period / 2)) / period);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_INPUT_CAPTURE);
+    return true;
+}
+
+//     //////////////////////     INTERRUPT     //////////////////////     //
+void InputCapture::captureHandler(void)
+{
+    // Local variables
+    uint16_t capture = ICR1;
+    uint32_t overflows = this->_overflows;
+    uint8_t head = this->_edgeHead;
+    bool_t rising = isBitSet(TCCR1B, ICES1);
+    Range range = this->_range;
+    uint32_t period;
+    uint32_t high;
+    uint16_t cycles;
+
+    // Capture happened after a pending (not serviced yet) overflow
+    if(isBitSet(TIFR1, TOV1) && (capture < 0x8000)) {
+        overflows++;
+    }
+
+    // Capture the opposite edge next; ICF1 must be cleared after changing
+    // ICES1 (written directly, a read-modify-write would also clear TOV1)
+    TCCR1B ^= (1 << ICES1);
+    TIFR1 = (1 << ICF1);
+
+    // Edge parity check: if ICP1 (PB0) is already at the level that follows
+    // the opposite edge and that edge was not captured after re-arming, it
+    // happened while this handler was late and was missed. The sequence is
+    // dropped and restarts at the next rising edge, instead of measuring a
+    // period of 2T.
+    if((isBitSet(PINB, PB0) != rising) && !isBitSet(TIFR1, ICF1)) {
+        setBit(TCCR1B, ICES1);
+        TIFR1 = (1 << ICF1);
+        this->_edgeCount = 0;
+        if(this->_missedEdges < constMissedEdgesLimit) {
+            this->_missedEdges++;
+        } else if(this->_range == Range::MID_FREQUENCY) {
+            // Signal too fast to be captured
+            if(this->_edgeCountingEnabled) {
+                this->_setRange(Range::HIGH_FREQUENCY);
+            } else {
+                this->_isDataReady = false;
+            }
+        }
+        return;
+    }
+
+    // Store edge
+    this->_edgeTime[head] = (overflows << 16) | capture;
+    if(rising) {
+        setBit(this->_edgeRisingMask, head);
+    } else {
+        clrBit(this->_edgeRisingMask, head);
+    }
+    this->_edgeHead = (head + 1) & constEdgeIndexMask;
+    if(this->_edgeCount < INPUT_CAPTURE_BUFFER_SIZE) {
+        this->_edgeCount++;
+    }
+    this->_ticksSinceEdge = 0;
+
+    // Automatic ranging, once per complete period
+    if(rising && this->_getCaptureCounts(&period, &high)) {
+        this->_isDataReady = true;
+        this->_missedEdges = 0;
+        if(this->_range == Range::MID_FREQUENCY) {
+            if((period < constMidToHighCounts) && (this->_edgeCountingEnabled)) {
+                this->_setRange(Range::HIGH_FREQUENCY);
+            } else if(period > constMidToLowCounts) {
+                this->_setRange(Range::LOW_FREQUENCY);
+            }
+        } else if(period < constLowToMidCounts) {
+            this->_setRange(Range::MID_FREQUENCY);
+        }
+    }
+
+    // Handler cost; in the MID range TIMER1 counts CPU cycles, unless the
+    // range was just changed (TCNT1 cleared)
+    if((range == Range::MID_FREQUENCY) && (this->_range == Range::MID_FREQUENCY)) {
+        cycles = TCNT1 - capture;
+        if(cycles > this->_handlerCycles) {
+            this->_handlerCycles = cycles;
+        }
+    }
+
+    return;
+}
+
+void InputCapture::gateHandler(void)
+{
+    // Local variables
+    uint32_t counter;
+
+    if(!this->_isInitialized) {
+        return;
+    }
+
+    if(this->_range == Range::HIGH_FREQUENCY) {
+        // Edge counting - closes the gate
+        this->_gateTicks++;
+        if(this->_gateTicks >= INPUT_CAPTURE_GATE_TICKS) {
+            counter = this->_readCounter();
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                this->_gateCount        = counter - this->_gateStart;
+                this->_isDataReady      = true;
+                if(((this->_gateCount * INPUT_CAPTURE_GATE_FREQUENCY) / INPUT_CAPTURE_GATE_TICKS) < constHighToMidFrequency) {
+                    this->_setRange(Range::MID_FREQUENCY);
+                }
+            }
+            this->_gateStart            = counter;
+            this->_gateTicks            = 0;
+        }
+    } else {
+        // Input capture - signal loss detection
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            if(this->_ticksSinceEdge < INPUT_CAPTURE_TIMEOUT_TICKS) {
+                this->_ticksSinceEdge++;
+            } else {
+                this->_isDataReady      = false;
+            }
+        }
+    }
+
+    return;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error InputCapture::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+void InputCapture::_setRange(const Range range_p)
+{
+    // Must be called with interrupts disabled
+    timer1.deactivateInputCaptureInterrupt();
+    switch(range_p) {
+    case Range::LOW_FREQUENCY:
+        timer1.setClockSource(Timer1::ClockSource::PRESCALER_64);
+        break;
+    case Range::HIGH_FREQUENCY:
+        timer1.setClockSource(Timer1::ClockSource::T1_RISING_EDGE);
+        break;
+    case Range::MID_FREQUENCY:
+    default:
+        timer1.setClockSource(Timer1::ClockSource::PRESCALER_1);
+        break;
+    }
+    timer1.setInputCaptureMode(Edge::RISING, this->_noiseCanceler);
+    TCNT1 = 0;
+    TIFR1 = (1 << ICF1) | (1 << TOV1);
+
+    // Reset measurement
+    this->_overflows                    = 0;
+    this->_edgeHead                     = 0;
+    this->_edgeCount                    = 0;
+    this->_edgeRisingMask               = 0;
+    this->_gateStart                    = 0;
+    this->_gateCount                    = 0;
+    this->_gateTicks                    = 0;
+    this->_ticksSinceEdge               = 0;
+    this->_missedEdges                  = 0;
+    this->_isDataReady                  = false;
+    this->_range                        = range_p;
+
+    if(range_p != Range::HIGH_FREQUENCY) {
+        timer1.activateInputCaptureInterrupt();
+    }
+
+    return;
+}
+
+uint32_t InputCapture::_readCounter(void)
+{
+    // Local variables
+    uint32_t overflows;
+    uint16_t counter;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        overflows = this->_overflows;
+        counter = TCNT1;
+        if(isBitSet(TIFR1, TOV1) && (counter < 0x8000)) {
+            overflows++;
+        }
+    }
+
+    return ((overflows << 16) | counter);
+}
+
+bool_t InputCapture::_getCaptureCounts(uint32_t *period_p, uint32_t *high_p)
+{
+    // Local variables
+    bool_t result = false;
+    uint8_t count;
+    uint8_t risingMask;
+    uint8_t rising1;
+    uint8_t falling;
+    uint8_t rising0;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        count = this->_edgeCount;
+        risingMask = this->_edgeRisingMask;
+        // Newest rising edge
+        rising1 = (this->_edgeHead - 1) & constEdgeIndexMask;
+        if(!isBitSet(risingMask, rising1)) {
+            rising1 = (rising1 - 1) & constEdgeIndexMask;
+            count = (count > 0) ? (count - 1) : 0;
+        }
+        falling = (rising1 - 1) & constEdgeIndexMask;
+        rising0 = (falling - 1) & constEdgeIndexMask;
+        // Needs rising - falling - rising sequence
+        if((count >= 3) && isBitSet(risingMask, rising1) && (!isBitSet(risingMask, falling)) &&
+                isBitSet(risingMask, rising0)) {
+            *period_p = this->_edgeTime[rising1] - this->_edgeTime[rising0];
+            *high_p = this->_edgeTime[falling] - this->_edgeTime[rising0];
+            result = (*period_p != 0);
+        }
+    }
+
+    return result;
+}
+
+uint32_t InputCapture::_countsToNs(cuint32_t counts_p)
+{
+    // Local variables
+    uint32_t numerator = constMidNsNumerator;
+    uint32_t denominator = constMidNsDenominator;
+    uint32_t quotient;
+    uint32_t remainder;
+
+    if(this->_range == Range::LOW_FREQUENCY) {
+        numerator = constLowNsNumerator;
+        denominator = constLowNsDenominator;
+    }
+
+    // counts * numerator / denominator, split so that no product overflows
+    quotient = counts_p / denominator;
+    remainder = counts_p % denominator;
+    if(quotient > ((0xFFFFFFFFUL - ((remainder * numerator) / denominator)) / numerator)) {
+        return 0xFFFFFFFFUL;
+    }
+
+    return (quotient * numerator) + ((remainder * numerator) / denominator);
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,496 @@
+//!
+//! \file           funsapeLibInputCapture.hpp
+//! \brief          Frequency and period measurement for the FunSAPE AVR8
+//!                     Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a measurement engine built on TIMER1.
+//!                     Signal edges are timestamped by the input capture unit
+//!                     (ICP1 pin) into a small ring, extended across counter
+//!                     overflows. Period, frequency, pulse width and duty
+//!                     cycle are computed on demand from the last edges. For
+//!                     signals faster than the capture interrupt can follow,
+//!                     the engine switches to counting edges at the T1 pin
+//!                     over a fixed gate time.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_INPUT_CAPTURE_HPP
+#define __FUNSAPE_LIB_INPUT_CAPTURE_HPP         2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_INPUT_CAPTURE_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_INPUT_CAPTURE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer1.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER1_HPP)
+#   error "Header file (funsapeLibTimer1.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER1_HPP != __FUNSAPE_LIB_INPUT_CAPTURE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer1.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Input_Capture"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Input_Capture
+//! \brief          Frequency and period measurement.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef INPUT_CAPTURE_BUFFER_SIZE
+//!
+//! \brief          Number of edges kept in the ring.
+//! \details        Number of edges kept in the ring. Must be a power of two
+//!                     between 4 and 8.
+//!
+#   define INPUT_CAPTURE_BUFFER_SIZE            4
+#endif
+
+#ifndef INPUT_CAPTURE_GATE_FREQUENCY
+//!
+//! \brief          Calling frequency of gateHandler(), in Hz.
+//! \details        Calling frequency of \ref InputCapture::gateHandler(), in
+//!                     Hz. Usually the SoftTimer tick frequency.
+//!
+#   define INPUT_CAPTURE_GATE_FREQUENCY         1000UL
+#endif
+
+#ifndef INPUT_CAPTURE_GATE_TICKS
+//!
+//! \brief          Gate time of the edge counting range, in gate ticks.
+//! \details        Gate time of the edge counting range, in calls to
+//!                     \ref InputCapture::gateHandler(). The default value
+//!                     gives a 100 ms gate and a 10 Hz resolution.
+//!
+#   define INPUT_CAPTURE_GATE_TICKS             100
+#endif
+
+#ifndef INPUT_CAPTURE_TIMEOUT_TICKS
+//!
+//! \brief          Signal loss timeout, in gate ticks.
+//! \details        If no edge is captured during this time, the measurement
+//!                     is invalidated. Must be longer than the slowest period
+//!                     to be measured.
+//!
+#   define INPUT_CAPTURE_TIMEOUT_TICKS          2000
+#endif
+
+#ifndef INPUT_CAPTURE_HANDLER_CYCLES
+//!
+//! \brief          Worst case cost of one capture interrupt, in CPU cycles.
+//! \details        Worst case cost of one capture interrupt, in CPU cycles,
+//!                     including the vector, the ISR prologue and epilogue
+//!                     and \ref InputCapture::captureHandler(). The
+//!                     MID_FREQUENCY range is left for periods shorter than
+//!                     four times this value.
+//!                 The default is an estimate that has not been measured. On
+//!                     the target, feed a signal in the MID_FREQUENCY range,
+//!                     read \ref InputCapture::getHandlerCycles() and define
+//!                     this value as the result plus the ISR epilogue (see
+//!                     the listing file). A value that is too small is not
+//!                     fatal: when edges are missed, the handler switches to
+//!                     the HIGH_FREQUENCY range by itself.
+//!
+#   define INPUT_CAPTURE_HANDLER_CYCLES         400
+#endif
+
+#if (INPUT_CAPTURE_BUFFER_SIZE != 4) && (INPUT_CAPTURE_BUFFER_SIZE != 8)
+#   error "INPUT_CAPTURE_BUFFER_SIZE must be 4 or 8!"
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// InputCapture Class
+// =============================================================================
+
+//!
+//! \brief          InputCapture class.
+//! \details        This class measures a digital signal using TIMER1. The
+//!                     interrupt callbacks must be forwarded to the engine:
+//! \code
+//!                 void timer1InputCaptureCallback(void)
+//!                 {
+//!                     inputCapture.captureHandler();
+//!                 }
+//!                 void timer1OverflowCallback(void)
+//!                 {
+//!                     inputCapture.overflowHandler();
+//!                 }
+//! \endcode
+//!                 and \ref gateHandler() must be called at
+//!                     \ref INPUT_CAPTURE_GATE_FREQUENCY (e.g., from a
+//!                     periodic ISR context SoftTimer).
+//! \warning        The engine takes TIMER1 over; TIMER1 PWM, sound and the
+//!                     timestamp service cannot be used at the same time.
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class InputCapture
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+
+    //     ///////////////////////     RANGE     ////////////////////////     //
+    //!
+    //! \brief      Measurement range enumeration.
+    //! \details    Measurement range selected by the automatic ranging. With
+    //!                 F_CPU = 16 MHz, the LOW range is used below ~60 Hz,
+    //!                 the HIGH range above ~10 kHz (see \ref
+    //!                 INPUT_CAPTURE_HANDLER_CYCLES).
+    //! \warning    The value associate with the symbolic names may change
+    //!                 between builds and might not reflect the register/bits
+    //!                 real values. In order to ensure compatibility between
+    //!                 builds, always refer to the SYMBOLIC NAME, instead of
+    //!                 the VALUE.
+    //!
+    enum class Range : uint8_t {
+        LOW_FREQUENCY                   = 0,    //!< Input capture, prescaler 64.
+        MID_FREQUENCY                   = 1,    //!< Input capture, prescaler 1.
+        HIGH_FREQUENCY                  = 2,    //!< Edge counting at T1 pin over the gate time.
+    };
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      InputCapture class constructor.
+    //! \details    Creates an InputCapture object. The object still must be
+    //!                 initialized before use.
+    //! \see        init(cbool_t edgeCounting_p, cbool_t noiseCanceler_p).
+    //!
+    InputCapture(
+            void
+    );
+
+    //!
+    //! \brief      InputCapture class destructor.
+    //! \details    Destroys an InputCapture object.
+    //!
+    ~InputCapture(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ///////////////////     INITIALIZATION    ////////////////////     //
+    //!
+    //! \brief      Initializes the measurement engine.
+    //! \details    Configures TIMER1 in NORMAL mode and starts measuring in
+    //!                 the MID_FREQUENCY range.
+    //! \param[in]  edgeCounting_p      Enables the HIGH_FREQUENCY range. The
+    //!                                     signal must also be connected to
+    //!                                     the T1 pin.
+    //! \param[in]  noiseCanceler_p     Enables the input capture noise
+    //!                                     canceler.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t init(
+            cbool_t edgeCounting_p              = false,
+            cbool_t noiseCanceler_p             = false
+    );
+
+    //     /////////////////////     RESULTS     ///////////////////////     //
+    //!
+    //! \brief      Returns the signal frequency.
+    //! \details    Returns the signal frequency.
+    //! \param[out] frequency_p         Pointer to store the frequency, in Hz.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t getFrequency(
+            uint32_t *frequency_p
+    );
+
+    //!
+    //! \brief      Returns the signal period.
+    //! \details    Returns the signal period.
+    //! \param[out] period_p            Pointer to store the period, in ns.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t getPeriod(
+            uint32_t *period_p
+    );
+
+    //!
+    //! \brief      Returns the signal pulse width.
+    //! \details    Returns the width of the high level of the signal. Not
+    //!                 available in the HIGH_FREQUENCY range.
+    //! \param[out] pulseWidth_p        Pointer to store the width, in ns.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t getPulseWidth(
+            uint32_t *pulseWidth_p
+    );
+
+    //!
+    //! \brief      Returns the signal duty cycle.
+    //! \details    Returns the signal duty cycle. Not available in the
+    //!                 HIGH_FREQUENCY range.
+    //! \param[out] dutyCycle_p         Pointer to store the duty cycle, in
+    //!                                     tenths of percent (0 to 1000).
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t getDutyCycle(
+            uint16_t *dutyCycle_p
+    );
+
+    //!
+    //! \brief      Returns the current measurement range.
+    //! \details    Returns the current measurement range.
+    //! \return     Range               Current range.
+    //!
+    Range inlined getRange(
+            void
+    );
+
+    //!
+    //! \brief      Checks if a measurement is available.
+    //! \details    Checks if a measurement is available.
+    //! \retval     true                Measurement available.
+    //! \retval     false               No valid measurement (yet).
+    //!
+    bool_t inlined isDataReady(
+            void
+    );
+
+    //!
+    //! \brief      Returns the measured capture handler cost.
+    //! \details    Returns the longest time, in CPU cycles, measured from an
+    //!                 edge capture to the end of \ref captureHandler() in
+    //!                 the MID_FREQUENCY range, where TIMER1 counts CPU
+    //!                 cycles. It includes the interrupt response, the ISR
+    //!                 prologue and the callback, but not the ISR epilogue.
+    //!                 Used to set \ref INPUT_CAPTURE_HANDLER_CYCLES.
+    //! \return     uint16_t            Handler cost, in CPU cycles.
+    //!
+    uint16_t inlined getHandlerCycles(
+            void
+    );
+
+    //     //////////////////////     INTERRUPT     //////////////////////     //
+    //!
+    //! \brief      Timestamps an edge.
+    //! \details    Must be called from timer1InputCaptureCallback().
+    //!
+    void captureHandler(
+            void
+    );
+
+    //!
+    //! \brief      Extends the counter on TIMER1 overflow.
+    //! \details    Must be called from timer1OverflowCallback().
+    //!
+    void inlined overflowHandler(
+            void
+    );
+
+    //!
+    //! \brief      Gate time and signal loss handler.
+    //! \details    Must be called at \ref INPUT_CAPTURE_GATE_FREQUENCY.
+    //!
+    void gateHandler(
+            void
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    void _setRange(
+            const Range range_p
+    );
+    uint32_t _readCounter(
+            void
+    );
+    bool_t _getCaptureCounts(
+            uint32_t *period_p,
+            uint32_t *high_p
+    );
+    uint32_t _countsToNs(
+            cuint32_t counts_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    //     ///////////////////////     EDGES     ////////////////////////     //
+    vuint32_t       _edgeTime[INPUT_CAPTURE_BUFFER_SIZE];
+    vuint8_t        _edgeRisingMask;
+    vuint8_t        _edgeHead;
+    vuint8_t        _edgeCount;
+    vuint32_t       _overflows;
+
+    //     ////////////////////     EDGE COUNTING     ///////////////////     //
+    uint32_t        _gateStart;
+    vuint32_t       _gateCount;
+    uint16_t        _gateTicks;
+    vuint16_t       _ticksSinceEdge;
+    uint8_t         _missedEdges;
+    vuint16_t       _handlerCycles;
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    volatile Range  _range;
+    bool_t          _edgeCountingEnabled    : 1;
+    bool_t          _noiseCanceler          : 1;
+    volatile bool_t _isDataReady;
+    bool_t          _isInitialized          : 1;
+    Error           _lastError;
+}; // class InputCapture
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+InputCapture::Range inlined InputCapture::getRange(void)
+{
+    return this->_range;
+}
+
+bool_t inlined InputCapture::isDataReady(void)
+{
+    return this->_isDataReady;
+}
+
+uint16_t inlined InputCapture::getHandlerCycles(void)
+{
+    uint16_t aux16 = 0;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        aux16 = this->_handlerCycles;
+    }
+    return aux16;
+}
+
+void inlined InputCapture::overflowHandler(void)
+{
+    this->_overflows++;
+    return;
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          InputCapture engine handler object.
+//! \details        InputCapture engine handler object.
+//! \warning        Use this object to handle the engine. DO NOT create
+//!                     another instance of the class, since there is only one
+//!                     TIMER1 in the device.
+//!
+extern InputCapture inputCapture;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Input_Capture"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_INPUT_CAPTURE_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
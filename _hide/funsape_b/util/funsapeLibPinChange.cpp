@@ -0,0 +1,383 @@
+//!
+//! \file           funsapeLibPinChange.cpp
+//! \brief          Per-pin pin change dispatcher for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Per-pin pin change dispatcher for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibPinChange.hpp"
+#if !defined(__FUNSAPE_LIB_PIN_CHANGE_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_PIN_CHANGE_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <util/atomic.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_PIN_CHANGE                0x4AFF
+
+cuint8_t constNumberOfPins              = 24;       //!< Number of PCINT pins
+cuint8_t constNumberOfGroups            = 3;        //!< Number of pin change groups
+cuint8_t constQueueMask                 = (PIN_CHANGE_QUEUE_SIZE - 1);  //!< Event queue index mask
+cuint8_t constGroupPinsMask[3]          = {0xFF, 0x7F, 0xFF};   //!< Existing pins of each group
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+PinChange pinChange;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+#define pinGroup(pin)                   ((pin) >> 3)
+#define pinMask(pin)                    ((uint8_t)1 << ((pin) & 0x07))
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+PinChange::PinChange()
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::PinChange(void)", DEBUG_PIN_CHANGE);
+
+    // Reset data members
+    for(uint8_t i = 0; i < constNumberOfPins; i++) {
+        this->_risingCallback[i]        = nullptr;
+        this->_fallingCallback[i]       = nullptr;
+    }
+    for(uint8_t i = 0; i < constNumberOfGroups; i++) {
+        this->_enabledMask[i]           = 0;
+        this->_lastState[i]             = 0;
+    }
+    this->_timeSource                   = nullptr;
+    this->_queueHead                    = 0;
+    this->_queueTail                    = 0;
+    this->_droppedEvents                = 0;
+    this->_queueEnabled                 = false;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return;
+}
+
+PinChange::~PinChange()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ///////////////////////     PINS     /////////////////////////     //
+bool_t PinChange::attach(cuint8_t pin_p, pinChangeCallback_t risingCallback_p, pinChangeCallback_t fallingCallback_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::attach(cuint8_t, pinChangeCallback_t, pinChangeCallback_t)", DEBUG_PIN_CHANGE);
+
+    // Local variables
+    uint8_t group = pinGroup(pin_p);
+
+    // Check for errors
+    if((pin_p >= constNumberOfPins) || (!(constGroupPinsMask[group] & pinMask(pin_p)))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PIN_CHANGE);
+        return false;
+    }
+
+    // Register pin
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_risingCallback[pin_p] = risingCallback_p;
+        this->_fallingCallback[pin_p] = fallingCallback_p;
+        this->_lastState[group] = (this->_lastState[group] & ~pinMask(pin_p)) | (this->_readPort(group) & pinMask(pin_p));
+        this->_enabledMask[group] |= pinMask(pin_p);
+        this->_setGroupPins(group);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return true;
+}
+
+bool_t PinChange::detach(cuint8_t pin_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::detach(cuint8_t)", DEBUG_PIN_CHANGE);
+
+    // Local variables
+    uint8_t group = pinGroup(pin_p);
+
+    // Check for errors
+    if(pin_p >= constNumberOfPins) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PIN_CHANGE);
+        return false;
+    }
+
+    // Unregister pin
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_enabledMask[group] &= ~pinMask(pin_p);
+        this->_risingCallback[pin_p] = nullptr;
+        this->_fallingCallback[pin_p] = nullptr;
+        this->_setGroupPins(group);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return true;
+}
+
+//     ///////////////////////     QUEUE     ////////////////////////     //
+void PinChange::enableEventQueue(pinChangeTimeSource_t timeSource_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::enableEventQueue(pinChangeTimeSource_t)", DEBUG_PIN_CHANGE);
+
+    // Update data members
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_timeSource = timeSource_p;
+        this->_queueTail = this->_queueHead;
+        this->_droppedEvents = 0;
+        this->_queueEnabled = true;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return;
+}
+
+void PinChange::disableEventQueue(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::disableEventQueue(void)", DEBUG_PIN_CHANGE);
+
+    // Update data members
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_queueEnabled = false;
+        this->_queueTail = this->_queueHead;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return;
+}
+
+bool_t PinChange::popEvent(Event *event_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PinChange::popEvent(Event *)", DEBUG_PIN_CHANGE);
+
+    // Local variables
+    uint8_t tail = this->_queueTail;
+
+    // Check for errors
+    if(!isPointerValid(event_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_PIN_CHANGE);
+        return false;
+    }
+    if(tail == this->_queueHead) {
+        // Returns error
+        this->_lastError = Error::BUFFER_EMPTY;
+        debugMessage(Error::BUFFER_EMPTY, DEBUG_PIN_CHANGE);
+        return false;
+    }
+
+    // Single consumer: the slot is released only after being copied
+    *event_p = this->_queue[tail & constQueueMask];
+    this->_queueTail = tail + 1;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PIN_CHANGE);
+    return true;
+}
+
+uint8_t PinChange::getDroppedEvents(void)
+{
+    // Local variables
+    uint8_t dropped;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        dropped = this->_droppedEvents;
+        this->_droppedEvents = 0;
+    }
+
+    return dropped;
+}
+
+//     //////////////////////     INTERRUPT     //////////////////////     //
+void PinChange::interruptHandler(const Group group_p)
+{
+    // Local variables
+    uint8_t group = (uint8_t)group_p;
+    uint8_t state = this->_readPort(group);
+    uint8_t changed = (state ^ this->_lastState[group]) & this->_enabledMask[group];
+    uint8_t pin = group * 8;
+    uint8_t head;
+    uint32_t now = 0;
+    Edge edge;
+    pinChangeCallback_t callback;
+
+    // Find changed pins
+    this->_lastState[group] = state;
+    if(changed == 0) {
+        return;
+    }
+    if(this->_queueEnabled && isPointerValid(this->_timeSource)) {
+        now = this->_timeSource();
+    }
+
+    // Dispatch each changed pin
+    for(uint8_t mask = 0x01; changed != 0; mask <<= 1, pin++) {
+        if(!(changed & mask)) {
+            continue;
+        }
+        changed &= ~mask;
+        edge = (Edge)((state & mask) != 0);
+        callback = (edge == Edge::RISING) ? this->_risingCallback[pin] : this->_fallingCallback[pin];
+        if(isPointerValid(callback)) {
+            callback(pin, edge);
+        }
+        if(this->_queueEnabled) {
+            head = this->_queueHead;
+            if((uint8_t)(head - this->_queueTail) >= PIN_CHANGE_QUEUE_SIZE) {
+                if(this->_droppedEvents < 0xFF) {
+                    this->_droppedEvents++;
+                }
+            } else {
+                this->_queue[head & constQueueMask].pin = pin;
+                this->_queue[head & constQueueMask].edge = edge;
+                this->_queue[head & constQueueMask].timestamp = now;
+                this->_queueHead = head + 1;
+            }
+        }
+    }
+
+    return;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error PinChange::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+uint8_t PinChange::_readPort(cuint8_t group_p)
+{
+    switch(group_p) {
+    case 0:
+        return PINB;
+    case 1:
+        return PINC;
+    default:
+        return PIND;
+    }
+}
+
+void PinChange::_setGroupPins(cuint8_t group_p)
+{
+    // Local variables
+    uint8_t mask = this->_enabledMask[group_p];
+
+    // Update pin mask and group interrupt
+    switch(group_p) {
+    case 0:
+        pcint0.init((Pcint0::Pin)mask);
+        if(mask) {
+            pcint0.clearInterruptRequest();
+            pcint0.activateInterrupt();
+        } else {
+            pcint0.deactivateInterrupt();
+        }
+        break;
+    case 1:
+        pcint1.init((Pcint1::Pin)mask);
+        if(mask) {
+            pcint1.clearInterruptRequest();
+            pcint1.activateInterrupt();
+        } else {
+            pcint1.deactivateInterrupt();
+        }
+        break;
+    default:
+        pcint2.init((Pcint2::Pin)mask);
+        if(mask) {
+            pcint2.clearInterruptRequest();
+            pcint2.activateInterrupt();
+        } else {
+            pcint2.deactivateInterrupt();
+        }
+        break;
+    }
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,406 @@
+//!
+//! \file           funsapeLibPinChange.hpp
+//! \brief          Per-pin pin change dispatcher for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a dispatcher over the three pin change
+//!                     interrupt groups (PCINT0, PCINT1 and PCINT2). The last
+//!                     state of each port is kept, so the interrupt handler
+//!                     finds the changed pins with a single XOR and calls the
+//!                     rising or falling edge callback of each pin. The edges
+//!                     can also be pushed into a lock-free event queue, with a
+//!                     timestamp, to be processed from the main loop.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_PIN_CHANGE_HPP
+#define __FUNSAPE_LIB_PIN_CHANGE_HPP            2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_PIN_CHANGE_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_PIN_CHANGE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibPcint0.hpp"
+#if !defined(__FUNSAPE_LIB_PCINT0_HPP)
+#   error "Header file (funsapeLibPcint0.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_PCINT0_HPP != __FUNSAPE_LIB_PIN_CHANGE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibPcint0.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibPcint1.hpp"
+#if !defined(__FUNSAPE_LIB_PCINT1_HPP)
+#   error "Header file (funsapeLibPcint1.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_PCINT1_HPP != __FUNSAPE_LIB_PIN_CHANGE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibPcint1.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibPcint2.hpp"
+#if !defined(__FUNSAPE_LIB_PCINT2_HPP)
+#   error "Header file (funsapeLibPcint2.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_PCINT2_HPP != __FUNSAPE_LIB_PIN_CHANGE_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibPcint2.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/PinChange"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     PinChange
+//! \brief          Per-pin pin change dispatcher.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef PIN_CHANGE_QUEUE_SIZE
+//!
+//! \brief          Size of the pin change event queue.
+//! \details        Maximum number of events waiting to be processed. Must be a
+//!                     power of two, not greater than 128.
+//!
+#   define PIN_CHANGE_QUEUE_SIZE                16
+#endif
+
+#if (PIN_CHANGE_QUEUE_SIZE & (PIN_CHANGE_QUEUE_SIZE - 1)) != 0
+#   error "PIN_CHANGE_QUEUE_SIZE must be a power of two!"
+#elif PIN_CHANGE_QUEUE_SIZE > 128
+#   error "PIN_CHANGE_QUEUE_SIZE must not be greater than 128!"
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+//!
+//! \brief          Pin change callback function type.
+//! \details        Function called, in interrupt context, when an edge is
+//!                     detected at a pin. The \a pin_p value is the PCINT
+//!                     number of the pin (0 to 23).
+//!
+typedef void (*pinChangeCallback_t)(cuint8_t pin_p, const Edge edge_p);
+
+//!
+//! \brief          Timestamp source function type.
+//! \details        Function called, in interrupt context, to timestamp the
+//!                     queued events (e.g. a function that returns
+//!                     timestamp.getMicros() or softTimer.getTicks()).
+//!
+typedef uint32_t (*pinChangeTimeSource_t)(void);
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// PinChange Class
+// =============================================================================
+
+//!
+//! \brief          PinChange class.
+//! \details        This class dispatches pin change interrupts per pin. Pins
+//!                     are identified by their PCINT number: 0 to 7 are PB0 to
+//!                     PB7, 8 to 14 are PC0 to PC6 and 16 to 23 are PD0 to
+//!                     PD7. The interrupt callback of each used group must be
+//!                     forwarded to the dispatcher:
+//! \code
+//!                 void pcint2InterruptCallback(void)
+//!                 {
+//!                     pinChange.interruptHandler(PinChange::Group::PCINT2_PORTD);
+//!                 }
+//! \endcode
+//! \warning        The pin direction and pull-up must be configured by the
+//!                     user.
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class PinChange
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+
+    //     ///////////////////////     GROUP     ////////////////////////     //
+    //!
+    //! \brief      Pin change group enumeration.
+    //! \details    Pin change interrupt groups and their ports.
+    //! \warning    The value associate with the symbolic names may change
+    //!                 between builds and might not reflect the register/bits
+    //!                 real values. In order to ensure compatibility between
+    //!                 builds, always refer to the SYMBOLIC NAME, instead of
+    //!                 the VALUE.
+    //!
+    enum class Group : uint8_t {
+        PCINT0_PORTB                    = 0,    //!< PCINT0 to PCINT7 (PORTB).
+        PCINT1_PORTC                    = 1,    //!< PCINT8 to PCINT14 (PORTC).
+        PCINT2_PORTD                    = 2,    //!< PCINT16 to PCINT23 (PORTD).
+    };
+
+    //     ///////////////////////     EVENT     ////////////////////////     //
+    //!
+    //! \brief      Pin change event.
+    //! \details    Edge detected at a pin, as stored in the event queue.
+    //!
+    struct Event {
+        uint8_t     pin;                        //!< PCINT number of the pin.
+        Edge        edge;                       //!< Detected edge.
+        uint32_t    timestamp;                  //!< Value of the time source at the interrupt.
+    };
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      PinChange class constructor.
+    //! \details    Creates a PinChange object with no pins attached and the
+    //!                 event queue disabled.
+    //!
+    PinChange(
+            void
+    );
+
+    //!
+    //! \brief      PinChange class destructor.
+    //! \details    Destroys a PinChange object.
+    //!
+    ~PinChange(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ///////////////////////     PINS     /////////////////////////     //
+    //!
+    //! \brief      Attaches edge callbacks to a pin.
+    //! \details    Stores the callbacks, samples the pin state and enables the
+    //!                 pin change interrupt of the pin and of its group.
+    //!                 Either callback can be nullptr.
+    //! \param[in]  pin_p               PCINT number of the pin.
+    //! \param[in]  risingCallback_p    Function called at rising edges.
+    //! \param[in]  fallingCallback_p   Function called at falling edges.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t attach(
+            cuint8_t pin_p,
+            pinChangeCallback_t risingCallback_p,
+            pinChangeCallback_t fallingCallback_p   = nullptr
+    );
+
+    //!
+    //! \brief      Detaches a pin.
+    //! \details    Disables the pin change interrupt of the pin. The group
+    //!                 interrupt is disabled when no pins of the group remain.
+    //! \param[in]  pin_p               PCINT number of the pin.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t detach(
+            cuint8_t pin_p
+    );
+
+    //     ///////////////////////     QUEUE     ////////////////////////     //
+    //!
+    //! \brief      Enables the event queue.
+    //! \details    Every detected edge of an attached pin is also pushed into
+    //!                 the event queue. If the queue is full, the event is
+    //!                 dropped and counted.
+    //! \param[in]  timeSource_p        Function used to timestamp the events.
+    //!                                     If nullptr, timestamps are 0.
+    //!
+    void enableEventQueue(
+            pinChangeTimeSource_t timeSource_p  = nullptr
+    );
+
+    //!
+    //! \brief      Disables the event queue.
+    //! \details    Disables the event queue and discards the queued events.
+    //!
+    void disableEventQueue(
+            void
+    );
+
+    //!
+    //! \brief      Retrieves the oldest event from the queue.
+    //! \details    Retrieves the oldest event from the queue. Must be called
+    //!                 from a single context (usually the main loop).
+    //! \param[out] event_p             Pointer to store the event.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t popEvent(
+            Event *event_p
+    );
+
+    //!
+    //! \brief      Returns the number of queued events.
+    //! \details    Returns the number of queued events.
+    //! \return     uint8_t             Number of queued events.
+    //!
+    uint8_t inlined getEventCount(
+            void
+    );
+
+    //!
+    //! \brief      Returns the number of dropped events.
+    //! \details    Returns the number of events dropped because the queue was
+    //!                 full, and resets the counter.
+    //! \return     uint8_t             Number of dropped events.
+    //!
+    uint8_t getDroppedEvents(
+            void
+    );
+
+    //     //////////////////////     INTERRUPT     //////////////////////     //
+    //!
+    //! \brief      Dispatches the changes of a group.
+    //! \details    Must be called from the interrupt callback of each used
+    //!                 pin change group.
+    //! \param[in]  group_p             Group whose interrupt is handled.
+    //!
+    void interruptHandler(
+            const Group group_p
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    uint8_t _readPort(
+            cuint8_t group_p
+    );
+    void _setGroupPins(
+            cuint8_t group_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    pinChangeCallback_t     _risingCallback[24];
+    pinChangeCallback_t     _fallingCallback[24];
+    uint8_t                 _enabledMask[3];
+    uint8_t                 _lastState[3];
+    pinChangeTimeSource_t   _timeSource;
+    Event                   _queue[PIN_CHANGE_QUEUE_SIZE];
+    vuint8_t                _queueHead;
+    vuint8_t                _queueTail;
+    vuint8_t                _droppedEvents;
+    bool_t                  _queueEnabled   : 1;
+    Error                   _lastError;
+}; // class PinChange
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+uint8_t inlined PinChange::getEventCount(void)
+{
+    return (uint8_t)(this->_queueHead - this->_queueTail);
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          PinChange service handler object.
+//! \details        PinChange service handler object.
+//! \warning        Use this object to handle the service. DO NOT create
+//!                     another instance of the class.
+//!
+extern PinChange pinChange;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/PinChange"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_PIN_CHANGE_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,485 @@
+//!
+//! \file           funsapeLibPulseOximetry.cpp
+//! \brief          Heart rate and SpO2 estimation for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Heart rate and SpO2 estimation for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibPulseOximetry.hpp"
+#if !defined(__FUNSAPE_LIB_PULSE_OXIMETRY_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_PULSE_OXIMETRY_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_PULSE_OXIMETRY            0x4BFF
+
+// Band-pass biquad coefficients (Q14), centered at 1.5 Hz with Q = 0.375,
+// for each SampleRate. Since b1 = 0 and b2 = -b0, only b0, a1 and a2 are kept.
+static const int16_t filterCoefficients[4][3] = {
+    {3275,  -25753, 9834},                      // 50 Hz
+    {1827,  -28986, 12731},                     // 100 Hz
+    {968,   -30797, 14448},                     // 200 Hz
+    {499,   -31761, 15386},                     // 400 Hz
+};
+
+// SpO2 (%) for R = 0 to 2, in steps of 1/16
+static const uint8_t spo2Table[33] = {
+    95,  97,  98,  99,  100, 100, 100, 100,
+    99,  98,  96,  94,  92,  90,  87,  84,
+    80,  76,  72,  67,  62,  57,  51,  45,
+    39,  32,  25,  18,  10,  2,   0,   0,
+    0
+};
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static functions declarations
+// =============================================================================
+
+static inline int16_t saturate(int32_t value_p);
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+PulseOximetry::PulseOximetry()
+{
+    // Mark passage for debugging purpose
+    debugMark("PulseOximetry::PulseOximetry(void)", DEBUG_PULSE_OXIMETRY);
+
+    // Reset data members
+    this->_sampleRate                   = 0;
+    this->_coeffB0                      = 0;
+    this->_coeffA1                      = 0;
+    this->_coeffA2                      = 0;
+    this->_decayShift                   = 0;
+    this->_refractory                   = 0;
+    this->_maxInterval                  = 0;
+    this->_isInitialized                = false;
+    this->_clearState();
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PULSE_OXIMETRY);
+    return;
+}
+
+PulseOximetry::~PulseOximetry()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_PULSE_OXIMETRY);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ///////////////////     INITIALIZATION    ////////////////////     //
+bool_t PulseOximetry::init(const SampleRate sampleRate_p)
+{
+    // Local variables
+    uint8_t index = (uint8_t)sampleRate_p;
+
+    // Mark passage for debugging purpose
+    debugMark("PulseOximetry::init(const SampleRate)", DEBUG_PULSE_OXIMETRY);
+
+    // CHECK FOR ERROR - sample rate out of range
+    if(index > (uint8_t)SampleRate::RATE_400_HZ) {
+        // Returns error
+        this->_isInitialized = false;
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Update parameters
+    this->_sampleRate = 50 << index;
+    this->_coeffB0 = filterCoefficients[index][0];
+    this->_coeffA1 = filterCoefficients[index][1];
+    this->_coeffA2 = filterCoefficients[index][2];
+    this->_decayShift = 6 + index;                      // Time constant of about 1.3 s
+    this->_refractory = (this->_sampleRate * 3) / 10;   // Up to 200 bpm
+    this->_maxInterval = this->_sampleRate * 2;         // Down to 30 bpm
+
+    // Reset state
+    this->_clearState();
+    this->_isInitialized = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PULSE_OXIMETRY);
+    return true;
+}
+
+//     //////////////////////     SAMPLES     ///////////////////////     //
+bool_t PulseOximetry::addSample(cuint32_t red_p, cuint32_t infrared_p, bool_t *beat_p)
+{
+    // Local variables
+    int16_t current;
+
+    // Note: This function is called once per sample, so no debug mark passage
+    // was placed to keep its cost bounded.
+
+    // Check initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Filter both channels; the infrared signal is inverted, so that the
+    // systolic pulse is a positive peak
+    this->_filterChannel(&this->_red, red_p);
+    current = -this->_filterChannel(&this->_infrared, infrared_p);
+
+    // Adaptive threshold decays between beats
+    this->_threshold -= this->_threshold >> this->_decayShift;
+
+    // Peak detection
+    this->_beatDetected = false;
+    if(this->_warmUp > 0) {
+        this->_warmUp--;
+    } else if((this->_previous[0] > this->_previous[1]) &&
+            (this->_previous[0] >= current) &&
+            (this->_previous[0] > this->_threshold) &&
+            (this->_samplesSinceBeat >= this->_refractory)) {
+        this->_processBeat();
+    }
+    this->_previous[1] = this->_previous[0];
+    this->_previous[0] = current;
+
+    // No beat for too long means the signal was lost
+    if(this->_samplesSinceBeat < this->_maxInterval) {
+        this->_samplesSinceBeat++;
+        if(this->_samplesSinceBeat == this->_maxInterval) {
+            this->_intervalIndex = 0;
+            this->_intervalCount = 0;
+            this->_heartRate = 0;
+            this->_ratioValid = false;
+            this->_spo2 = 0;
+        }
+    }
+
+    // Update function arguments
+    if(isPointerValid(beat_p)) {
+        *beat_p = this->_beatDetected;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return true;
+}
+
+//     //////////////////////     RESULTS     ///////////////////////     //
+bool_t PulseOximetry::getHeartRate(uint8_t *heartRate_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PulseOximetry::getHeartRate(uint8_t *)", DEBUG_PULSE_OXIMETRY);
+
+    // CHECK FOR ERROR - null pointer
+    if(!isPointerValid(heartRate_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Check initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Check estimate
+    if(this->_intervalCount == 0) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Update function arguments
+    *heartRate_p = this->_heartRate;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PULSE_OXIMETRY);
+    return true;
+}
+
+bool_t PulseOximetry::getSpo2(uint8_t *spo2_p, uint16_t *ratio_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("PulseOximetry::getSpo2(uint8_t *, uint16_t *)", DEBUG_PULSE_OXIMETRY);
+
+    // CHECK FOR ERROR - null pointer
+    if(!isPointerValid(spo2_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Check initialization
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Check estimate
+    if(!this->_ratioValid) {
+        // Returns error
+        this->_lastError = Error::NOT_READY;
+        debugMessage(Error::NOT_READY, DEBUG_PULSE_OXIMETRY);
+        return false;
+    }
+
+    // Update function arguments
+    *spo2_p = this->_spo2;
+    if(isPointerValid(ratio_p)) {
+        *ratio_p = this->_ratio;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PULSE_OXIMETRY);
+    return true;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error PulseOximetry::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+void PulseOximetry::_clearState(void)
+{
+    // Filter state
+    this->_red.dcLevel = 0;
+    this->_red.input[0] = 0;
+    this->_red.input[1] = 0;
+    this->_red.output[0] = 0;
+    this->_red.output[1] = 0;
+    this->_red.error = 0;
+    this->_red.acMax = 0;
+    this->_red.acMin = 0;
+    this->_infrared = this->_red;
+    this->_warmUp = this->_sampleRate;
+
+    // Beat detection
+    this->_previous[0] = 0;
+    this->_previous[1] = 0;
+    this->_peakLevel = 0;
+    this->_threshold = 0;
+    this->_samplesSinceBeat = this->_maxInterval;
+    for(uint8_t i = 0; i < constPulseOximetryIntervals; i++) {
+        this->_intervals[i] = 0;
+    }
+    this->_intervalIndex = 0;
+    this->_intervalCount = 0;
+
+    // Results
+    this->_heartRate = 0;
+    this->_spo2 = 0;
+    this->_ratio = 0;
+    this->_beatDetected = false;
+    this->_ratioValid = false;
+
+    return;
+}
+
+int16_t PulseOximetry::_filterChannel(Channel *channel_p, cuint32_t sample_p)
+{
+    // Local variables
+    int32_t aux32;
+    int16_t value;
+
+    // DC removal; the first sample sets the DC level directly
+    if(channel_p->dcLevel == 0) {
+        channel_p->dcLevel = (int32_t)sample_p << 8;
+    }
+    channel_p->dcLevel += (((int32_t)sample_p << 8) - channel_p->dcLevel) >> this->_decayShift;
+    value = saturate((int32_t)sample_p - (channel_p->dcLevel >> 8));
+
+    // Band-pass, direct form I; the rounding error is fed back, since the
+    // poles are close to the unit circle and plain rounding would distort
+    // the few counts of AC signal of the red channel
+    aux32 = (int32_t)this->_coeffB0 * ((int32_t)value - channel_p->input[1]);
+    aux32 -= (int32_t)this->_coeffA1 * channel_p->output[0];
+    aux32 -= (int32_t)this->_coeffA2 * channel_p->output[1];
+    aux32 += channel_p->error;
+    channel_p->input[1] = channel_p->input[0];
+    channel_p->input[0] = value;
+    value = saturate(aux32 >> 14);
+    channel_p->error = (int16_t)(aux32 & 0x3FFF);
+    channel_p->output[1] = channel_p->output[0];
+    channel_p->output[0] = value;
+
+    // AC level extremes
+    if(value > channel_p->acMax) {
+        channel_p->acMax = value;
+    }
+    if(value < channel_p->acMin) {
+        channel_p->acMin = value;
+    }
+
+    return value;
+}
+
+void PulseOximetry::_processBeat(void)
+{
+    // Local variables
+    uint16_t interval = this->_samplesSinceBeat;
+    uint32_t dcRed = (uint32_t)(this->_red.dcLevel >> 8);
+    uint32_t dcInfrared = (uint32_t)(this->_infrared.dcLevel >> 8);
+    uint32_t perfusionRed;
+    uint32_t perfusionInfrared;
+    uint32_t aux32;
+    uint16_t ratio;
+    uint8_t index;
+
+    // Follow the peak level with the adaptive threshold
+    this->_peakLevel += (this->_previous[0] - this->_peakLevel) >> 2;
+    this->_threshold = this->_peakLevel >> 1;
+    this->_beatDetected = true;
+    this->_samplesSinceBeat = 0;
+
+    // Without a finger, or without a previous beat, there is no interval
+    if((dcRed < constPulseOximetryMinimumDc) || (dcInfrared < constPulseOximetryMinimumDc)) {
+        this->_samplesSinceBeat = this->_maxInterval;
+        this->_intervalIndex = 0;
+        this->_intervalCount = 0;
+        this->_ratioValid = false;
+        interval = this->_maxInterval;
+    }
+    if(interval >= this->_maxInterval) {
+        this->_restartAcLevel(&this->_red);
+        this->_restartAcLevel(&this->_infrared);
+        return;
+    }
+
+    // Heart rate, averaged over the last intervals
+    this->_intervals[this->_intervalIndex] = interval;
+    this->_intervalIndex = (this->_intervalIndex + 1) % constPulseOximetryIntervals;
+    if(this->_intervalCount < constPulseOximetryIntervals) {
+        this->_intervalCount++;
+    }
+    aux32 = 0;
+    for(uint8_t i = 0; i < this->_intervalCount; i++) {
+        aux32 += this->_intervals[i];
+    }
+    this->_heartRate = (uint8_t)(((60UL * this->_sampleRate * this->_intervalCount) + (aux32 >> 1)) / aux32);
+
+    // Perfusion of each channel: peak-to-peak AC level over DC level (Q15).
+    // Unlike the mean rectified level, it is not inflated by the baseline
+    // wander left by the band-pass, which weighs more on the red channel.
+    perfusionRed = ((uint32_t)(this->_red.acMax - this->_red.acMin) << 15) / dcRed;
+    perfusionInfrared = ((uint32_t)(this->_infrared.acMax - this->_infrared.acMin) << 15) / dcInfrared;
+    this->_restartAcLevel(&this->_red);
+    this->_restartAcLevel(&this->_infrared);
+    if(perfusionInfrared == 0) {
+        return;
+    }
+
+    // Ratio of ratios (Q8), limited to the lookup table range and smoothed
+    aux32 = (perfusionRed << 8) / perfusionInfrared;
+    ratio = (aux32 > 512) ? 512 : (uint16_t)aux32;
+    if(this->_ratioValid) {
+        this->_ratio = (uint16_t)((int16_t)this->_ratio + (((int16_t)ratio - (int16_t)this->_ratio) / 4));
+    } else {
+        this->_ratio = ratio;
+        this->_ratioValid = true;
+    }
+
+    // SpO2 lookup, with linear interpolation
+    index = this->_ratio >> 4;
+    if(index >= 32) {
+        this->_spo2 = spo2Table[32];
+    } else {
+        this->_spo2 = spo2Table[index] +
+                (((int16_t)spo2Table[index + 1] - (int16_t)spo2Table[index]) * (this->_ratio & 0x0F)) / 16;
+    }
+
+    return;
+}
+
+void PulseOximetry::_restartAcLevel(Channel *channel_p)
+{
+    // The next beat interval starts at the current sample
+    channel_p->acMax = channel_p->output[0];
+    channel_p->acMin = channel_p->output[0];
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Static functions definitions
+// =============================================================================
+
+static inline int16_t saturate(int32_t value_p)
+{
+    if(value_p > 32767) {
+        return 32767;
+    }
+    if(value_p < -32767) {
+        return -32767;
+    }
+    return (int16_t)value_p;
+}
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
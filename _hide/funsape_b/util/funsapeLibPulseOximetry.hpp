@@ -0,0 +1,348 @@
+//!
+//! \file           funsapeLibPulseOximetry.hpp
+//! \brief          Heart rate and SpO2 estimation for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides an incremental heart rate and SpO2
+//!                     estimator for red/infrared photoplethysmography samples
+//!                     (e.g. from the MAX30102 sample ring). All the processing
+//!                     is done in fixed point: the signals are handled as Q15
+//!                     values and the filter coefficients as Q14 values. Each
+//!                     sample costs a constant amount of work; the divisions
+//!                     are done only once per detected beat.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_PULSE_OXIMETRY_HPP
+#define __FUNSAPE_LIB_PULSE_OXIMETRY_HPP        2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_PULSE_OXIMETRY_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_PULSE_OXIMETRY_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Pulse_Oximetry"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Pulse_Oximetry
+//! \brief          Heart rate and SpO2 estimation.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+cuint8_t constPulseOximetryIntervals    = 4;        //!< Beat intervals averaged for the heart rate
+cuint32_t constPulseOximetryMinimumDc   = 1024;     //!< Smallest DC level (raw counts) accepted as a finger
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// PulseOximetry Class
+// =============================================================================
+
+//!
+//! \brief          PulseOximetry class.
+//! \details        This class estimates the heart rate and the SpO2 from red
+//!                     and infrared samples taken at a fixed sample rate. For
+//!                     each channel, the DC level is tracked by a first order
+//!                     low-pass filter and subtracted, and the remaining AC
+//!                     signal is band-pass filtered (0.5 Hz to 4.5 Hz) by a
+//!                     biquad. Beats are detected as peaks of the inverted
+//!                     infrared signal above an adaptive threshold, which
+//!                     follows half of the recent peak level and decays
+//!                     between beats. At each beat, the peak-to-peak AC
+//!                     level of each channel is normalized by its DC level,
+//!                     and the ratio of ratios (R) is mapped to SpO2 by a
+//!                     lookup table. The biquad feeds its rounding error back
+//!                     into the next sample, so small AC levels are not
+//!                     distorted by the integer output.
+//! \code
+//!                 PulseOximetry oximeter;
+//!                 oximeter.init(PulseOximetry::SampleRate::RATE_100_HZ);
+//!                 while(ring.tail != ring.head) {
+//!                     oximeter.addSample(redSamples[ring.tail & 63], irSamples[ring.tail & 63]);
+//!                     ring.tail++;
+//!                 }
+//!                 if(oximeter.getHeartRate(&heartRate)) {
+//!                     // ...
+//!                 }
+//! \endcode
+//! \note           The lookup table implements the usual empirical curve
+//!                     SpO2 = -45.060 R^2 + 30.354 R + 94.845. It is not a
+//!                     calibration of any particular sensor or enclosure.
+//!
+class PulseOximetry
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+    //     ////////////////////     SAMPLE RATE     ////////////////////     //
+    //!
+    //! \brief      Sample rate enumeration.
+    //! \details    Rate at which the samples are passed to \ref addSample().
+    //!                 It is the device sample rate divided by the device
+    //!                 sample averaging.
+    //!
+    enum class SampleRate : uint8_t {
+        RATE_50_HZ                      = 0,    //!< 50 samples per second.
+        RATE_100_HZ                     = 1,    //!< 100 samples per second.
+        RATE_200_HZ                     = 2,    //!< 200 samples per second.
+        RATE_400_HZ                     = 3,    //!< 400 samples per second.
+    };
+
+private:
+    struct Channel {
+        int32_t         dcLevel;                // DC level, in 1/256 raw counts
+        int16_t         input[2];               // Band-pass input history
+        int16_t         output[2];              // Band-pass output history
+        int16_t         error;                  // Band-pass rounding error (Q14)
+        int16_t         acMax;                  // Band-pass output maximum since last beat
+        int16_t         acMin;                  // Band-pass output minimum since last beat
+    };
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      PulseOximetry class constructor.
+    //! \details    Creates a PulseOximetry object. The object still must be
+    //!                 initialized before use.
+    //! \see        init(SampleRate).
+    //!
+    PulseOximetry(
+            void
+    );
+
+    //!
+    //! \brief      PulseOximetry class destructor.
+    //! \details    Destroys a PulseOximetry object.
+    //!
+    ~PulseOximetry(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ///////////////////     INITIALIZATION    ////////////////////     //
+    //!
+    //! \brief      Initializes the estimator.
+    //! \details    Loads the filter coefficients for the sample rate and
+    //!                 clears the estimator state. The beat detection starts
+    //!                 after one second of samples, when the filters settled.
+    //! \param[in]  sampleRate_p        Rate at which the samples are added.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t init(
+            const SampleRate sampleRate_p       = SampleRate::RATE_100_HZ
+    );
+
+    //     //////////////////////     SAMPLES     ///////////////////////     //
+    //!
+    //! \brief      Adds a sample to the estimator.
+    //! \details    Processes a pair of red and infrared samples, as read from
+    //!                 the device FIFO (up to 18 bits).
+    //! \param[in]  red_p               Red LED sample.
+    //! \param[in]  infrared_p          Infrared LED sample.
+    //! \param[out] beat_p              Set to true if a beat was detected at
+    //!                                     this sample (optional).
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t addSample(
+            cuint32_t red_p,
+            cuint32_t infrared_p,
+            bool_t *beat_p                      = nullptr
+    );
+
+    //     //////////////////////     RESULTS     ///////////////////////     //
+    //!
+    //! \brief      Returns the heart rate.
+    //! \details    Returns the heart rate averaged over the last
+    //!                 \ref constPulseOximetryIntervals beat intervals.
+    //! \param[out] heartRate_p         Heart rate, in beats per minute.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!                                     Error::NOT_READY means that no
+    //!                                     valid estimate is available.
+    //!
+    bool_t getHeartRate(
+            uint8_t *heartRate_p
+    );
+
+    //!
+    //! \brief      Returns the SpO2.
+    //! \details    Returns the SpO2 computed from the smoothed ratio of
+    //!                 ratios.
+    //! \param[out] spo2_p              Oxygen saturation, in percent.
+    //! \param[out] ratio_p             Ratio of ratios R, in Q8 format
+    //!                                     (optional).
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!                                     Error::NOT_READY means that no
+    //!                                     valid estimate is available.
+    //!
+    bool_t getSpo2(
+            uint8_t *spo2_p,
+            uint16_t *ratio_p                   = nullptr
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    void _clearState(
+            void
+    );
+    int16_t _filterChannel(
+            Channel *channel_p,
+            cuint32_t sample_p
+    );
+    void _processBeat(
+            void
+    );
+    void _restartAcLevel(
+            Channel *channel_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    //     /////////////////////     PARAMETERS    /////////////////////     //
+    uint16_t        _sampleRate;
+    int16_t         _coeffB0;
+    int16_t         _coeffA1;
+    int16_t         _coeffA2;
+    uint8_t         _decayShift;
+    uint16_t        _refractory;
+    uint16_t        _maxInterval;
+
+    //     ////////////////////     FILTER STATE    ////////////////////     //
+    Channel         _red;
+    Channel         _infrared;
+    uint16_t        _warmUp;
+
+    //     ////////////////////     BEAT DETECTION    ///////////////////     //
+    int16_t         _previous[2];
+    int16_t         _peakLevel;
+    int16_t         _threshold;
+    uint16_t        _samplesSinceBeat;
+    uint16_t        _intervals[constPulseOximetryIntervals];
+    uint8_t         _intervalIndex;
+    uint8_t         _intervalCount;
+
+    //     ///////////////////////     RESULTS    //////////////////////     //
+    uint8_t         _heartRate;
+    uint8_t         _spo2;
+    uint16_t        _ratio;
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    bool_t          _isInitialized      : 1;
+    bool_t          _beatDetected       : 1;
+    bool_t          _ratioValid         : 1;
+    Error           _lastError;
+}; // class PulseOximetry
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+// NONE
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Pulse_Oximetry"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif  // __FUNSAPE_LIB_PULSE_OXIMETRY_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
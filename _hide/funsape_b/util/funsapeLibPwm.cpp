@@ -0,0 +1,626 @@
+//!
+//! \file           funsapeLibPwm.cpp
+//! \brief          Multi-channel PWM service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Multi-channel PWM service for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibPwm.hpp"
+#if !defined(__FUNSAPE_LIB_PWM_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_PWM_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <util/atomic.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_PWM                       0x3EFF
+
+cuint8_t constNumberOfChannels          = 6;        //!< Number of hardware PWM outputs
+
+// TIMER0 prescaler: highest 8-bit fast PWM frequency not above the requested
+#if (F_CPU / (1UL * 256UL)) <= PWM_TIMER0_FREQUENCY
+#   define PWM_TIMER0_PRESCALER         1UL
+#   define PWM_TIMER0_CLOCK_SOURCE      Timer0::ClockSource::PRESCALER_1
+#elif (F_CPU / (8UL * 256UL)) <= PWM_TIMER0_FREQUENCY
+#   define PWM_TIMER0_PRESCALER         8UL
+#   define PWM_TIMER0_CLOCK_SOURCE      Timer0::ClockSource::PRESCALER_8
+#elif (F_CPU / (64UL * 256UL)) <= PWM_TIMER0_FREQUENCY
+#   define PWM_TIMER0_PRESCALER         64UL
+#   define PWM_TIMER0_CLOCK_SOURCE      Timer0::ClockSource::PRESCALER_64
+#elif (F_CPU / (256UL * 256UL)) <= PWM_TIMER0_FREQUENCY
+#   define PWM_TIMER0_PRESCALER         256UL
+#   define PWM_TIMER0_CLOCK_SOURCE      Timer0::ClockSource::PRESCALER_256
+#else
+#   define PWM_TIMER0_PRESCALER         1024UL
+#   define PWM_TIMER0_CLOCK_SOURCE      Timer0::ClockSource::PRESCALER_1024
+#endif
+
+// TIMER2 prescaler: highest 8-bit fast PWM frequency not above the requested
+#if (F_CPU / (1UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         1UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_1
+#elif (F_CPU / (8UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         8UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_8
+#elif (F_CPU / (32UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         32UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_32
+#elif (F_CPU / (64UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         64UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_64
+#elif (F_CPU / (128UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         128UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_128
+#elif (F_CPU / (256UL * 256UL)) <= PWM_TIMER2_FREQUENCY
+#   define PWM_TIMER2_PRESCALER         256UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_256
+#else
+#   define PWM_TIMER2_PRESCALER         1024UL
+#   define PWM_TIMER2_CLOCK_SOURCE      Timer2::ClockSource::PRESCALER_1024
+#endif
+
+// TIMER1 prescaler: smallest prescaler that fits TOP in 16 bits
+#if (F_CPU / PWM_TIMER1_FREQUENCY) < 256UL
+#   error "PWM_TIMER1_FREQUENCY is too high (resolution below 8 bits)!"
+#elif (F_CPU / (1UL * PWM_TIMER1_FREQUENCY)) <= 65536UL
+#   define PWM_TIMER1_PRESCALER         1UL
+#   define PWM_TIMER1_CLOCK_SOURCE      Timer1::ClockSource::PRESCALER_1
+#elif (F_CPU / (8UL * PWM_TIMER1_FREQUENCY)) <= 65536UL
+#   define PWM_TIMER1_PRESCALER         8UL
+#   define PWM_TIMER1_CLOCK_SOURCE      Timer1::ClockSource::PRESCALER_8
+#elif (F_CPU / (64UL * PWM_TIMER1_FREQUENCY)) <= 65536UL
+#   define PWM_TIMER1_PRESCALER         64UL
+#   define PWM_TIMER1_CLOCK_SOURCE      Timer1::ClockSource::PRESCALER_64
+#elif (F_CPU / (256UL * PWM_TIMER1_FREQUENCY)) <= 65536UL
+#   define PWM_TIMER1_PRESCALER         256UL
+#   define PWM_TIMER1_CLOCK_SOURCE      Timer1::ClockSource::PRESCALER_256
+#elif (F_CPU / (1024UL * PWM_TIMER1_FREQUENCY)) <= 65536UL
+#   define PWM_TIMER1_PRESCALER         1024UL
+#   define PWM_TIMER1_CLOCK_SOURCE      Timer1::ClockSource::PRESCALER_1024
+#else
+#   error "PWM_TIMER1_FREQUENCY is too low!"
+#endif
+
+cuint16_t constTimer1Top                = (uint16_t)((F_CPU / (PWM_TIMER1_PRESCALER * PWM_TIMER1_FREQUENCY)) - 1);  //!< TIMER1 TOP value (ICR1)
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+Pwm pwm;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+#define channelMask(index)              ((uint8_t)1 << (index))
+#define timerChannelsMask(timer)        ((uint8_t)0x03 << ((uint8_t)(timer) * 2))
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+Pwm::Pwm()
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::Pwm(void)", DEBUG_PWM);
+
+    // Reset data members
+    for(uint8_t i = 0; i < constNumberOfChannels; i++) {
+        this->_stagedValue[i]           = 0;
+        this->_pendingValue[i]          = 0;
+    }
+    this->_stagedMask                   = 0;
+    this->_stagedOffMask                = 0;
+    this->_pendingMask                  = 0;
+    this->_pendingOffMask               = 0;
+    this->_enabledMask                  = 0;
+    this->_invertedMask                 = 0;
+    this->_connectedMask                = 0;
+    this->_nextConnectedMask            = 0;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return;
+}
+
+Pwm::~Pwm()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     //////////////////////     CHANNEL     ///////////////////////     //
+bool_t Pwm::enable(const Channel channel_p, cbool_t inverted_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::enable(const Channel, cbool_t)", DEBUG_PWM);
+
+    // Local variables
+    uint8_t index = (uint8_t)channel_p;
+    Timer timer = (Timer)(index / 2);
+    bool_t timerRunning;
+    bool_t initOk = true;
+    vuint8_t *ddr = &DDRD;
+    vuint8_t *port = &PORTD;
+    uint8_t bit = 0;
+
+    // Check for errors
+    if(index >= constNumberOfChannels) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PWM);
+        return false;
+    }
+
+    // Starts the timer if none of its channels is in use
+    timerRunning = (bool_t)((this->_enabledMask & timerChannelsMask(timer)) != 0);
+    if(!timerRunning) {
+        switch(timer) {
+        case Timer::TIMER0:
+            initOk = timer0.init(Timer0::Mode::PWM_FAST_MAX, PWM_TIMER0_CLOCK_SOURCE);
+            this->_lastError = timer0.getLastError();
+            break;
+        case Timer::TIMER1:
+            timer1.setInputCaptureValue(constTimer1Top);
+            initOk = timer1.init(Timer1::Mode::PWM_FAST_ICR, PWM_TIMER1_CLOCK_SOURCE);
+            this->_lastError = timer1.getLastError();
+            break;
+        case Timer::TIMER2:
+            initOk = timer2.init(Timer2::Mode::PWM_FAST_MAX, PWM_TIMER2_CLOCK_SOURCE);
+            this->_lastError = timer2.getLastError();
+            break;
+        }
+        if(!initOk) {
+            // Returns error
+            debugMessage(this->_lastError, DEBUG_PWM);
+            return false;
+        }
+    }
+
+    // Pin idle level is driven by PORT while the output is disconnected
+    switch(channel_p) {
+    case Channel::OC0A_PD6:     ddr = &DDRD;    port = &PORTD;  bit = PD6;  break;
+    case Channel::OC0B_PD5:     ddr = &DDRD;    port = &PORTD;  bit = PD5;  break;
+    case Channel::OC1A_PB1:     ddr = &DDRB;    port = &PORTB;  bit = PB1;  break;
+    case Channel::OC1B_PB2:     ddr = &DDRB;    port = &PORTB;  bit = PB2;  break;
+    case Channel::OC2A_PB3:     ddr = &DDRB;    port = &PORTB;  bit = PB3;  break;
+    case Channel::OC2B_PD3:     ddr = &DDRD;    port = &PORTD;  bit = PD3;  break;
+    }
+    if(inverted_p) {
+        setBit(*port, bit);
+    } else {
+        clrBit(*port, bit);
+    }
+    setBit(*ddr, bit);
+
+    // Update data members
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_enabledMask |= channelMask(index);
+        if(inverted_p) {
+            this->_invertedMask |= channelMask(index);
+        } else {
+            this->_invertedMask &= ~channelMask(index);
+        }
+        // Channel starts at 0 duty cycle (disconnected)
+        this->_connectedMask &= ~channelMask(index);
+        this->_nextConnectedMask &= ~channelMask(index);
+        this->_stagedMask &= ~channelMask(index);
+        this->_pendingMask &= ~channelMask(index);
+        this->_applyOutputMode(timer);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return true;
+}
+
+bool_t Pwm::disable(const Channel channel_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::disable(const Channel)", DEBUG_PWM);
+
+    // Local variables
+    uint8_t index = (uint8_t)channel_p;
+    Timer timer = (Timer)(index / 2);
+
+    // Check for errors
+    if(index >= constNumberOfChannels) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PWM);
+        return false;
+    }
+
+    // Disconnect output and release channel
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        this->_enabledMask &= ~channelMask(index);
+        this->_connectedMask &= ~channelMask(index);
+        this->_nextConnectedMask &= ~channelMask(index);
+        this->_stagedMask &= ~channelMask(index);
+        this->_pendingMask &= ~channelMask(index);
+        this->_applyOutputMode(timer);
+        if(!this->_isTimerPending(timer)) {
+            this->_setOverflowInterrupt(timer, false);
+        }
+    }
+
+    // Stops the timer if none of its channels is in use
+    if(!(this->_enabledMask & timerChannelsMask(timer))) {
+        switch(timer) {
+        case Timer::TIMER0:
+            timer0.setClockSource(Timer0::ClockSource::DISABLED);
+            break;
+        case Timer::TIMER1:
+            timer1.setClockSource(Timer1::ClockSource::DISABLED);
+            break;
+        case Timer::TIMER2:
+            timer2.setClockSource(Timer2::ClockSource::DISABLED);
+            break;
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return true;
+}
+
+//     ///////////////////////     DUTY     /////////////////////////     //
+bool_t Pwm::stageDuty(const Channel channel_p, cuint16_t duty_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::stageDuty(const Channel, cuint16_t)", DEBUG_PWM);
+
+    // Local variables
+    uint8_t index = (uint8_t)channel_p;
+    uint16_t top = (index / 2 == (uint8_t)Timer::TIMER1) ? constTimer1Top : 0xFF;
+    uint32_t counts;
+
+    // Check for errors
+    if(index >= constNumberOfChannels) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PWM);
+        return false;
+    }
+    if(!(this->_enabledMask & channelMask(index))) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_PWM);
+        return false;
+    }
+
+    // Fast PWM output is high for (OCR + 1) counts, so a duty cycle that
+    // rounds to zero counts disconnects the output instead
+    counts = (((uint32_t)duty_p * (top + 1UL)) + 32767UL) / 65535UL;
+    if(counts == 0) {
+        this->_stagedOffMask |= channelMask(index);
+        this->_stagedValue[index] = 0;
+    } else {
+        this->_stagedOffMask &= ~channelMask(index);
+        this->_stagedValue[index] = (uint16_t)(counts - 1);
+    }
+    this->_stagedMask |= channelMask(index);
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return true;
+}
+
+void Pwm::commit(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::commit(void)", DEBUG_PWM);
+
+    // Local variables
+    uint8_t staged;
+
+    // Copies staged channels to the pending buffer, read only by the
+    // overflow handler, so later stageDuty() calls do not affect them
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        staged = this->_stagedMask & this->_enabledMask;
+        for(uint8_t i = 0; i < constNumberOfChannels; i++) {
+            if(staged & channelMask(i)) {
+                this->_pendingValue[i] = this->_stagedValue[i];
+            }
+        }
+        this->_pendingOffMask = (this->_pendingOffMask & ~staged) | (this->_stagedOffMask & staged);
+        this->_pendingMask |= staged;
+        this->_stagedMask = 0;
+        for(uint8_t i = 0; i < 3; i++) {
+            if(staged & timerChannelsMask(i)) {
+                this->_setOverflowInterrupt((Timer)i, true);
+            }
+        }
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return;
+}
+
+bool_t Pwm::setDuty(const Channel channel_p, cuint16_t duty_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::setDuty(const Channel, cuint16_t)", DEBUG_PWM);
+
+    // Stage and apply
+    if(!this->stageDuty(channel_p, duty_p)) {
+        // Returns error
+        debugMessage(this->_lastError, DEBUG_PWM);
+        return false;
+    }
+    this->commit();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return true;
+}
+
+bool_t Pwm::setDuty(const Channel *channels_p, cuint16_t *duties_p, cuint8_t size_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::setDuty(const Channel *, cuint16_t *, cuint8_t)", DEBUG_PWM);
+
+    // Check for errors
+    if(!isPointerValid(channels_p) || !isPointerValid(duties_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_PWM);
+        return false;
+    }
+    for(uint8_t i = 0; i < size_p; i++) {
+        if(((uint8_t)channels_p[i] >= constNumberOfChannels) ||
+                (!(this->_enabledMask & channelMask((uint8_t)channels_p[i])))) {
+            // Returns error
+            this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+            debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_PWM);
+            return false;
+        }
+    }
+
+    // Stage all and apply together
+    for(uint8_t i = 0; i < size_p; i++) {
+        this->stageDuty(channels_p[i], duties_p[i]);
+    }
+    this->commit();
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return true;
+}
+
+uint32_t Pwm::getFrequency(const Timer timer_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Pwm::getFrequency(const Timer)", DEBUG_PWM);
+
+    // Local variables
+    uint32_t frequency = 0;
+
+    // Evaluate frequency
+    switch(timer_p) {
+    case Timer::TIMER0:
+        frequency = F_CPU / (PWM_TIMER0_PRESCALER * 256UL);
+        break;
+    case Timer::TIMER1:
+        frequency = F_CPU / (PWM_TIMER1_PRESCALER * (constTimer1Top + 1UL));
+        break;
+    case Timer::TIMER2:
+        frequency = F_CPU / (PWM_TIMER2_PRESCALER * 256UL);
+        break;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_PWM);
+    return frequency;
+}
+
+//     //////////////////////     INTERRUPT     //////////////////////     //
+void Pwm::overflowHandler(const Timer timer_p)
+{
+    // Local variables
+    uint8_t channels = timerChannelsMask(timer_p);
+    uint8_t pending = this->_pendingMask & channels;
+
+    // Second step: the compare values written at the previous overflow are
+    // in use since the last BOTTOM, so the outputs are connected or
+    // disconnected now. A disconnected channel had its compare value set to
+    // 0, so its output is already back at the idle level (no glitch pulse),
+    // and a connected channel starts with its new duty cycle.
+    if((this->_nextConnectedMask ^ this->_connectedMask) & channels) {
+        this->_connectedMask = (this->_connectedMask & ~channels) | (this->_nextConnectedMask & channels);
+        this->_applyOutputMode(timer_p);
+    }
+
+    // First step: compare registers written here are latched by hardware at
+    // BOTTOM, so both channels of the timer change in the same period
+    for(uint8_t i = (uint8_t)timer_p * 2; i < ((uint8_t)timer_p * 2 + 2); i++) {
+        if(pending & channelMask(i)) {
+            if(this->_pendingOffMask & channelMask(i)) {
+                this->_writeCompare(i, 0);
+                this->_nextConnectedMask &= ~channelMask(i);
+            } else {
+                this->_writeCompare(i, this->_pendingValue[i]);
+                this->_nextConnectedMask |= channelMask(i);
+            }
+        }
+    }
+    this->_pendingMask &= ~pending;
+
+    // Keeps the interrupt until the output mode is updated
+    if(!this->_isTimerPending(timer_p)) {
+        this->_setOverflowInterrupt(timer_p, false);
+    }
+
+    return;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error Pwm::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+void Pwm::_applyOutputMode(const Timer timer_p)
+{
+    // Local variables
+    uint8_t modes[2];
+    uint8_t index = (uint8_t)timer_p * 2;
+
+    // Evaluate each channel mode
+    for(uint8_t i = 0; i < 2; i++) {
+        if(this->_connectedMask & this->_enabledMask & channelMask(index + i)) {
+            modes[i] = (this->_invertedMask & channelMask(index + i)) ? 3 : 2;
+        } else {
+            modes[i] = 0;
+        }
+    }
+
+    // Update timer
+    switch(timer_p) {
+    case Timer::TIMER0:
+        timer0.setOutputMode((Timer0::OutputMode)modes[0], (Timer0::OutputMode)modes[1]);
+        break;
+    case Timer::TIMER1:
+        timer1.setOutputMode((Timer1::OutputMode)modes[0], (Timer1::OutputMode)modes[1]);
+        break;
+    case Timer::TIMER2:
+        timer2.setOutputMode((Timer2::OutputMode)modes[0], (Timer2::OutputMode)modes[1]);
+        break;
+    }
+
+    return;
+}
+
+bool_t Pwm::_isTimerPending(const Timer timer_p)
+{
+    // Local variables
+    uint8_t channels = timerChannelsMask(timer_p);
+
+    return (bool_t)(((this->_pendingMask | (this->_nextConnectedMask ^ this->_connectedMask)) & channels) != 0);
+}
+
+void Pwm::_setOverflowInterrupt(const Timer timer_p, cbool_t enabled_p)
+{
+    switch(timer_p) {
+    case Timer::TIMER0:
+        if(enabled_p) {
+            timer0.activateOverflowInterrupt();
+        } else {
+            timer0.deactivateOverflowInterrupt();
+        }
+        break;
+    case Timer::TIMER1:
+        if(enabled_p) {
+            timer1.activateOverflowInterrupt();
+        } else {
+            timer1.deactivateOverflowInterrupt();
+        }
+        break;
+    case Timer::TIMER2:
+        if(enabled_p) {
+            timer2.activateOverflowInterrupt();
+        } else {
+            timer2.deactivateOverflowInterrupt();
+        }
+        break;
+    }
+
+    return;
+}
+
+void Pwm::_writeCompare(cuint8_t channel_p, cuint16_t value_p)
+{
+    switch((Channel)channel_p) {
+    case Channel::OC0A_PD6:
+        OCR0A = (uint8_t)value_p;
+        break;
+    case Channel::OC0B_PD5:
+        OCR0B = (uint8_t)value_p;
+        break;
+    case Channel::OC1A_PB1:
+        OCR1A = value_p;
+        break;
+    case Channel::OC1B_PB2:
+        OCR1B = value_p;
+        break;
+    case Channel::OC2A_PB3:
+        OCR2A = (uint8_t)value_p;
+        break;
+    case Channel::OC2B_PD3:
+        OCR2B = (uint8_t)value_p;
+        break;
+    }
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
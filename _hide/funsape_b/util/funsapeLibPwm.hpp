@@ -0,0 +1,443 @@
+//!
+//! \file           funsapeLibPwm.hpp
+//! \brief          Multi-channel PWM service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a PWM service over the six hardware PWM
+//!                     outputs (OC0A, OC0B, OC1A, OC1B, OC2A and OC2B). The
+//!                     mode and prescaler of each timer are chosen at compile
+//!                     time from the requested frequency. Duty cycle changes
+//!                     are staged and applied from the overflow interrupt, so
+//!                     all the channels of a timer change in the same period.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_PWM_HPP
+#define __FUNSAPE_LIB_PWM_HPP                   2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_PWM_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_PWM_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer0.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER0_HPP)
+#   error "Header file (funsapeLibTimer0.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER0_HPP != __FUNSAPE_LIB_PWM_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer0.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer1.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER1_HPP)
+#   error "Header file (funsapeLibTimer1.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER1_HPP != __FUNSAPE_LIB_PWM_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer1.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer2.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER2_HPP)
+#   error "Header file (funsapeLibTimer2.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER2_HPP != __FUNSAPE_LIB_PWM_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer2.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Pwm"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Pwm
+//! \brief          Multi-channel PWM service.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef PWM_TIMER0_FREQUENCY
+//!
+//! \brief          Requested PWM frequency of TIMER0 channels, in Hz.
+//! \details        TIMER0 runs in 8-bit fast PWM mode, so the closest
+//!                     frequency given by a prescaler is used.
+//!
+#   define PWM_TIMER0_FREQUENCY                 1000UL
+#endif
+
+#ifndef PWM_TIMER1_FREQUENCY
+//!
+//! \brief          Requested PWM frequency of TIMER1 channels, in Hz.
+//! \details        TIMER1 runs in fast PWM mode with TOP = ICR1, so the
+//!                     frequency is exact within one timer count.
+//!
+#   define PWM_TIMER1_FREQUENCY                 1000UL
+#endif
+
+#ifndef PWM_TIMER2_FREQUENCY
+//!
+//! \brief          Requested PWM frequency of TIMER2 channels, in Hz.
+//! \details        TIMER2 runs in 8-bit fast PWM mode, so the closest
+//!                     frequency given by a prescaler is used.
+//!
+#   define PWM_TIMER2_FREQUENCY                 1000UL
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Pwm Class
+// =============================================================================
+
+//!
+//! \brief          Pwm class.
+//! \details        This class allocates the hardware PWM outputs. The overflow
+//!                     callbacks of the used timers must be forwarded to the
+//!                     service:
+//! \code
+//!                 void timer1OverflowCallback(void)
+//!                 {
+//!                     pwm.overflowHandler(Pwm::Timer::TIMER1);
+//!                 }
+//! \endcode
+//!                 Duty cycles are given in 1/65535 units (0 is always low,
+//!                     65535 is always high).
+//! \warning        A timer used by the PWM service cannot be used by other
+//!                     services (e.g. SoftTimer on TIMER0 or TIMER2, Timestamp
+//!                     or InputCapture on TIMER1).
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class Pwm
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+
+    //     //////////////////////     CHANNEL     ///////////////////////     //
+    //!
+    //! \brief      PWM channel enumeration.
+    //! \details    Hardware PWM outputs and their pins (ATmega328P).
+    //! \warning    The value associate with the symbolic names may change
+    //!                 between builds and might not reflect the register/bits
+    //!                 real values. In order to ensure compatibility between
+    //!                 builds, always refer to the SYMBOLIC NAME, instead of
+    //!                 the VALUE.
+    //!
+    enum class Channel : uint8_t {
+        OC0A_PD6                        = 0,    //!< TIMER0 channel A, pin PD6.
+        OC0B_PD5                        = 1,    //!< TIMER0 channel B, pin PD5.
+        OC1A_PB1                        = 2,    //!< TIMER1 channel A, pin PB1.
+        OC1B_PB2                        = 3,    //!< TIMER1 channel B, pin PB2.
+        OC2A_PB3                        = 4,    //!< TIMER2 channel A, pin PB3.
+        OC2B_PD3                        = 5,    //!< TIMER2 channel B, pin PD3.
+    };
+
+    //     ///////////////////////     TIMER     ////////////////////////     //
+    //!
+    //! \brief      Timer enumeration.
+    //! \details    Timer whose overflow interrupt is being handled.
+    //!
+    enum class Timer : uint8_t {
+        TIMER0                          = 0,    //!< TIMER0 (channels OC0A and OC0B).
+        TIMER1                          = 1,    //!< TIMER1 (channels OC1A and OC1B).
+        TIMER2                          = 2,    //!< TIMER2 (channels OC2A and OC2B).
+    };
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      Pwm class constructor.
+    //! \details    Creates a Pwm object with every channel disabled.
+    //!
+    Pwm(
+            void
+    );
+
+    //!
+    //! \brief      Pwm class destructor.
+    //! \details    Destroys a Pwm object.
+    //!
+    ~Pwm(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     //////////////////////     CHANNEL     ///////////////////////     //
+    //!
+    //! \brief      Enables a PWM channel.
+    //! \details    Allocates the channel pin as output and starts its timer
+    //!                 at the compile-time configured frequency, if not
+    //!                 running yet. The channel starts with 0 duty cycle.
+    //! \param[in]  channel_p           PWM channel.
+    //! \param[in]  inverted_p          Inverts the output polarity.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t enable(
+            const Channel channel_p,
+            cbool_t inverted_p                  = false
+    );
+
+    //!
+    //! \brief      Disables a PWM channel.
+    //! \details    Releases the channel pin, that returns to its idle level.
+    //!                 The timer is stopped when both its channels are
+    //!                 disabled.
+    //! \param[in]  channel_p           PWM channel.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t disable(
+            const Channel channel_p
+    );
+
+    //     ///////////////////////     DUTY     /////////////////////////     //
+    //!
+    //! \brief      Stages a duty cycle change.
+    //! \details    Stages a duty cycle change. The change is applied only
+    //!                 after \ref commit() is called, so several channels can
+    //!                 be updated together.
+    //! \param[in]  channel_p           PWM channel.
+    //! \param[in]  duty_p              Duty cycle (0 to 65535).
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t stageDuty(
+            const Channel channel_p,
+            cuint16_t duty_p
+    );
+
+    //!
+    //! \brief      Applies the staged duty cycles.
+    //! \details    Applies every staged duty cycle at the next overflow of
+    //!                 each involved timer. The committed values are copied,
+    //!                 so later calls to \ref stageDuty() do not change them.
+    //!                 A channel that is connected or disconnected takes one
+    //!                 more period, so that the output mode changes at the
+    //!                 same boundary as the compare value.
+    //!
+    void commit(
+            void
+    );
+
+    //!
+    //! \brief      Sets the duty cycle of one channel.
+    //! \details    Same as \ref stageDuty() followed by \ref commit().
+    //! \param[in]  channel_p           PWM channel.
+    //! \param[in]  duty_p              Duty cycle (0 to 65535).
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t setDuty(
+            const Channel channel_p,
+            cuint16_t duty_p
+    );
+
+    //!
+    //! \brief      Sets the duty cycle of several channels.
+    //! \details    Stages every given duty cycle and commits them together,
+    //!                 so they are applied in the same PWM period. Nothing is
+    //!                 changed if any argument is invalid.
+    //! \param[in]  channels_p          Array of PWM channels.
+    //! \param[in]  duties_p            Array of duty cycles (0 to 65535).
+    //! \param[in]  size_p              Number of elements of the arrays.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t setDuty(
+            const Channel *channels_p,
+            cuint16_t *duties_p,
+            cuint8_t size_p
+    );
+
+    //!
+    //! \brief      Checks if there are duty cycles waiting to be applied.
+    //! \details    Checks if there are committed duty cycles or output mode
+    //!                 changes waiting for the timer overflow.
+    //! \retval     true                Update pending.
+    //! \retval     false               All updates applied.
+    //!
+    bool_t inlined isUpdatePending(
+            void
+    );
+
+    //!
+    //! \brief      Returns the actual PWM frequency.
+    //! \details    Returns the actual PWM frequency of a timer, in Hz.
+    //! \param[in]  timer_p             Timer.
+    //! \return     uint32_t            Frequency, in Hz.
+    //!
+    uint32_t getFrequency(
+            const Timer timer_p
+    );
+
+    //     //////////////////////     INTERRUPT     //////////////////////     //
+    //!
+    //! \brief      Applies committed duty cycles.
+    //! \details    Must be called from the overflow interrupt callback of
+    //!                 each timer used by the service.
+    //! \param[in]  timer_p             Timer whose overflow is handled.
+    //!
+    void overflowHandler(
+            const Timer timer_p
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    void _applyOutputMode(
+            const Timer timer_p
+    );
+    bool_t _isTimerPending(
+            const Timer timer_p
+    );
+    void _setOverflowInterrupt(
+            const Timer timer_p,
+            cbool_t enabled_p
+    );
+    void _writeCompare(
+            cuint8_t channel_p,
+            cuint16_t value_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    uint16_t        _stagedValue[6];
+    uint8_t         _stagedMask;
+    uint8_t         _stagedOffMask;
+    uint16_t        _pendingValue[6];
+    vuint8_t        _pendingMask;
+    uint8_t         _pendingOffMask;
+    uint8_t         _enabledMask;
+    uint8_t         _invertedMask;
+    vuint8_t        _connectedMask;
+    vuint8_t        _nextConnectedMask;
+    Error           _lastError;
+}; // class Pwm
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+bool_t inlined Pwm::isUpdatePending(void)
+{
+    return (bool_t)((this->_pendingMask | (this->_nextConnectedMask ^ this->_connectedMask)) != 0);
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          Pwm service handler object.
+//! \details        Pwm service handler object.
+//! \warning        Use this object to handle the service. DO NOT create
+//!                     another instance of the class.
+//!
+extern Pwm pwm;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Pwm"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_PWM_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
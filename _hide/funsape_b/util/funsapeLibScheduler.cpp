@@ -0,0 +1,261 @@
+//!
+//! \file           funsapeLibScheduler.cpp
+//! \brief          Cooperative task scheduler for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Cooperative task scheduler for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibScheduler.hpp"
+#if !defined(__FUNSAPE_LIB_SCHEDULER_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_SCHEDULER_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <avr/sleep.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_SCHEDULER                 0x3BFF
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+Scheduler scheduler;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+TaskContext::TaskContext()
+{
+    // Reset data members
+    this->line                          = 0;
+    this->wakeTime                      = 0;
+
+    return;
+}
+
+Scheduler::Scheduler()
+{
+    // Mark passage for debugging purpose
+    debugMark("Scheduler::Scheduler(void)", DEBUG_SCHEDULER);
+
+    // Reset data members
+    for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        this->_task[i]                  = nullptr;
+        this->_context[i]               = nullptr;
+    }
+    this->_taskCount                    = 0;
+    this->_idleSleep                    = true;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SCHEDULER);
+    return;
+}
+
+Scheduler::~Scheduler()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_SCHEDULER);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ////////////////////     TASK CONTROL    /////////////////////     //
+bool_t Scheduler::addTask(schedulerTask_t task_p, void *context_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Scheduler::addTask(schedulerTask_t, void *)", DEBUG_SCHEDULER);
+
+    // Checks for errors
+    if(!isPointerValid(task_p)) {
+        // Returns error
+        this->_lastError = Error::FUNCTION_POINTER_NULL;
+        debugMessage(Error::FUNCTION_POINTER_NULL, DEBUG_SCHEDULER);
+        return false;
+    }
+    if(this->_taskCount >= SCHEDULER_MAX_TASKS) {
+        // Returns error
+        this->_lastError = Error::BUFFER_FULL;
+        debugMessage(Error::BUFFER_FULL, DEBUG_SCHEDULER);
+        return false;
+    }
+
+    // Register task
+    this->_task[this->_taskCount]       = task_p;
+    this->_context[this->_taskCount]    = context_p;
+    this->_taskCount++;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SCHEDULER);
+    return true;
+}
+
+bool_t Scheduler::removeTask(schedulerTask_t task_p, void *context_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("Scheduler::removeTask(schedulerTask_t, void *)", DEBUG_SCHEDULER);
+
+    // Search task
+    for(uint8_t i = 0; i < this->_taskCount; i++) {
+        if((this->_task[i] == task_p) && (this->_context[i] == context_p)) {
+            this->_removeSlot(i);
+
+            // Returns successfully
+            this->_lastError = Error::NONE;
+            debugMessage(Error::NONE, DEBUG_SCHEDULER);
+            return true;
+        }
+    }
+
+    // Returns error
+    this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+    debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_SCHEDULER);
+    return false;
+}
+
+//     /////////////////////     EXECUTION     //////////////////////     //
+uint8_t Scheduler::runOnce(void)
+{
+    // Local variables
+    uint8_t busyCounter = 0;
+    uint8_t i = 0;
+
+    // Run tasks
+    while(i < this->_taskCount) {
+        switch(this->_task[i](this->_context[i])) {
+        case TaskStatus::YIELDED:
+            busyCounter++;
+            i++;
+            break;
+        case TaskStatus::ENDED:
+            // Next task is moved to this position; removed by slot, since
+            // the same task may be registered more than once
+            this->_removeSlot(i);
+            break;
+        case TaskStatus::WAITING:
+        default:
+            i++;
+            break;
+        }
+    }
+
+    // Returns number of busy tasks
+    return busyCounter;
+}
+
+bool_t Scheduler::run(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Scheduler::run(void)", DEBUG_SCHEDULER);
+
+    // Local variables
+    uint8_t busyCounter = 0;
+
+    // Check for errors - No tick source
+    if(!softTimer.isInitialized()) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_SCHEDULER);
+        return false;
+    }
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    while(1) {
+        busyCounter = this->runOnce();
+        busyCounter += softTimer.processDeferred();
+        if((busyCounter == 0) && (this->_idleSleep) && isBitSet(SREG, SREG_I)) {
+            // Every task is waiting; the next interrupt wakes the CPU up. A
+            // deferred timer expiring right before sleeping is executed
+            // after the next interrupt, at most one tick later. With the
+            // global interrupts disabled nothing would wake it up.
+            sleep_mode();
+        }
+    }
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error Scheduler::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+void Scheduler::_removeSlot(cuint8_t slot_p)
+{
+    // Keep the round-robin order
+    for(uint8_t j = slot_p; j < (this->_taskCount - 1); j++) {
+        this->_task[j]                  = this->_task[j + 1];
+        this->_context[j]               = this->_context[j + 1];
+    }
+    this->_taskCount--;
+    this->_task[this->_taskCount]       = nullptr;
+    this->_context[this->_taskCount]    = nullptr;
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
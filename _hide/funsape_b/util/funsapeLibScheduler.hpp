@@ -0,0 +1,416 @@
+//!
+//! \file           funsapeLibScheduler.hpp
+//! \brief          Cooperative task scheduler for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a lightweight stackless cooperative
+//!                     scheduler. Tasks are plain functions written as
+//!                     protothreads: they keep their resume point in a
+//!                     \ref TaskContext object and give the CPU back with the
+//!                     \ref taskYield(), \ref taskWaitUntil() and
+//!                     \ref taskSleepFor() macros, instead of busy-waiting.
+//!                     The time base is the \ref SoftTimer service tick.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_SCHEDULER_HPP
+#define __FUNSAPE_LIB_SCHEDULER_HPP             2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_SCHEDULER_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_SCHEDULER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../util/funsapeLibSoftTimer.hpp"
+#if !defined(__FUNSAPE_LIB_SOFT_TIMER_HPP)
+#   error "Header file (funsapeLibSoftTimer.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_SOFT_TIMER_HPP != __FUNSAPE_LIB_SCHEDULER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibSoftTimer.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Scheduler"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Scheduler
+//! \brief          Cooperative task scheduler.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef SCHEDULER_MAX_TASKS
+//!
+//! \brief          Maximum number of tasks.
+//! \details        Maximum number of tasks that can be registered at the same
+//!                     time in the scheduler.
+//!
+#   define SCHEDULER_MAX_TASKS                  8
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+//!
+//! \brief          Task status enumeration.
+//! \details        Value returned by a task each time it runs.
+//!
+enum class TaskStatus : uint8_t {
+    WAITING                             = 0,    //!< Task is blocked waiting for a condition or a timeout.
+    YIELDED                             = 1,    //!< Task did some work and wants to run again as soon as possible.
+    ENDED                               = 2,    //!< Task has finished and will be removed from the scheduler.
+};
+
+//!
+//! \brief          Scheduler task function type.
+//! \details        Function executed by the scheduler. The \a context_p
+//!                     pointer is the one given when the task was added.
+//!
+typedef TaskStatus (*schedulerTask_t)(void *context_p);
+
+//!
+//! \brief          Protothread context.
+//! \details        Holds the resume point and the wake up time of a
+//!                     protothread. Local variables of a task are not
+//!                     preserved between calls, so any state that must survive
+//!                     a \ref taskYield(), \ref taskWaitUntil() or
+//!                     \ref taskSleepFor() must be kept in static variables or
+//!                     in class members.
+//!
+class TaskContext
+{
+public:
+    //!
+    //! \brief      TaskContext class constructor.
+    //! \details    Creates a TaskContext object at the start of the task.
+    //!
+    TaskContext(
+            void
+    );
+
+    //!
+    //! \brief      Restarts the task.
+    //! \details    Makes the task run from the beginning the next time it is
+    //!                 called.
+    //!
+    void inlined restart(
+            void
+    );
+
+    //!
+    //! \brief      Checks if the wake up time was reached.
+    //! \details    Checks if the wake up time was reached. The comparison
+    //!                 handles the tick counter wrap-around.
+    //! \retval     true                Wake up time reached.
+    //! \retval     false               Still sleeping.
+    //!
+    bool_t inlined isAwake(
+            void
+    );
+
+    uint16_t        line;               //!< Resume point (source line), 0 means start.
+    uint32_t        wakeTime;           //!< Wake up time, in SoftTimer ticks.
+}; // class TaskContext
+
+// =============================================================================
+// Macro-functions
+// =============================================================================
+
+//!
+//! \brief          Converts milliseconds into scheduler ticks.
+//! \details        Converts milliseconds into scheduler ticks, rounding up.
+//!
+#define schedulerMsToTicks(ms)          ((uint32_t)((((uint32_t)(ms)) * SOFT_TIMER_TICK_FREQUENCY + 999UL) / 1000UL))
+
+//!
+//! \brief          Starts a protothread body.
+//! \details        Must be the first statement of the task function.
+//!
+#define taskBegin(context)              switch((context)->line) { case 0:
+
+//!
+//! \brief          Ends a protothread body.
+//! \details        Must be the last statement of the task function. The task
+//!                     returns TaskStatus::ENDED and will restart from the
+//!                     beginning on the next call.
+//!
+#define taskEnd(context)                } (context)->line = 0; return TaskStatus::ENDED
+
+//!
+//! \brief          Gives the CPU back to the scheduler.
+//! \details        The task is resumed after this point on the next call.
+//!
+#define taskYield(context)              do { (context)->line = __LINE__; return TaskStatus::YIELDED; case __LINE__:; } while(0)
+
+//!
+//! \brief          Blocks the task until a condition is true.
+//! \details        The condition is evaluated on every call; the task returns
+//!                     TaskStatus::WAITING while it is false.
+//!
+#define taskWaitUntil(context, condition)   do { (context)->line = __LINE__; case __LINE__: if(!(condition)) { return TaskStatus::WAITING; } } while(0)
+
+//!
+//! \brief          Blocks the task for a number of ticks.
+//! \details        Blocks the task for at least \a ticks SoftTimer ticks.
+//!
+#define taskSleepFor(context, ticks)    do { (context)->wakeTime = softTimer.getTicks() + (ticks); taskWaitUntil((context), (context)->isAwake()); } while(0)
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Scheduler Class
+// =============================================================================
+
+//!
+//! \brief          Scheduler class.
+//! \details        This class runs the registered tasks in round-robin order.
+//!                     When every task is waiting, the CPU is put in idle
+//!                     sleep mode until the next interrupt (usually the
+//!                     SoftTimer tick).
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class Scheduler
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      Scheduler class constructor.
+    //! \details    Creates a Scheduler object with no tasks.
+    //!
+    Scheduler(
+            void
+    );
+
+    //!
+    //! \brief      Scheduler class destructor.
+    //! \details    Destroys a Scheduler object.
+    //!
+    ~Scheduler(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ////////////////////     TASK CONTROL    /////////////////////     //
+    //!
+    //! \brief      Registers a task.
+    //! \details    Registers a task to be executed by the scheduler.
+    //! \param[in]  task_p              Task function.
+    //! \param[in]  context_p           Pointer passed to the task.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t addTask(
+            schedulerTask_t task_p,
+            void *context_p                     = nullptr
+    );
+
+    //!
+    //! \brief      Removes a task.
+    //! \details    Removes a task previously registered with the same
+    //!                 function and context.
+    //! \param[in]  task_p              Task function.
+    //! \param[in]  context_p           Pointer passed to the task.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t removeTask(
+            schedulerTask_t task_p,
+            void *context_p                     = nullptr
+    );
+
+    //     /////////////////////     EXECUTION     //////////////////////     //
+    //!
+    //! \brief      Runs every task once.
+    //! \details    Runs every registered task once. Tasks that return
+    //!                 TaskStatus::ENDED are removed.
+    //! \return     uint8_t             Number of tasks that yielded.
+    //!
+    uint8_t runOnce(
+            void
+    );
+
+    //!
+    //! \brief      Runs the scheduler forever.
+    //! \details    Runs the scheduler forever, executing the deferred soft
+    //!                 timer callbacks after each round, and putting the CPU
+    //!                 in idle sleep mode whenever no task yielded and no
+    //!                 callback was executed in a round.
+    //!             The tick source must be running: the SoftTimer must be
+    //!                 initialized, or the function returns at once, and the
+    //!                 CPU only sleeps while the global interrupts are
+    //!                 enabled. With TickSource::EXTERNAL, the application
+    //!                 interrupt must call softTimer.tick(); otherwise the
+    //!                 sleeping tasks never wake up and the CPU only leaves
+    //!                 idle sleep on other interrupts.
+    //! \retval     false               SoftTimer not initialized. Retrieve
+    //!                                     the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t run(
+            void
+    );
+
+    //!
+    //! \brief      Enables or disables idle sleep.
+    //! \details    Enables or disables the idle sleep in \ref run().
+    //! \param[in]  enabled_p           true to sleep when idle.
+    //!
+    void inlined setIdleSleep(
+            cbool_t enabled_p
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    void _removeSlot(
+            cuint8_t slot_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    schedulerTask_t _task[SCHEDULER_MAX_TASKS];
+    void            *_context[SCHEDULER_MAX_TASKS];
+    uint8_t         _taskCount;
+    bool_t          _idleSleep          : 1;
+    Error           _lastError;
+}; // class Scheduler
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+void inlined TaskContext::restart(void)
+{
+    this->line = 0;
+    return;
+}
+
+bool_t inlined TaskContext::isAwake(void)
+{
+    return (bool_t)((int32_t)(softTimer.getTicks() - this->wakeTime) >= 0);
+}
+
+void inlined Scheduler::setIdleSleep(cbool_t enabled_p)
+{
+    this->_idleSleep = enabled_p;
+    return;
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          Scheduler handler object.
+//! \details        Scheduler handler object.
+//! \warning        Use this object to run the tasks. DO NOT create another
+//!                     instance of the class.
+//!
+extern Scheduler scheduler;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Scheduler"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_SCHEDULER_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,552 @@
+//!
+//! \file           funsapeLibSoftTimer.cpp
+//! \brief          Software timer service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Software timer service for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibSoftTimer.hpp"
+#if !defined(__FUNSAPE_LIB_SOFT_TIMER_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_SOFT_TIMER_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <util/atomic.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_SOFT_TIMER                0x3AFF
+
+cuint8_t constNoTimer                   = 0xFF;     //!< Empty list marker
+cuint8_t constWheelMask                 = (SOFT_TIMER_WHEEL_SIZE - 1);  //!< Wheel slot index mask
+cuint16_t constMaxRounds                = 0xFFFF;   //!< Maximum number of wheel turns
+
+// Smallest prescaler available on both TIMER0 and TIMER2 that fits an 8-bit
+// compare value
+#if (F_CPU / (8UL * SOFT_TIMER_TICK_FREQUENCY)) <= 256
+#   define SOFT_TIMER_PRESCALER         8UL
+#   define SOFT_TIMER0_CLOCK_SOURCE     Timer0::ClockSource::PRESCALER_8
+#   define SOFT_TIMER2_CLOCK_SOURCE     Timer2::ClockSource::PRESCALER_8
+#elif (F_CPU / (64UL * SOFT_TIMER_TICK_FREQUENCY)) <= 256
+#   define SOFT_TIMER_PRESCALER         64UL
+#   define SOFT_TIMER0_CLOCK_SOURCE     Timer0::ClockSource::PRESCALER_64
+#   define SOFT_TIMER2_CLOCK_SOURCE     Timer2::ClockSource::PRESCALER_64
+#elif (F_CPU / (256UL * SOFT_TIMER_TICK_FREQUENCY)) <= 256
+#   define SOFT_TIMER_PRESCALER         256UL
+#   define SOFT_TIMER0_CLOCK_SOURCE     Timer0::ClockSource::PRESCALER_256
+#   define SOFT_TIMER2_CLOCK_SOURCE     Timer2::ClockSource::PRESCALER_256
+#else
+#   define SOFT_TIMER_PRESCALER         1024UL
+#   define SOFT_TIMER0_CLOCK_SOURCE     Timer0::ClockSource::PRESCALER_1024
+#   define SOFT_TIMER2_CLOCK_SOURCE     Timer2::ClockSource::PRESCALER_1024
+#endif
+
+cuint8_t constTickCompareValue          = (uint8_t)((F_CPU / (SOFT_TIMER_PRESCALER * SOFT_TIMER_TICK_FREQUENCY)) - 1);  //!< Compare A value of the tick
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+SoftTimer softTimer;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+#define timerMask(index)                ((uint32_t)1 << (index))
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+SoftTimer::SoftTimer()
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::SoftTimer(void)", DEBUG_SOFT_TIMER);
+
+    // Reset data members
+    for(uint8_t i = 0; i < SOFT_TIMER_MAX_TIMERS; i++) {
+        this->_callback[i]              = nullptr;
+        this->_context[i]               = nullptr;
+        this->_period[i]                = 0;
+        this->_rounds[i]                = 0;
+        this->_next[i]                  = constNoTimer;
+        this->_previous[i]              = constNoTimer;
+        this->_slot[i]                  = 0;
+    }
+    for(uint8_t i = 0; i < SOFT_TIMER_WHEEL_SIZE; i++) {
+        this->_wheel[i]                 = constNoTimer;
+    }
+    this->_allocatedMask                = 0;
+    this->_runningMask                  = 0;
+    this->_periodicMask                 = 0;
+    this->_deferredMask                 = 0;
+    this->_pendingMask                  = 0;
+    this->_cursor                       = 0;
+    this->_ticks                        = 0;
+    this->_isInitialized                = false;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return;
+}
+
+SoftTimer::~SoftTimer()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ///////////////////     INITIALIZATION    ////////////////////     //
+bool_t SoftTimer::init(const TickSource tickSource_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::init(const TickSource)", DEBUG_SOFT_TIMER);
+
+    // Release all timers
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        for(uint8_t i = 0; i < SOFT_TIMER_MAX_TIMERS; i++) {
+            this->_callback[i]          = nullptr;
+            this->_context[i]           = nullptr;
+            this->_next[i]              = constNoTimer;
+            this->_previous[i]          = constNoTimer;
+        }
+        for(uint8_t i = 0; i < SOFT_TIMER_WHEEL_SIZE; i++) {
+            this->_wheel[i]             = constNoTimer;
+        }
+        this->_allocatedMask            = 0;
+        this->_runningMask              = 0;
+        this->_periodicMask             = 0;
+        this->_deferredMask             = 0;
+        this->_pendingMask              = 0;
+        this->_cursor                   = 0;
+        this->_ticks                    = 0;
+    }
+
+    // Configure hardware tick
+    switch(tickSource_p) {
+    case TickSource::EXTERNAL:
+        break;
+    case TickSource::TIMER0:
+        if(!timer0.init(Timer0::Mode::CTC_OCRA, SOFT_TIMER0_CLOCK_SOURCE)) {
+            // Returns error
+            this->_isInitialized = false;
+            this->_lastError = timer0.getLastError();
+            debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+            return false;
+        }
+        timer0.setCompareAValue(constTickCompareValue);
+        timer0.clearCompareAInterruptRequest();
+        timer0.activateCompareAInterrupt();
+        break;
+    case TickSource::TIMER2:
+        if(!timer2.init(Timer2::Mode::CTC_OCRA, SOFT_TIMER2_CLOCK_SOURCE)) {
+            // Returns error
+            this->_isInitialized = false;
+            this->_lastError = timer2.getLastError();
+            debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+            return false;
+        }
+        timer2.setCompareAValue(constTickCompareValue);
+        timer2.clearCompareAInterruptRequest();
+        timer2.activateCompareAInterrupt();
+        break;
+    default:
+        // Returns error
+        this->_isInitialized = false;
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // Update data members
+    this->_isInitialized = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return true;
+}
+
+//     ////////////////////     TIMER CONTROL    ////////////////////     //
+bool_t SoftTimer::create(handle_t *handle_p, softTimerCallback_t callback_p, void *context_p, const Mode mode_p,
+        const Dispatch dispatch_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::create(handle_t *, softTimerCallback_t, void *, const Mode, const Dispatch)", DEBUG_SOFT_TIMER);
+
+    // Local variables
+    uint8_t index = constNoTimer;
+
+    // Checks for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        debugMessage(Error::NOT_INITIALIZED, DEBUG_SOFT_TIMER);
+        return false;
+    }
+    if(!isPointerValid(handle_p)) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_POINTER_NULL;
+        debugMessage(Error::ARGUMENT_POINTER_NULL, DEBUG_SOFT_TIMER);
+        return false;
+    }
+    if(!isPointerValid(callback_p)) {
+        // Returns error
+        this->_lastError = Error::FUNCTION_POINTER_NULL;
+        debugMessage(Error::FUNCTION_POINTER_NULL, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // Allocate a free slot
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        for(uint8_t i = 0; i < SOFT_TIMER_MAX_TIMERS; i++) {
+            if(!(this->_allocatedMask & timerMask(i))) {
+                index = i;
+                break;
+            }
+        }
+        if(index != constNoTimer) {
+            this->_callback[index]      = callback_p;
+            this->_context[index]       = context_p;
+            this->_period[index]        = 0;
+            this->_allocatedMask        |= timerMask(index);
+            if(mode_p == Mode::PERIODIC) {
+                this->_periodicMask     |= timerMask(index);
+            } else {
+                this->_periodicMask     &= ~timerMask(index);
+            }
+            if(dispatch_p == Dispatch::DEFERRED) {
+                this->_deferredMask     |= timerMask(index);
+            } else {
+                this->_deferredMask     &= ~timerMask(index);
+            }
+        }
+    }
+    if(index == constNoTimer) {
+        // Returns error
+        this->_lastError = Error::BUFFER_FULL;
+        debugMessage(Error::BUFFER_FULL, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // Update handle
+    *handle_p = index;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return true;
+}
+
+bool_t SoftTimer::destroy(const handle_t handle_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::destroy(const handle_t)", DEBUG_SOFT_TIMER);
+
+    // Checks for errors
+    if(!this->_isHandleValid(handle_p)) {
+        // Returns error
+        debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // Release timer
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(this->_runningMask & timerMask(handle_p)) {
+            this->_unlink(handle_p);
+        }
+        this->_runningMask              &= ~timerMask(handle_p);
+        this->_pendingMask              &= ~timerMask(handle_p);
+        this->_allocatedMask            &= ~timerMask(handle_p);
+        this->_callback[handle_p]       = nullptr;
+        this->_context[handle_p]        = nullptr;
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return true;
+}
+
+bool_t SoftTimer::start(const handle_t handle_p, cuint32_t ticks_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::start(const handle_t, cuint32_t)", DEBUG_SOFT_TIMER);
+
+    // Local variables
+    uint32_t ticks = (ticks_p == 0) ? 1 : ticks_p;
+
+    // Checks for errors
+    if(!this->_isHandleValid(handle_p)) {
+        // Returns error
+        debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+        return false;
+    }
+    if(((ticks - 1) / SOFT_TIMER_WHEEL_SIZE) > constMaxRounds) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        debugMessage(Error::ARGUMENT_VALUE_INVALID, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // (Re)start timer
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(this->_runningMask & timerMask(handle_p)) {
+            this->_unlink(handle_p);
+        }
+        this->_pendingMask              &= ~timerMask(handle_p);
+        this->_period[handle_p]         = ticks;
+        this->_link(handle_p, ticks);
+        this->_runningMask              |= timerMask(handle_p);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return true;
+}
+
+bool_t SoftTimer::stop(const handle_t handle_p)
+{
+    // Mark passage for debugging purpose
+    debugMark("SoftTimer::stop(const handle_t)", DEBUG_SOFT_TIMER);
+
+    // Checks for errors
+    if(!this->_isHandleValid(handle_p)) {
+        // Returns error
+        debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    // Stop timer
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(this->_runningMask & timerMask(handle_p)) {
+            this->_unlink(handle_p);
+        }
+        this->_runningMask              &= ~timerMask(handle_p);
+        this->_pendingMask              &= ~timerMask(handle_p);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_SOFT_TIMER);
+    return true;
+}
+
+bool_t SoftTimer::isRunning(const handle_t handle_p)
+{
+    // Local variables
+    bool_t aux = false;
+
+    // Checks for errors
+    if(!this->_isHandleValid(handle_p)) {
+        // Returns error
+        debugMessage(this->_lastError, DEBUG_SOFT_TIMER);
+        return false;
+    }
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        aux = (bool_t)((this->_runningMask & timerMask(handle_p)) != 0);
+    }
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    return aux;
+}
+
+//     /////////////////////     EXECUTION     //////////////////////     //
+uint8_t SoftTimer::processDeferred(void)
+{
+    // Local variables
+    uint32_t pending = 0;
+    uint8_t counter = 0;
+    softTimerCallback_t callback = nullptr;
+    void *context = nullptr;
+
+    // Fetch and clear pending calls
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        pending = this->_pendingMask;
+        this->_pendingMask = 0;
+    }
+
+    // Execute callbacks
+    for(uint8_t i = 0; (i < SOFT_TIMER_MAX_TIMERS) && (pending != 0); i++, pending >>= 1) {
+        if(!(pending & 0x01)) {
+            continue;
+        }
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            callback = this->_callback[i];
+            context = this->_context[i];
+        }
+        if(isPointerValid(callback)) {
+            callback(context);
+            counter++;
+        }
+    }
+
+    // Returns number of callbacks executed
+    return counter;
+}
+
+void SoftTimer::tick(void)
+{
+    // Local variables
+    uint32_t expired = 0;
+    uint8_t index;
+    uint8_t next;
+
+    // Advance wheel
+    this->_ticks++;
+    this->_cursor = (this->_cursor + 1) & constWheelMask;
+
+    // Walk current slot
+    index = this->_wheel[this->_cursor];
+    while(index != constNoTimer) {
+        next = this->_next[index];
+        if(this->_rounds[index] > 0) {
+            this->_rounds[index]--;
+        } else {
+            this->_unlink(index);
+            if(this->_periodicMask & timerMask(index)) {
+                this->_link(index, this->_period[index]);
+            } else {
+                this->_runningMask &= ~timerMask(index);
+            }
+            if(this->_deferredMask & timerMask(index)) {
+                this->_pendingMask |= timerMask(index);
+            } else {
+                expired |= timerMask(index);
+            }
+        }
+        index = next;
+    }
+
+    // Execute ISR context callbacks after the wheel is consistent
+    for(uint8_t i = 0; (i < SOFT_TIMER_MAX_TIMERS) && (expired != 0); i++, expired >>= 1) {
+        if((expired & 0x01) && isPointerValid(this->_callback[i])) {
+            this->_callback[i](this->_context[i]);
+        }
+    }
+
+    return;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error SoftTimer::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+bool_t SoftTimer::_isHandleValid(const handle_t handle_p)
+{
+    // Checks for errors
+    if(!this->_isInitialized) {
+        // Returns error
+        this->_lastError = Error::NOT_INITIALIZED;
+        return false;
+    }
+    if((handle_p >= SOFT_TIMER_MAX_TIMERS) || (!(this->_allocatedMask & timerMask(handle_p)))) {
+        // Returns error
+        this->_lastError = Error::ARGUMENT_VALUE_INVALID;
+        return false;
+    }
+
+    // Returns successfully
+    return true;
+}
+
+void SoftTimer::_link(cuint8_t index_p, cuint32_t ticks_p)
+{
+    // Local variables
+    uint8_t slot = (uint8_t)((this->_cursor + ticks_p) & constWheelMask);
+
+    // Insert at slot list head
+    this->_rounds[index_p]              = (uint16_t)((ticks_p - 1) / SOFT_TIMER_WHEEL_SIZE);
+    this->_slot[index_p]                = slot;
+    this->_previous[index_p]            = constNoTimer;
+    this->_next[index_p]                = this->_wheel[slot];
+    if(this->_wheel[slot] != constNoTimer) {
+        this->_previous[this->_wheel[slot]] = index_p;
+    }
+    this->_wheel[slot]                  = index_p;
+
+    return;
+}
+
+void SoftTimer::_unlink(cuint8_t index_p)
+{
+    // Remove from slot list
+    if(this->_previous[index_p] != constNoTimer) {
+        this->_next[this->_previous[index_p]] = this->_next[index_p];
+    } else {
+        this->_wheel[this->_slot[index_p]] = this->_next[index_p];
+    }
+    if(this->_next[index_p] != constNoTimer) {
+        this->_previous[this->_next[index_p]] = this->_previous[index_p];
+    }
+    this->_next[index_p]                = constNoTimer;
+    this->_previous[index_p]            = constNoTimer;
+
+    return;
+}
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
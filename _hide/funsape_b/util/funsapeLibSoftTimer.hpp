@@ -0,0 +1,485 @@
+//!
+//! \file           funsapeLibSoftTimer.hpp
+//! \brief          Software timer service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a software timer service that multiplexes
+//!                     many virtual timers on a single hardware tick (TIMER0 or
+//!                     TIMER2 compare match). The timers are kept in a hashed
+//!                     timing wheel, so starting, stopping and expiring a timer
+//!                     are constant time operations.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_SOFT_TIMER_HPP
+#define __FUNSAPE_LIB_SOFT_TIMER_HPP            2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_SOFT_TIMER_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_SOFT_TIMER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer0.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER0_HPP)
+#   error "Header file (funsapeLibTimer0.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER0_HPP != __FUNSAPE_LIB_SOFT_TIMER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer0.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer2.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER2_HPP)
+#   error "Header file (funsapeLibTimer2.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER2_HPP != __FUNSAPE_LIB_SOFT_TIMER_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer2.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Soft_Timer"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Soft_Timer
+//! \brief          Software timer service.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef SOFT_TIMER_MAX_TIMERS
+//!
+//! \brief          Maximum number of virtual timers.
+//! \details        Maximum number of virtual timers that can be allocated at
+//!                     the same time. Can be overridden at compile time, but
+//!                     must not exceed 32.
+//!
+#   define SOFT_TIMER_MAX_TIMERS                16
+#endif
+
+#ifndef SOFT_TIMER_WHEEL_SIZE
+//!
+//! \brief          Number of slots in the timing wheel.
+//! \details        Number of slots in the timing wheel. Must be a power of
+//!                     two. Larger wheels make long timers cheaper to skip
+//!                     during the tick, at the cost of one byte per slot.
+//!
+#   define SOFT_TIMER_WHEEL_SIZE                16
+#endif
+
+#ifndef SOFT_TIMER_TICK_FREQUENCY
+//!
+//! \brief          Tick frequency, in Hz.
+//! \details        Frequency of the hardware tick when the service configures
+//!                     TIMER0 or TIMER2 by itself.
+//!
+#   define SOFT_TIMER_TICK_FREQUENCY            1000UL
+#endif
+
+#if (SOFT_TIMER_MAX_TIMERS == 0) || (SOFT_TIMER_MAX_TIMERS > 32)
+#   error "SOFT_TIMER_MAX_TIMERS must be between 1 and 32!"
+#endif
+#if (SOFT_TIMER_WHEEL_SIZE == 0) || ((SOFT_TIMER_WHEEL_SIZE & (SOFT_TIMER_WHEEL_SIZE - 1)) != 0)
+#   error "SOFT_TIMER_WHEEL_SIZE must be a power of two!"
+#endif
+#if (F_CPU / (1024UL * SOFT_TIMER_TICK_FREQUENCY)) > 256
+#   error "SOFT_TIMER_TICK_FREQUENCY is too low for an 8-bit timer at this F_CPU!"
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+//!
+//! \brief          Software timer callback function type.
+//! \details        Function called when a software timer expires. The
+//!                     \a context_p pointer is the one given when the timer was
+//!                     created.
+//!
+typedef void (*softTimerCallback_t)(void *context_p);
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// SoftTimer Class
+// =============================================================================
+
+//!
+//! \brief          SoftTimer class.
+//! \details        This class multiplexes up to \ref SOFT_TIMER_MAX_TIMERS
+//!                     virtual timers over one hardware tick. The hardware
+//!                     tick must call \ref tick() from the interrupt callback
+//!                     of the chosen timer, e.g.:
+//! \code
+//!                 void timer0CompareACallback(void)
+//!                 {
+//!                     softTimer.tick();
+//!                 }
+//! \endcode
+//!                 Callbacks of timers created with Dispatch::DEFERRED are
+//!                     executed by \ref processDeferred(), that must be called
+//!                     from the main loop.
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class SoftTimer
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+    //!
+    //! \brief      Timer handle type.
+    //! \details    Identifies a virtual timer allocated by \ref create().
+    //!
+    typedef uint8_t handle_t;
+
+    //     ///////////////////////     MODE     ///////////////////////     //
+    //!
+    //! \brief      Timer mode enumeration.
+    //! \details    Behavior of the timer after expiring.
+    //!
+    enum class Mode : uint8_t {
+        ONE_SHOT                        = 0,    //!< Timer stops after expiring once.
+        PERIODIC                        = 1,    //!< Timer is automatically restarted with the same period.
+    };
+
+    //     /////////////////////     DISPATCH     /////////////////////     //
+    //!
+    //! \brief      Callback dispatch enumeration.
+    //! \details    Context where the timer callback is executed.
+    //!
+    enum class Dispatch : uint8_t {
+        ISR_CONTEXT                     = 0,    //!< Callback is executed inside tick(), in interrupt context. Keep it short.
+        DEFERRED                        = 1,    //!< Callback is executed by processDeferred(), in main loop context.
+    };
+
+    //     ////////////////////     TICK SOURCE    ////////////////////     //
+    //!
+    //! \brief      Tick source enumeration.
+    //! \details    Hardware timer configured by \ref init() to generate the
+    //!                 tick.
+    //!
+    enum class TickSource : uint8_t {
+        EXTERNAL                        = 0,    //!< The application configures the tick source by itself.
+        TIMER0                          = 1,    //!< TIMER0 is configured in CTC mode using compare A match.
+        TIMER2                          = 2,    //!< TIMER2 is configured in CTC mode using compare A match.
+    };
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      SoftTimer class constructor.
+    //! \details    Creates a SoftTimer object. The object still must be
+    //!                 initialized before use.
+    //! \see        init(const TickSource tickSource_p).
+    //!
+    SoftTimer(
+            void
+    );
+
+    //!
+    //! \brief      SoftTimer class destructor.
+    //! \details    Destroys a SoftTimer object.
+    //!
+    ~SoftTimer(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ///////////////////     INITIALIZATION    ////////////////////     //
+    //!
+    //! \brief      Initializes the software timer service.
+    //! \details    Initializes the software timer service, releasing all
+    //!                 timers. If \a tickSource_p is TIMER0 or TIMER2, the
+    //!                 hardware timer is configured to generate compare A
+    //!                 interrupts at \ref SOFT_TIMER_TICK_FREQUENCY.
+    //! \param[in]  tickSource_p        Hardware tick source.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t init(
+            const TickSource tickSource_p       = TickSource::EXTERNAL
+    );
+
+    //     ////////////////////     TIMER CONTROL    ////////////////////     //
+    //!
+    //! \brief      Allocates a virtual timer.
+    //! \details    Allocates a virtual timer. The timer is created stopped.
+    //! \param[out] handle_p            Pointer to store the timer handle.
+    //! \param[in]  callback_p          Function called when the timer expires.
+    //! \param[in]  context_p           Pointer passed to the callback.
+    //! \param[in]  mode_p              One-shot or periodic timer.
+    //! \param[in]  dispatch_p          Callback execution context.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t create(
+            handle_t *handle_p,
+            softTimerCallback_t callback_p,
+            void *context_p                     = nullptr,
+            const Mode mode_p                   = Mode::ONE_SHOT,
+            const Dispatch dispatch_p           = Dispatch::DEFERRED
+    );
+
+    //!
+    //! \brief      Releases a virtual timer.
+    //! \details    Stops the timer and releases its handle.
+    //! \param[in]  handle_p            Timer handle.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t destroy(
+            const handle_t handle_p
+    );
+
+    //!
+    //! \brief      Starts (or restarts) a virtual timer.
+    //! \details    Starts the timer to expire after \a ticks_p ticks. If the
+    //!                 timer is already running, it is restarted. Periodic
+    //!                 timers use \a ticks_p as their period.
+    //! \param[in]  handle_p            Timer handle.
+    //! \param[in]  ticks_p             Number of ticks until expiration.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t start(
+            const handle_t handle_p,
+            cuint32_t ticks_p
+    );
+
+    //!
+    //! \brief      Stops a virtual timer.
+    //! \details    Stops the timer and discards any pending deferred call.
+    //! \param[in]  handle_p            Timer handle.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t stop(
+            const handle_t handle_p
+    );
+
+    //!
+    //! \brief      Checks if a virtual timer is running.
+    //! \details    Checks if a virtual timer is running.
+    //! \param[in]  handle_p            Timer handle.
+    //! \retval     true                Timer is running.
+    //! \retval     false               Timer is stopped or handle is invalid.
+    //!
+    bool_t isRunning(
+            const handle_t handle_p
+    );
+
+    //     /////////////////////     EXECUTION     //////////////////////     //
+    //!
+    //! \brief      Executes pending deferred callbacks.
+    //! \details    Executes the callbacks of DEFERRED timers that expired
+    //!                 since the last call. Must be called from the main loop.
+    //! \return     uint8_t             Number of callbacks executed.
+    //!
+    uint8_t processDeferred(
+            void
+    );
+
+    //!
+    //! \brief      Advances the timing wheel by one tick.
+    //! \details    Advances the timing wheel by one tick, expiring the timers
+    //!                 of the current slot. Must be called from the hardware
+    //!                 tick interrupt callback.
+    //!
+    void tick(
+            void
+    );
+
+    //!
+    //! \brief      Returns the number of elapsed ticks.
+    //! \details    Returns the number of ticks since initialization. The value
+    //!                 is read atomically.
+    //! \return     uint32_t            Elapsed ticks.
+    //!
+    uint32_t inlined getTicks(
+            void
+    );
+
+    //!
+    //! \brief      Checks if the service was initialized.
+    //! \details    Checks if \ref init() was called successfully. With
+    //!                 TickSource::EXTERNAL, it does not tell whether the
+    //!                 application is calling \ref tick().
+    //! \retval     true                Service initialized.
+    //! \retval     false               Service not initialized.
+    //!
+    bool_t inlined isInitialized(
+            void
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    bool_t _isHandleValid(
+            const handle_t handle_p
+    );
+    void _link(
+            cuint8_t index_p,
+            cuint32_t ticks_p
+    );
+    void _unlink(
+            cuint8_t index_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    //     ///////////////////////     TIMERS     ///////////////////////     //
+    softTimerCallback_t _callback[SOFT_TIMER_MAX_TIMERS];
+    void            *_context[SOFT_TIMER_MAX_TIMERS];
+    uint32_t        _period[SOFT_TIMER_MAX_TIMERS];
+    uint16_t        _rounds[SOFT_TIMER_MAX_TIMERS];
+    uint8_t         _next[SOFT_TIMER_MAX_TIMERS];
+    uint8_t         _previous[SOFT_TIMER_MAX_TIMERS];
+    uint8_t         _slot[SOFT_TIMER_MAX_TIMERS];
+    uint32_t        _allocatedMask;
+    uint32_t        _runningMask;
+    uint32_t        _periodicMask;
+    uint32_t        _deferredMask;
+    vuint32_t       _pendingMask;
+
+    //     ///////////////////////     WHEEL     ////////////////////////     //
+    uint8_t         _wheel[SOFT_TIMER_WHEEL_SIZE];
+    uint8_t         _cursor;
+    vuint32_t       _ticks;
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    bool_t          _isInitialized      : 1;
+    Error           _lastError;
+}; // class SoftTimer
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+uint32_t inlined SoftTimer::getTicks(void)
+{
+    uint32_t aux32 = 0;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        aux32 = this->_ticks;
+    }
+    return aux32;
+}
+
+bool_t inlined SoftTimer::isInitialized(void)
+{
+    return (bool_t)this->_isInitialized;
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          SoftTimer service handler object.
+//! \details        SoftTimer service handler object.
+//! \warning        Use this object to handle the service. DO NOT create
+//!                     another instance of the class, since only one hardware
+//!                     tick drives the timing wheel.
+//!
+extern SoftTimer softTimer;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Soft_Timer"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_SOFT_TIMER_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
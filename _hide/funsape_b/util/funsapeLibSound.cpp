@@ -3,22 +3,220 @@
 
 #if defined(_FUNSAPE_PLATFORM_AVR)
 
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+
+// Note tables, computed from F_CPU at compile time and stored in flash. Notes
+// are generated by TIMER1 in CTC mode toggling OC1A, so the output frequency
+// is F_CPU / (2 * N * (OCR1A + 1)).
+
+// Octave 0 frequencies, in mHz; each octave above doubles them
+constexpr uint32_t soundOctave0Frequency[12] = {16352, 17324, 18354, 19445, 20602, 21827, 23125, 24500, 25957, 27500, 29135, 30868};
+constexpr uint16_t soundPrescalerValue[3] = {1, 8, 64};
+constexpr Timer1::ClockSource soundPrescalerClock[3] = {Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_64};
+cuint8_t soundNumberOfNotes = (uint8_t)Note::END;
+
+struct SoundNoteTable {
+    uint16_t ocrValue[soundNumberOfNotes];
+    Timer1::ClockSource clockSource[soundNumberOfNotes];
+
+    // Smallest prescaler that fits the compare value in 16 bits
+    constexpr SoundNoteTable() : ocrValue(), clockSource()
+    {
+        for(uint8_t i = 0; i < soundNumberOfNotes; i++) {
+            uint32_t frequency = soundOctave0Frequency[i % 12] << (i / 12);
+            clockSource[i] = Timer1::ClockSource::DISABLED;
+            for(uint8_t j = 0; j < 3; j++) {
+                uint64_t top = ((F_CPU * 1000ULL) + ((uint64_t)soundPrescalerValue[j] * frequency)) /
+                        (2ULL * soundPrescalerValue[j] * frequency);
+                if(top <= 65536ULL) {
+                    ocrValue[i] = (uint16_t)(top - 1);
+                    clockSource[i] = soundPrescalerClock[j];
+                    break;
+                }
+            }
+        }
+    }
+};
+
+static constexpr SoundNoteTable soundNoteTable PROGMEM = SoundNoteTable();
+
+static void soundSetTone(const Note note_p)
+{
+    uint8_t index = (uint8_t)note_p;
+
+    timer1.setCounterValue(0);
+    if(index >= soundNumberOfNotes) {
+        // Rest or invalid note
+        timer1.setClockSource(Timer1::ClockSource::DISABLED);
+        clrBit(PORTB, PB1);
+        return;
+    }
+    timer1.setClockSource((Timer1::ClockSource)pgm_read_byte(&soundNoteTable.clockSource[index]));
+    timer1.setCompareAValue(pgm_read_word(&soundNoteTable.ocrValue[index]));
+
+    return;
+}
+
 bool_t playNotes(Note *notes_p)
 {
     uint8_t i = 0;
 
     while(notes_p[i] != Note::END) {
-        timer1.setCounterValue(0);
-        timer1.setClockSource(notesPrescaler[(uint8_t)notes_p[i]]);
-        timer1.setCompareAValue(notesOcrValue[(uint8_t)notes_p[i]]);
+        soundSetTone(notes_p[i]);
         i++;
         delayMs(125);
     }
-    timer1.setCounterValue(0);
-    timer1.setClockSource(Timer1::ClockSource::DISABLED);
-    clrBit(PORTB, PB1);
+    soundSetTone(Note::REST);
+
+    return true;
+}
+
+static TaskContext soundTask;
+static Note *soundNotes = nullptr;
+static uint8_t soundIndex = 0;
+
+bool_t playNotesAsync(Note *notes_p)
+{
+    if(!isPointerValid(notes_p)) {
+        return false;
+    }
+
+    soundNotes = notes_p;
+    soundIndex = 0;
+    soundTask.restart();
+
+    return true;
+}
+
+bool_t isPlayingNotes(void)
+{
+    return isPointerValid(soundNotes);
+}
+
+TaskStatus playNotesTask(void *context_p)
+{
+    (void)context_p;
+
+    taskBegin(&soundTask);
+    while(1) {
+        taskWaitUntil(&soundTask, isPointerValid(soundNotes));
+        while(soundNotes[soundIndex] != Note::END) {
+            soundSetTone(soundNotes[soundIndex]);
+            soundIndex++;
+            taskSleepFor(&soundTask, schedulerMsToTicks(125));
+        }
+        soundSetTone(Note::REST);
+        soundNotes = nullptr;
+    }
+    taskEnd(&soundTask);
+}
+
+// Melody sequencer state; changed only inside atomic blocks or from the soft
+// timer callback (interrupt context)
+static SoftTimer::handle_t melodyTimer;
+static bool_t melodyTimerCreated = false;
+static const MelodyStep *volatile melodySteps = nullptr;
+static uint8_t melodyIndex = 0;
+static uint16_t melodySixteenthTicks = 1;
+static uint16_t melodyGapTicks = 0;
+static bool_t melodyRepeat = false;
+static bool_t melodyInGap = false;
+
+static void melodyStepCallback(void *context_p)
+{
+    Note note;
+    uint16_t ticks;
+
+    (void)context_p;
+
+    if(!isPointerValid(melodySteps)) {
+        return;
+    }
+
+    // End of note: short silence so repeated notes are heard apart
+    if(melodyInGap) {
+        melodyInGap = false;
+        soundSetTone(Note::REST);
+        softTimer.start(melodyTimer, melodyGapTicks);
+        return;
+    }
+
+    // Next step
+    note = (Note)pgm_read_byte(&melodySteps[melodyIndex].note);
+    if(note == Note::END) {
+        if((!melodyRepeat) || (melodyIndex == 0)) {
+            soundSetTone(Note::REST);
+            melodySteps = nullptr;
+            return;
+        }
+        melodyIndex = 0;
+        note = (Note)pgm_read_byte(&melodySteps[0].note);
+    }
+    ticks = pgm_read_byte(&melodySteps[melodyIndex].duration) * melodySixteenthTicks;
+    melodyIndex++;
+
+    // Articulation gap is 1/8 of the note length
+    melodyGapTicks = (note == Note::REST) ? 0 : (ticks >> 3);
+    melodyInGap = (melodyGapTicks != 0);
+    soundSetTone(note);
+    softTimer.start(melodyTimer, ticks - melodyGapTicks);
+
+    return;
+}
+
+bool_t playMelody(const MelodyStep *melody_p, cuint16_t tempo_p, cbool_t repeat_p)
+{
+    uint32_t sixteenthTicks;
+
+    if(!isPointerValid(melody_p) || (tempo_p == 0)) {
+        return false;
+    }
+    if(!melodyTimerCreated) {
+        if(!softTimer.create(&melodyTimer, melodyStepCallback, nullptr, SoftTimer::Mode::ONE_SHOT,
+                        SoftTimer::Dispatch::ISR_CONTEXT)) {
+            return false;
+        }
+        melodyTimerCreated = true;
+    }
+
+    // A sixteenth note lasts 15 s / tempo; longest note must fit 16 bits
+    sixteenthTicks = (15UL * SOFT_TIMER_TICK_FREQUENCY) / tempo_p;
+    if(sixteenthTicks == 0) {
+        sixteenthTicks = 1;
+    } else if(sixteenthTicks > 4095) {
+        sixteenthTicks = 4095;
+    }
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        softTimer.stop(melodyTimer);
+        melodySteps = melody_p;
+        melodyIndex = 0;
+        melodySixteenthTicks = (uint16_t)sixteenthTicks;
+        melodyRepeat = repeat_p;
+        melodyInGap = false;
+        melodyStepCallback(nullptr);
+    }
 
     return true;
 }
 
+void stopMelody(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if(melodyTimerCreated) {
+            softTimer.stop(melodyTimer);
+        }
+        melodySteps = nullptr;
+        soundSetTone(Note::REST);
+    }
+
+    return;
+}
+
+bool_t isPlayingMelody(void)
+{
+    return isPointerValid(melodySteps);
+}
+
 #endif // defined(_FUNSAPE_PLATFORM_AVR)
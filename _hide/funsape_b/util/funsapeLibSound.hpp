@@ -4,6 +4,7 @@
 
 #include "../funsapeLibGlobalDefines.hpp"
 #include "../peripheral/funsapeLibTimer1.hpp"
+#include "../util/funsapeLibScheduler.hpp"
 
 #if defined(_FUNSAPE_PLATFORM_AVR)
 
@@ -116,7 +117,31 @@ enum class Note : uint8_t {
     NOTE_A8             = 105,
     NOTE_AS8            = 106,
     NOTE_B8             = 107,
-    END                 = 108
+    END                 = 108,
+    REST                = 109
+};
+
+// Note lengths, in sixteenth notes
+enum class NoteDuration : uint8_t {
+    SIXTEENTH           = 1,
+    EIGHTH              = 2,
+    DOTTED_EIGHTH       = 3,
+    QUARTER             = 4,
+    DOTTED_QUARTER      = 6,
+    HALF                = 8,
+    DOTTED_HALF         = 12,
+    WHOLE               = 16
+};
+
+// Melody step; melodies are stored in flash and end with Note::END
+//     const MelodyStep alarm[] PROGMEM = {
+//         {Note::NOTE_A5, NoteDuration::EIGHTH},
+//         {Note::REST,    NoteDuration::EIGHTH},
+//         {Note::END,     NoteDuration::SIXTEENTH}
+//     };
+struct MelodyStep {
+    Note                note;
+    NoteDuration        duration;
 };
 
 inline bool operator==(const Note note1, const Note note2)
@@ -129,11 +154,18 @@ inline bool operator!=(const Note note1, const Note note2)
     return !(note1 == note2);
 }
 
-Timer1::ClockSource notesPrescaler[] = {Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_8, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1, Timer1::ClockSource::PRESCALER_1};
+bool_t playNotes(Note *notes_p);
 
-cuint16_t notesOcrValue[] = {61161, 57736, 54495, 51413, 48543, 45808, 43252, 40815, 38520, 36363, 34316, 32393, 30580, 28859, 27240, 25713, 24271, 22909, 21621, 20407, 19263, 18181, 17160, 16196, 15287, 14429, 13619, 12856, 12133, 11452, 10810, 10203, 9630, 9090, 8580, 64792, 61156, 57723, 54484, 51426, 48540, 45815, 43242, 40815, 38525, 36363, 34322, 32396, 30577, 28861, 27241, 25712, 24269, 22907, 21621, 20407, 19262, 18181, 17160, 16197, 15288, 14430, 13620, 12856, 12134, 11453, 10810, 10203, 9630, 9090, 8580, 8098, 7644, 7214, 6809, 6427, 6066, 5726, 5404, 5101, 4815, 4544, 4289, 4049, 3821, 3607, 3404, 3213, 3033, 2862, 2702, 2550, 2407, 2272, 2144, 2024, 1910, 1803, 1702, 1606, 1516, 1431, 1350, 1275, 1203, 1135, 1072, 1011};
+// Non-blocking version of playNotes(); add playNotesTask() to the scheduler
+bool_t playNotesAsync(Note *notes_p);
+bool_t isPlayingNotes(void);
+TaskStatus playNotesTask(void *context_p);
 
-bool_t playNotes(Note *notes_p);
+// Melody sequencer, advanced by a soft timer in interrupt context (softTimer
+// must be initialized); tempo is given in quarter notes per minute
+bool_t playMelody(const MelodyStep *melody_p, cuint16_t tempo_p, cbool_t repeat_p = false);
+void stopMelody(void);
+bool_t isPlayingMelody(void);
 
 #endif // defined(_FUNSAPE_PLATFORM_AVR)
 
@@ -0,0 +1,162 @@
+//!
+//! \file           funsapeLibTimestamp.cpp
+//! \brief          Microsecond timestamp service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        Microsecond timestamp service for the FunSAPE AVR8 Library
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// System file dependencies
+// =============================================================================
+
+#include "funsapeLibTimestamp.hpp"
+#if !defined(__FUNSAPE_LIB_TIMESTAMP_HPP)
+#    error "Header file is corrupted!"
+#elif __FUNSAPE_LIB_TIMESTAMP_HPP != 2407
+#    error "Version mismatch between source and header files!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+#include <util/atomic.h>
+
+// =============================================================================
+// File exclusive - Constants
+// =============================================================================
+
+#define DEBUG_TIMESTAMP                 0x3CFF
+
+#if TIMESTAMP_PRESCALER == 1
+#   define TIMESTAMP_CLOCK_SOURCE       Timer1::ClockSource::PRESCALER_1
+#elif TIMESTAMP_PRESCALER == 8
+#   define TIMESTAMP_CLOCK_SOURCE       Timer1::ClockSource::PRESCALER_8
+#else
+#   define TIMESTAMP_CLOCK_SOURCE       Timer1::ClockSource::PRESCALER_64
+#endif
+
+// =============================================================================
+// File exclusive - New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// File exclusive - Global variables
+// =============================================================================
+
+Timestamp timestamp;
+
+// =============================================================================
+// File exclusive - Macro-functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class constructors
+// =============================================================================
+
+Timestamp::Timestamp()
+{
+    // Mark passage for debugging purpose
+    debugMark("Timestamp::Timestamp(void)", DEBUG_TIMESTAMP);
+
+    // Reset data members
+    this->_overflows                    = 0;
+    this->_isInitialized                = false;
+
+    // Returns successfully
+    this->_lastError                    = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_TIMESTAMP);
+    return;
+}
+
+Timestamp::~Timestamp()
+{
+    // Returns successfully
+    debugMessage(Error::NONE, DEBUG_TIMESTAMP);
+    return;
+}
+
+// =============================================================================
+// Class public methods
+// =============================================================================
+
+//     ///////////////////     INITIALIZATION    ////////////////////     //
+bool_t Timestamp::init(void)
+{
+    // Mark passage for debugging purpose
+    debugMark("Timestamp::init(void)", DEBUG_TIMESTAMP);
+
+    // Configure TIMER1
+    if(!timer1.init(Timer1::Mode::NORMAL, TIMESTAMP_CLOCK_SOURCE)) {
+        // Returns error
+        this->_isInitialized = false;
+        this->_lastError = timer1.getLastError();
+        debugMessage(this->_lastError, DEBUG_TIMESTAMP);
+        return false;
+    }
+
+    // Reset counters
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        timer1.setCounterValue(0);
+        this->_overflows = 0;
+        timer1.clearOverflowInterruptRequest();
+        timer1.activateOverflowInterrupt();
+    }
+
+    // Update data members
+    this->_isInitialized = true;
+
+    // Returns successfully
+    this->_lastError = Error::NONE;
+    debugMessage(Error::NONE, DEBUG_TIMESTAMP);
+    return true;
+}
+
+//     /////////////////     CONTROL AND STATUS    //////////////////     //
+Error Timestamp::getLastError(void)
+{
+    // Returns last error
+    return this->_lastError;
+}
+
+// =============================================================================
+// Class private methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Class protected methods
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// General public functions definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt handlers
+// =============================================================================
+
+// NONE
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+// =============================================================================
+// END OF FILE
+// =============================================================================
@@ -0,0 +1,344 @@
+//!
+//! \file           funsapeLibTimestamp.hpp
+//! \brief          Microsecond timestamp service for the FunSAPE AVR8 Library
+//! \author         Leandro Schwarz (bladabuska+funsapeavr8lib@gmail.com)
+//! \date           2026-10-18
+//! \version        24.07
+//! \copyright      license
+//! \details        This file provides a free-running 32-bit timestamp built on
+//!                     TIMER1. The 16-bit hardware counter is extended by a
+//!                     software overflow counter, and the reads check the
+//!                     pending overflow flag, so a value is never torn when
+//!                     the counter wraps in the middle of a read. The reads
+//!                     can be used from both the main loop and interrupt
+//!                     handlers.
+//! \todo           Todo list
+//!
+
+// =============================================================================
+// Include guard (START)
+// =============================================================================
+
+#ifndef __FUNSAPE_LIB_TIMESTAMP_HPP
+#define __FUNSAPE_LIB_TIMESTAMP_HPP             2407
+
+// =============================================================================
+// Dependencies
+// =============================================================================
+
+//     /////////////////     GLOBAL DEFINITIONS FILE    /////////////////     //
+#include "../funsapeLibGlobalDefines.hpp"
+#if !defined(__FUNSAPE_LIB_GLOBAL_DEFINES_HPP)
+#   error "Global definitions file is corrupted!"
+#elif __FUNSAPE_LIB_GLOBAL_DEFINES_HPP != __FUNSAPE_LIB_TIMESTAMP_HPP
+#   error "Version mismatch between file header and global definitions file!"
+#endif
+
+//     //////////////////     LIBRARY DEPENDENCIES     //////////////////     //
+#include "../util/funsapeLibDebug.hpp"
+#if !defined(__FUNSAPE_LIB_DEBUG_HPP)
+#   error "Header file (funsapeLibDebug.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_DEBUG_HPP != __FUNSAPE_LIB_TIMESTAMP_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibDebug.hpp)!"
+#endif
+
+#include "../peripheral/funsapeLibTimer1.hpp"
+#if !defined(__FUNSAPE_LIB_TIMER1_HPP)
+#   error "Header file (funsapeLibTimer1.hpp) is corrupted!"
+#elif __FUNSAPE_LIB_TIMER1_HPP != __FUNSAPE_LIB_TIMESTAMP_HPP
+#   error "Version mismatch between header file and library dependency (funsapeLibTimer1.hpp)!"
+#endif
+
+#if defined(_FUNSAPE_PLATFORM_AVR)
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Utilities
+//! \brief          General purpose utilities.
+//! \{
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: Start subgroup "Utilities/Timestamp"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \addtogroup     Timestamp
+//! \brief          Microsecond timestamp service.
+//! \{
+//!
+
+// =============================================================================
+// Undefining previous definitions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Constant definitions
+// =============================================================================
+
+#ifndef TIMESTAMP_PRESCALER
+//!
+//! \brief          TIMER1 prescaler used by the timestamp service.
+//! \details        TIMER1 prescaler used by the timestamp service. Must be 1,
+//!                     8 or 64. With F_CPU = 16 MHz, the default value gives a
+//!                     0.5 us resolution.
+//!
+#   define TIMESTAMP_PRESCALER                  8
+#endif
+
+#if (TIMESTAMP_PRESCALER != 1) && (TIMESTAMP_PRESCALER != 8) && (TIMESTAMP_PRESCALER != 64)
+#   error "TIMESTAMP_PRESCALER must be 1, 8 or 64!"
+#endif
+
+// Counter ticks per microsecond (or microseconds per counter tick)
+#if ((F_CPU / TIMESTAMP_PRESCALER) >= 1000000UL) && (((F_CPU / TIMESTAMP_PRESCALER) % 1000000UL) == 0)
+#   define TIMESTAMP_COUNTS_PER_US      ((F_CPU / TIMESTAMP_PRESCALER) / 1000000UL)
+#   if (TIMESTAMP_COUNTS_PER_US & (TIMESTAMP_COUNTS_PER_US - 1)) != 0
+#       error "F_CPU / TIMESTAMP_PRESCALER must be a power of two multiple of 1 MHz!"
+#   endif
+#elif ((TIMESTAMP_PRESCALER * 1000000UL) % F_CPU) == 0
+#   define TIMESTAMP_US_PER_COUNT       ((TIMESTAMP_PRESCALER * 1000000UL) / F_CPU)
+#else
+#   error "F_CPU and TIMESTAMP_PRESCALER do not give an integer microsecond ratio!"
+#endif
+
+// =============================================================================
+// New data types
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Interrupt callback functions
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Public functions declarations
+// =============================================================================
+
+// NONE
+
+// =============================================================================
+// Timestamp Class
+// =============================================================================
+
+//!
+//! \brief          Timestamp class.
+//! \details        This class keeps TIMER1 running in NORMAL mode and counts
+//!                     its overflows. The overflow counter must be updated
+//!                     from the TIMER1 overflow interrupt callback:
+//! \code
+//!                 void timer1OverflowCallback(void)
+//!                 {
+//!                     timestamp.overflowHandler();
+//!                 }
+//! \endcode
+//! \warning        The service takes TIMER1 over; TIMER1 PWM, input capture
+//!                     and sound cannot be used at the same time.
+//! \warning        An instance of this class is already defined as a global
+//!                     object. Therefore, there is not necessary, neither
+//!                     recommended to create another object of this class.
+//!
+class Timestamp
+{
+    // -------------------------------------------------------------------------
+    // New data types ----------------------------------------------------------
+public:
+    // NONE
+
+    // -------------------------------------------------------------------------
+    // Constructors ------------------------------------------------------------
+public:
+
+    //!
+    //! \brief      Timestamp class constructor.
+    //! \details    Creates a Timestamp object. The object still must be
+    //!                 initialized before use.
+    //! \see        init(void).
+    //!
+    Timestamp(
+            void
+    );
+
+    //!
+    //! \brief      Timestamp class destructor.
+    //! \details    Destroys a Timestamp object.
+    //!
+    ~Timestamp(
+            void
+    );
+
+    // -------------------------------------------------------------------------
+    // Methods -----------------------------------------------------------------
+public:
+    //     ///////////////////     INITIALIZATION    ////////////////////     //
+    //!
+    //! \brief      Initializes the timestamp service.
+    //! \details    Configures TIMER1 in NORMAL mode with the
+    //!                 \ref TIMESTAMP_PRESCALER prescaler, clears the counters
+    //!                 and activates the overflow interrupt.
+    //! \retval     true                Success.
+    //! \retval     false               Retrieve the error using the \ref
+    //!                                     getLastError() function.
+    //!
+    bool_t init(
+            void
+    );
+
+    //     //////////////////////     READING     ///////////////////////     //
+    //!
+    //! \brief      Returns the elapsed CPU cycles.
+    //! \details    Returns the number of CPU cycles since initialization,
+    //!                 with the resolution of the TIMER1 prescaler. The value
+    //!                 wraps around at 2^32.
+    //! \return     uint32_t            Elapsed CPU cycles.
+    //!
+    uint32_t inlined getCycles(
+            void
+    );
+
+    //!
+    //! \brief      Returns the elapsed microseconds.
+    //! \details    Returns the number of microseconds since initialization.
+    //!                 The value wraps around at 2^32, so the difference of
+    //!                 two readings is always valid as an unsigned number.
+    //! \return     uint32_t            Elapsed microseconds.
+    //!
+    uint32_t inlined getMicros(
+            void
+    );
+
+    //     //////////////////////     INTERRUPT     //////////////////////     //
+    //!
+    //! \brief      Extends the counter on TIMER1 overflow.
+    //! \details    Must be called from timer1OverflowCallback().
+    //!
+    void inlined overflowHandler(
+            void
+    );
+
+    //     /////////////////     CONTROL AND STATUS    //////////////////     //
+    //!
+    //! \brief      Returns the last error.
+    //! \details    Returns the last error.
+    //! \return     Error               Error status of the last operation.
+    //!
+    Error getLastError(
+            void
+    );
+
+private:
+    void inlined _readCounter(
+            uint32_t *overflows_p,
+            uint16_t *counter_p
+    );
+
+    // -------------------------------------------------------------------------
+    // Properties --------------------------------------------------------------
+private:
+    vuint32_t       _overflows;
+    bool_t          _isInitialized      : 1;
+    Error           _lastError;
+}; // class Timestamp
+
+// =============================================================================
+// Inlined class functions
+// =============================================================================
+
+//!
+//! \cond
+//!
+
+void inlined Timestamp::_readCounter(uint32_t *overflows_p, uint16_t *counter_p)
+{
+    uint32_t overflows;
+    uint16_t counter;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        overflows = this->_overflows;
+        counter = TCNT1;
+        // Overflow happened but was not serviced yet (interrupts are off)
+        if(isBitSet(TIFR1, TOV1) && (counter < 0x8000)) {
+            overflows++;
+        }
+    }
+    *overflows_p = overflows;
+    *counter_p = counter;
+    return;
+}
+
+uint32_t inlined Timestamp::getCycles(void)
+{
+    uint32_t overflows;
+    uint16_t counter;
+
+    this->_readCounter(&overflows, &counter);
+    return (((overflows << 16) | counter) * TIMESTAMP_PRESCALER);
+}
+
+uint32_t inlined Timestamp::getMicros(void)
+{
+    uint32_t overflows;
+    uint16_t counter;
+
+    this->_readCounter(&overflows, &counter);
+#if defined(TIMESTAMP_COUNTS_PER_US)
+    return ((overflows * (65536UL / TIMESTAMP_COUNTS_PER_US)) + (counter / TIMESTAMP_COUNTS_PER_US));
+#else
+    return (((overflows << 16) | counter) * TIMESTAMP_US_PER_COUNT);
+#endif
+}
+
+void inlined Timestamp::overflowHandler(void)
+{
+    this->_overflows++;
+    return;
+}
+
+//!
+//! \endcond
+//!
+
+// =============================================================================
+// External global variables
+// =============================================================================
+
+//!
+//! \brief          Timestamp service handler object.
+//! \details        Timestamp service handler object.
+//! \warning        Use this object to handle the service. DO NOT create
+//!                     another instance of the class, since there is only one
+//!                     TIMER1 in the device.
+//!
+extern Timestamp timestamp;
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End subgroup "Utilities/Timestamp"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Doxygen: End main group "Utilities"
+// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//!
+//! \}
+//!
+
+// =============================================================================
+// Include guard (END)
+// =============================================================================
+
+#endif // defined(_FUNSAPE_PLATFORM_AVR)
+
+#endif  // __FUNSAPE_LIB_TIMESTAMP_HPP
+
+// =============================================================================
+// END OF FILE
+// =============================================================================